@@ -0,0 +1,51 @@
+#include <BenchContext.hpp>
+
+#include <Components/System.hpp>
+#include <Factory/PlayerFactory.hpp>
+#include <Systems/PersistSystem.hpp>
+#include <Systems/PersistSystemImpl.hpp>
+#include <Systems/Render/RenderSystem.hpp>
+#include <Systems/Stores/ItemStore.hpp>
+#include <Systems/Stores/NpcStore.hpp>
+#include <Utils/AssetLoader.hpp>
+
+namespace ProceduralMaze::Bench
+{
+
+BenchContext &BenchContext::get()
+{
+  static BenchContext instance;
+  return instance;
+}
+
+BenchContext::BenchContext()
+    : m_sprite_factory( std::make_unique<Sprites::SpriteFactory>( true ) ),
+      m_sound_bank( std::make_unique<Audio::SoundBank>( true ) )
+{
+  Sys::RenderSystem::set_headless( true );
+  {
+    Utils::AssetLoader loader;
+    m_sprite_factory->init( loader );
+    m_sound_bank->init( loader );
+  }
+  m_system_store = std::make_unique<Sys::Store>( m_window, *m_sprite_factory, *m_sound_bank, m_nav_event_dispatcher, m_scenemanager_event_queue );
+}
+
+void BenchContext::bind( entt::registry &reg )
+{
+  for ( auto &[type, system] : *m_system_store )
+  {
+    system->reg( reg );
+  }
+
+  auto &persistent_sys = m_system_store->find<Sys::Store::Type::PersistSystem>();
+  persistent_sys.initialize_component_registry();
+  persistent_sys.load_state();
+
+  reg.emplace<Cmp::System>( reg.create() );
+  m_system_store->find<Sys::Store::Type::ItemStore>().init_store();
+  m_system_store->find<Sys::Store::Type::NpcStore>().init_store();
+  Factory::create_player( reg );
+}
+
+} // namespace ProceduralMaze::Bench
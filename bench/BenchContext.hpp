@@ -0,0 +1,51 @@
+#ifndef BENCH_BENCHCONTEXT_HPP_
+#define BENCH_BENCHCONTEXT_HPP_
+
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/signal/dispatcher.hpp>
+
+#include <Audio/SoundBank.hpp>
+#include <Sprites/SpriteFactory.hpp>
+#include <Systems/SystemStore.hpp>
+
+#include <memory>
+
+namespace ProceduralMaze::Bench
+{
+
+//! @brief Fixed seed for every benchmark iteration, so each iteration generates the same level/walk/path
+inline constexpr unsigned long kSeed = 1234;
+
+//! @brief The game services the benchmarks run against: a window that is never opened, and a headless sprite factory, sound
+//! bank and system store, so no OpenGL context or audio device is needed. Built once per process on first use, because
+//! decoding the sprites dominates start-up.
+class BenchContext
+{
+public:
+  static BenchContext &get();
+
+  BenchContext( const BenchContext & ) = delete;
+  BenchContext &operator=( const BenchContext & ) = delete;
+
+  Sys::Store &systems() { return *m_system_store; }
+  Sprites::SpriteFactory &sprite_factory() { return *m_sprite_factory; }
+
+  //! @brief Point every system at `reg` and populate it the way a scene's on_init() does before generating a level:
+  //! the persistent settings, the System component, the item/NPC stores and a player.
+  void bind( entt::registry &reg );
+
+private:
+  BenchContext();
+
+  sf::RenderWindow m_window;
+  std::unique_ptr<Sprites::SpriteFactory> m_sprite_factory;
+  std::unique_ptr<Audio::SoundBank> m_sound_bank;
+  entt::dispatcher m_nav_event_dispatcher;
+  entt::dispatcher m_scenemanager_event_queue;
+  std::unique_ptr<Sys::Store> m_system_store;
+};
+
+} // namespace ProceduralMaze::Bench
+
+#endif // BENCH_BENCHCONTEXT_HPP_
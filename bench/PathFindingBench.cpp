@@ -0,0 +1,139 @@
+#include <benchmark/benchmark.h>
+
+#include <Components/Position.hpp>
+#include <PathFinding/AStar.hpp>
+#include <PathFinding/SpatialHashGrid.hpp>
+#include <Utils/Constants.hpp>
+
+#include <entt/entity/registry.hpp>
+
+#include <vector>
+
+namespace ProceduralMaze::Bench
+{
+
+namespace
+{
+
+enum class Layout { OPEN, MAZE };
+
+//! @brief Is cell x/y a wall? Walls fill every fourth column, leaving a one cell gap that alternates between the bottom and
+//! top row, so the only route across the grid snakes through every column.
+bool is_maze_wall( int x, int y, int size )
+{
+  if ( x % 4 != 2 ) return false;
+  const int gap_row = ( x / 4 ) % 2 == 0 ? size - 1 : 0;
+  return y != gap_row;
+}
+
+//! @brief Create a world position entity for every walkable cell of a `size` x `size` grid and add it to `navmesh`
+void build_navmesh( entt::registry &reg, PathFinding::SpatialHashGrid &navmesh, int size, Layout layout )
+{
+  for ( int y = 0; y < size; ++y )
+  {
+    for ( int x = 0; x < size; ++x )
+    {
+      if ( layout == Layout::MAZE && is_maze_wall( x, y, size ) ) continue;
+      Cmp::Position pos_cmp( { x * Constants::kGridSizePxF.x, y * Constants::kGridSizePxF.y }, Constants::kGridSizePxF );
+      auto entt = reg.create();
+      reg.emplace<Cmp::Position>( entt, pos_cmp );
+      navmesh.insert( entt, pos_cmp );
+    }
+  }
+}
+
+Cmp::Position cell_position( int x, int y ) { return Cmp::Position( { x * Constants::kGridSizePxF.x, y * Constants::kGridSizePxF.y }, Constants::kGridSizePxF ); }
+
+void bm_astar( benchmark::State &state, Layout layout )
+{
+  const auto size = static_cast<int>( state.range( 0 ) );
+  entt::registry reg;
+  PathFinding::SpatialHashGrid navmesh( { static_cast<unsigned int>( size ), static_cast<unsigned int>( size ) } );
+  build_navmesh( reg, navmesh, size, layout );
+
+  const auto start = cell_position( 0, 0 );
+  const auto goal = cell_position( size - 1, size - 1 );
+  std::size_t path_length = 0;
+  for ( auto _ : state )
+  {
+    auto path = PathFinding::astar( reg, navmesh, start, goal );
+    path_length = path.size();
+    benchmark::DoNotOptimize( path );
+  }
+  state.counters["path_length"] = static_cast<double>( path_length );
+}
+
+void BM_AStar_OpenGrid( benchmark::State &state ) { bm_astar( state, Layout::OPEN ); }
+void BM_AStar_MazeGrid( benchmark::State &state ) { bm_astar( state, Layout::MAZE ); }
+
+//! @brief Positions of every cell of a `size` x `size` grid, with an entity each
+std::vector<std::pair<entt::entity, Cmp::Position>> make_cells( entt::registry &reg, int size )
+{
+  std::vector<std::pair<entt::entity, Cmp::Position>> cells;
+  cells.reserve( static_cast<std::size_t>( size * size ) );
+  for ( int y = 0; y < size; ++y )
+  {
+    for ( int x = 0; x < size; ++x )
+    {
+      cells.emplace_back( reg.create(), cell_position( x, y ) );
+    }
+  }
+  return cells;
+}
+
+//! @brief range(0): grid size in cells, range(1): 1 for dense (bounded) storage, 0 for the unbounded hash map
+void BM_SpatialHashGrid_Insert( benchmark::State &state )
+{
+  const auto size = static_cast<int>( state.range( 0 ) );
+  const bool dense = state.range( 1 ) != 0;
+  entt::registry reg;
+  const auto cells = make_cells( reg, size );
+
+  for ( auto _ : state )
+  {
+    PathFinding::SpatialHashGrid grid = dense ? PathFinding::SpatialHashGrid( { static_cast<unsigned int>( size ), static_cast<unsigned int>( size ) } )
+                                              : PathFinding::SpatialHashGrid();
+    for ( const auto &[entt, pos_cmp] : cells )
+    {
+      grid.insert( entt, pos_cmp );
+    }
+    benchmark::DoNotOptimize( grid );
+  }
+  state.SetItemsProcessed( state.iterations() * static_cast<int64_t>( cells.size() ) );
+}
+
+//! @brief range(0): grid size in cells, range(1): 1 for dense (bounded) storage, 0 for the unbounded hash map
+void BM_SpatialHashGrid_Query( benchmark::State &state )
+{
+  const auto size = static_cast<int>( state.range( 0 ) );
+  const bool dense = state.range( 1 ) != 0;
+  entt::registry reg;
+  const auto cells = make_cells( reg, size );
+  PathFinding::SpatialHashGrid grid = dense ? PathFinding::SpatialHashGrid( { static_cast<unsigned int>( size ), static_cast<unsigned int>( size ) } )
+                                            : PathFinding::SpatialHashGrid();
+  for ( const auto &[entt, pos_cmp] : cells )
+  {
+    grid.insert( entt, pos_cmp );
+  }
+
+  for ( auto _ : state )
+  {
+    std::size_t total = 0;
+    for ( const auto &[entt, pos_cmp] : cells )
+    {
+      total += grid.neighbour_count( pos_cmp );
+    }
+    benchmark::DoNotOptimize( total );
+  }
+  state.SetItemsProcessed( state.iterations() * static_cast<int64_t>( cells.size() ) );
+}
+
+} // namespace
+
+// 99 is the size of the graveyard. The maze route visits most cells, so past 64 it outgrows the AStar node budget.
+BENCHMARK( BM_AStar_OpenGrid )->Arg( 32 )->Arg( 64 )->Arg( 99 );
+BENCHMARK( BM_AStar_MazeGrid )->Arg( 32 )->Arg( 48 )->Arg( 64 );
+BENCHMARK( BM_SpatialHashGrid_Insert )->ArgsProduct( { { 32, 99 }, { 0, 1 } } );
+BENCHMARK( BM_SpatialHashGrid_Query )->ArgsProduct( { { 32, 99 }, { 0, 1 } } );
+
+} // namespace ProceduralMaze::Bench
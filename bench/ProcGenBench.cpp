@@ -0,0 +1,157 @@
+#include <benchmark/benchmark.h>
+
+#include <BenchContext.hpp>
+
+#include <Components/Crypt/CryptPassageDoor.hpp>
+#include <Components/Position.hpp>
+#include <Components/Wall.hpp>
+#include <SceneControl/SceneData.hpp>
+#include <Systems/ProcGen/CellAutomataSystem.hpp>
+#include <Systems/ProcGen/PassageAlgorithms.hpp>
+#include <Systems/ProcGen/RandomLevelGenerator.hpp>
+#include <Utils/Constants.hpp>
+#include <Utils/RngStreams.hpp>
+
+#include <entt/entity/registry.hpp>
+
+#include <array>
+#include <chrono>
+#include <memory>
+
+namespace ProceduralMaze::Bench
+{
+
+namespace
+{
+
+struct SceneFile
+{
+  const char *name;
+  const char *path;
+};
+
+//! @brief The Tiled maps of every scene that generates its level with RandomLevelGenerator::gen_game_area()
+constexpr std::array<SceneFile, 6> kSceneFiles{ {
+    { "graveyard", "res/scenes/graveyard.json" },
+    { "crypt", "res/scenes/crypt.json" },
+    { "holywell", "res/scenes/well.json" },
+    { "ruinlower", "res/scenes/ruinlower.json" },
+    { "ruinupper", "res/scenes/ruinupper.json" },
+    { "shop", "res/scenes/shop.json" },
+} };
+
+//! @brief Wall-clock seconds taken by `work`. Benchmarks that must rebuild their fixture every iteration report this with
+//! `UseManualTime()`, because Pause/ResumeTiming cost about as much as the smaller timed calls themselves.
+template <typename Work>
+double time_seconds( Work &&work )
+{
+  const auto start = std::chrono::steady_clock::now();
+  work();
+  return std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+}
+
+//! @brief range(0): index into kSceneFiles
+void BM_RandomLevelGenerator_GenGameArea( benchmark::State &state )
+{
+  const auto &scene_file = kSceneFiles.at( static_cast<std::size_t>( state.range( 0 ) ) );
+  state.SetLabel( scene_file.name );
+
+  auto &context = BenchContext::get();
+  auto &random_level_sys = context.systems().find<Sys::Store::Type::RandomLevelGenerator>();
+  const Scene::SceneData scene_data( scene_file.path );
+  const auto map_size_grid = scene_data.map_size().first;
+
+  for ( auto _ : state )
+  {
+    // a fresh registry per iteration, so every iteration generates the same level from scratch
+    auto reg = std::make_unique<entt::registry>();
+    context.bind( *reg );
+    random_level_sys.reset( map_size_grid );
+    Utils::Rnd::RngStreams::set_seed( kSeed );
+
+    state.SetIterationTime( time_seconds( [&]() { random_level_sys.gen_game_area( scene_data ); } ) );
+  }
+}
+
+//! @brief The graveyard is generated as GraveyardScene::on_init() does, up to the automata.
+void BM_CellAutomataSystem_Smooth( benchmark::State &state )
+{
+  auto &context = BenchContext::get();
+  auto &random_level_sys = context.systems().find<Sys::Store::Type::RandomLevelGenerator>();
+  auto &cellauto_sys = context.systems().find<Sys::Store::Type::CellAutomataSystem>();
+  const Scene::SceneData scene_data( "res/scenes/graveyard.json" );
+  const auto map_size_grid = scene_data.map_size().first;
+
+  for ( auto _ : state )
+  {
+    // smooth() adds and removes obstacles, so each iteration needs a freshly generated graveyard
+    auto reg = std::make_unique<entt::registry>();
+    context.bind( *reg );
+    random_level_sys.reset( map_size_grid );
+    Utils::Rnd::RngStreams::set_seed( kSeed );
+    random_level_sys.gen_game_area( scene_data );
+    random_level_sys.gen_graveyard_exterior_obstacles();
+
+    state.SetIterationTime( time_seconds(
+        [&]() { cellauto_sys.smooth( Sys::ProcGen::RandomLevelGenerator::SceneType::GRAVEYARD_EXTERIOR, random_level_sys.get_obstacle_sm() ); } ) );
+  }
+}
+
+//! @brief A `size` x `size` crypt-like map: a wall border with a pillar every eighth cell
+void add_passage_walls( entt::registry &reg, int size )
+{
+  for ( int y = 0; y < size; ++y )
+  {
+    for ( int x = 0; x < size; ++x )
+    {
+      const bool border = x == 0 || y == 0 || x == size - 1 || y == size - 1;
+      const bool pillar = x % 8 == 4 && y % 8 == 4;
+      if ( not border && not pillar ) continue;
+
+      auto entt = reg.create();
+      reg.emplace<Cmp::Wall>( entt );
+      reg.emplace<Cmp::Position>( entt, sf::Vector2f( x * Constants::kGridSizePxF.x, y * Constants::kGridSizePxF.y ), Constants::kGridSizePxF );
+    }
+  }
+}
+
+//! @brief range(0): map size in cells. The passage runs from a door near the bottom-left corner to a room in the top-right corner.
+void bm_passage( benchmark::State &state, Sys::ProcGen::WalkingType walk_type )
+{
+  const auto size = static_cast<int>( state.range( 0 ) );
+  const sf::Vector2f map_size_pixel( size * Constants::kGridSizePxF.x, size * Constants::kGridSizePxF.y );
+
+  entt::registry reg;
+  add_passage_walls( reg, size );
+  Sys::ProcGen::PassageAlogirthms passage_algos;
+  passage_algos.cache_wall_components( reg );
+
+  const Cmp::CryptPassageDoor start( 2 * Constants::kGridSizePxF.x, ( size - 3 ) * Constants::kGridSizePxF.y, false,
+                                     Cmp::CryptPassageDirection::NORTH );
+  const sf::FloatRect end_bounds( { ( size - 7 ) * Constants::kGridSizePxF.x, 2 * Constants::kGridSizePxF.y },
+                                  { 4 * Constants::kGridSizePxF.x, 4 * Constants::kGridSizePxF.y } );
+
+  std::size_t block_count = 0;
+  for ( auto _ : state )
+  {
+    Utils::Rnd::RngStreams::set_seed( kSeed );
+    passage_algos.reset();
+    auto blocks = walk_type == Sys::ProcGen::WalkingType::DRUNK ? passage_algos.create_drunken_walk( reg, start, end_bounds, map_size_pixel, {} )
+                                                                : passage_algos.create_dog_leg( reg, start, end_bounds );
+    block_count = blocks.size();
+    benchmark::DoNotOptimize( blocks );
+  }
+  state.counters["blocks"] = static_cast<double>( block_count );
+}
+
+void BM_PassageAlgorithms_DrunkenWalk( benchmark::State &state ) { bm_passage( state, Sys::ProcGen::WalkingType::DRUNK ); }
+void BM_PassageAlgorithms_DogLeg( benchmark::State &state ) { bm_passage( state, Sys::ProcGen::WalkingType::DOGLEG ); }
+
+} // namespace
+
+BENCHMARK( BM_RandomLevelGenerator_GenGameArea )->DenseRange( 0, kSceneFiles.size() - 1 )->UseManualTime()->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_CellAutomataSystem_Smooth )->UseManualTime()->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_PassageAlgorithms_DrunkenWalk )->Arg( 32 )->Arg( 64 );
+BENCHMARK( BM_PassageAlgorithms_DogLeg )->Arg( 32 )->Arg( 64 );
+
+} // namespace ProceduralMaze::Bench
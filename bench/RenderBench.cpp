@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+
+#include <BenchContext.hpp>
+
+#include <Components/Persistent/PlayerStartPosition.hpp>
+#include <Components/Position.hpp>
+#include <Components/ZOrderValue.hpp>
+#include <Systems/PersistSystem.hpp>
+#include <Systems/PersistSystemImpl.hpp>
+#include <Systems/Render/RenderGameSystem.hpp>
+#include <Utils/Constants.hpp>
+
+#include <entt/entity/registry.hpp>
+
+#include <random>
+#include <vector>
+
+namespace ProceduralMaze::Bench
+{
+
+namespace
+{
+
+//! @brief range(0): z-ordered entities, range(1): percentage of them whose z-order changes every frame.
+//! The entities are spread over a square four times the world view, so roughly a quarter of them survive the culling.
+void BM_RenderGameSystem_RefreshZOrderQueue( benchmark::State &state )
+{
+  const auto entity_count = static_cast<std::size_t>( state.range( 0 ) );
+  const auto changed_count = entity_count * static_cast<std::size_t>( state.range( 1 ) ) / 100;
+
+  auto &context = BenchContext::get();
+  entt::registry reg;
+  context.bind( reg );
+  auto &render_game_sys = context.systems().find<Sys::Store::Type::RenderGameSystem>();
+
+  const sf::Vector2f area = Sys::RenderSystem::kWorldViewSizeF * 2.f;
+  Sys::PersistSystem::add<Cmp::Persist::PlayerStartPosition>( reg, area * 0.5f );
+  render_game_sys.init_world_view();
+
+  std::mt19937 rng( kSeed );
+  std::uniform_real_distribution<float> x_dist( 0.f, area.x );
+  std::uniform_real_distribution<float> y_dist( 0.f, area.y );
+  std::vector<entt::entity> entities( entity_count );
+  for ( auto &entt : entities )
+  {
+    entt = reg.create();
+    const sf::Vector2f pos( x_dist( rng ), y_dist( rng ) );
+    reg.emplace<Cmp::Position>( entt, pos, Constants::kGridSizePxF );
+    reg.emplace<Cmp::ZOrderValue>( entt, pos.y );
+  }
+  // the first refresh sorts the whole queue, later ones only move what changed
+  render_game_sys.refresh_z_order_queue();
+
+  std::uniform_int_distribution<std::size_t> entity_dist( 0, entity_count - 1 );
+  std::uniform_real_distribution<float> z_dist( 0.f, area.y );
+  for ( auto _ : state )
+  {
+    for ( std::size_t i = 0; i < changed_count; ++i )
+    {
+      reg.patch<Cmp::ZOrderValue>( entities[entity_dist( rng )], [&]( auto &zorder_cmp ) { zorder_cmp.setZOrder( z_dist( rng ) ); } );
+    }
+    render_game_sys.refresh_z_order_queue();
+  }
+  state.SetItemsProcessed( state.iterations() * static_cast<int64_t>( entity_count ) );
+}
+
+} // namespace
+
+BENCHMARK( BM_RenderGameSystem_RefreshZOrderQueue )->ArgsProduct( { { 1000, 10000, 50000 }, { 0, 1, 10 } } );
+
+} // namespace ProceduralMaze::Bench
@@ -0,0 +1,16 @@
+#include <benchmark/benchmark.h>
+#include <spdlog/spdlog.h>
+
+//! Run from the build's bin directory (the benchmarks load the scenes and sprites from res/), e.g.
+//!   cd build/bin && ./ProceduralMazeBench --benchmark_repetitions=5 --benchmark_out=bench.json
+int main( int argc, char **argv )
+{
+  // the systems log every generation step, which would swamp the timings
+  spdlog::set_level( spdlog::level::warn );
+
+  benchmark::Initialize( &argc, argv );
+  if ( benchmark::ReportUnrecognizedArguments( argc, argv ) ) return 1;
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
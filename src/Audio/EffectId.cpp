@@ -0,0 +1,43 @@
+#include <Audio/EffectId.hpp>
+
+#include <deque>
+#include <unordered_map>
+
+namespace ProceduralMaze::Audio
+{
+
+namespace
+{
+
+//! @brief Storage for every interned effect name
+struct EffectIdTable
+{
+  //! @brief indexed by ID. A deque so `EffectId::name()` references survive later interning.
+  std::deque<std::string> names{ std::string{} };
+  std::unordered_map<std::string_view, EffectId::Id> ids{ { std::string_view{}, 0 } };
+};
+
+EffectIdTable &table()
+{
+  static EffectIdTable instance;
+  return instance;
+}
+
+} // namespace
+
+const std::string &EffectId::name() const { return table().names[m_id]; }
+
+std::size_t EffectId::count() { return table().names.size(); }
+
+EffectId::Id EffectId::intern( std::string_view name )
+{
+  auto &tbl = table();
+  if ( auto it = tbl.ids.find( name ); it != tbl.ids.end() ) return it->second;
+
+  const auto id = static_cast<Id>( tbl.names.size() );
+  const auto &stored = tbl.names.emplace_back( name );
+  tbl.ids.emplace( stored, id );
+  return id;
+}
+
+} // namespace ProceduralMaze::Audio
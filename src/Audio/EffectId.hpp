@@ -0,0 +1,47 @@
+#ifndef SRC_AUDIO_EFFECTID_HPP_
+#define SRC_AUDIO_EFFECTID_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace ProceduralMaze::Audio
+{
+
+//! @brief Pre-resolved handle to a sound effect, e.g. "bomb_detonate"
+//! Each distinct name is given a compact integer ID the first time it is seen, so playing an effect indexes straight into the
+//! SoundBank instead of hashing a string. Call sites should use the constants in Audio/Effects.hpp.
+//! @note Interning is not thread-safe: new effect names must be created on the main thread.
+class EffectId
+{
+public:
+  using Id = uint16_t;
+
+  //! @brief The empty effect "", which always has ID 0
+  EffectId() = default;
+  explicit EffectId( std::string_view name )
+      : m_id( intern( name ) )
+  {
+  }
+
+  Id id() const { return m_id; }
+  bool empty() const { return m_id == 0; }
+
+  //! @brief The interned name. The reference stays valid for the lifetime of the program.
+  const std::string &name() const;
+
+  bool operator==( const EffectId &rhs ) const = default;
+
+  //! @brief One past the largest ID handed out so far
+  static std::size_t count();
+
+private:
+  static Id intern( std::string_view name );
+
+  Id m_id{ 0 };
+};
+
+} // namespace ProceduralMaze::Audio
+
+#endif // SRC_AUDIO_EFFECTID_HPP_
@@ -0,0 +1,58 @@
+#ifndef SRC_AUDIO_EFFECTS_HPP_
+#define SRC_AUDIO_EFFECTS_HPP_
+
+#include <Audio/EffectId.hpp>
+
+#include <array>
+
+//! @brief Pre-resolved handles for every sound effect loaded by SoundBank::init, so triggering a sound never hashes a string.
+namespace ProceduralMaze::Audio::Effect
+{
+
+inline const EffectId kFallback{ "fallback" };
+
+inline const EffectId kWormholeJump{ "wormhole_jump" };
+inline const EffectId kShrineLighting{ "shrine_lighting" };
+
+inline const EffectId kSecret{ "secret" };
+inline const EffectId kDropRelic{ "drop_relic" };
+inline const EffectId kSpawnGhost{ "spawn_ghost" };
+inline const EffectId kSpawnSkeleton{ "spawn_skeleton" };
+inline const EffectId kDamagePlayer{ "damage_player" };
+
+inline const EffectId kFootsteps{ "footsteps" };
+inline const EffectId kBombFuse{ "bomb_fuse" };
+inline const EffectId kBombDetonate{ "bomb_detonate" };
+inline const EffectId kDropLoot{ "drop_loot" };
+inline const EffectId kGetLoot{ "get_loot" };
+inline const EffectId kGetKey{ "get_key" };
+inline const EffectId kBreakPot{ "break_pot" };
+inline const EffectId kHitPot{ "hit_pot" };
+inline const EffectId kHitGrave{ "hit_grave" };
+inline const EffectId kDiggingEarth{ "digging_earth" };
+inline const EffectId kChopping{ "chopping" };
+inline const EffectId kChoppingFinal{ "chopping_final" };
+inline const EffectId kAxeWhip{ "axe_whip" };
+inline const EffectId kSkeleDeath{ "skele_death" };
+
+//! @brief The pickaxe strikes, picked at random while digging
+inline const std::array<EffectId, 6> kPickaxe{ EffectId{ "pickaxe1" }, EffectId{ "pickaxe2" }, EffectId{ "pickaxe3" },
+                                               EffectId{ "pickaxe4" }, EffectId{ "pickaxe5" }, EffectId{ "pickaxe6" } };
+inline const EffectId kPickaxeFinal{ "pickaxe_final" };
+
+inline const EffectId kCryptOpen{ "crypt_open" };
+inline const EffectId kCryptLocked{ "crypt_locked" };
+inline const EffectId kCryptRoomShuffle{ "crypt_room_shuffle" };
+inline const EffectId kCryptLeverOpen{ "crypt_lever_open" };
+inline const EffectId kCryptChestOpen{ "crypt_chest_open" };
+
+inline const EffectId kPlayerBloodSplat{ "player_blood_splat" };
+inline const EffectId kBubblingLava{ "bubbling_lava" };
+inline const EffectId kSpikeTrap{ "spike_trap" };
+inline const EffectId kBangingSmashingSounds{ "banging_smashing_sounds" };
+inline const EffectId kWitchScream{ "witch_scream" };
+inline const EffectId kLightningStrike{ "lightning_strike" };
+
+} // namespace ProceduralMaze::Audio::Effect
+
+#endif // SRC_AUDIO_EFFECTS_HPP_
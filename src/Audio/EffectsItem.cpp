@@ -1,37 +0,0 @@
-#include <Audio/EffectsItem.hpp>
-#include <spdlog/spdlog.h>
-namespace ProceduralMaze::Audio
-{
-
-EffectsData::EffectsData( const std::filesystem::path &filepath )
-    : buffer(
-          [&filepath]()
-          {
-            if ( not std::filesystem::exists( filepath ) )
-            {
-              SPDLOG_CRITICAL( "Sound effect file {} does not exist!", filepath.string() );
-              throw std::runtime_error( "Sound effect file not found: " + filepath.string() );
-            }
-            return std::make_unique<sf::SoundBuffer>( filepath );
-          }() ),
-      control( *buffer )
-{
-}
-
-EffectsData::EffectsData( EffectsData &&other ) noexcept
-    : buffer( std::move( other.buffer ) ),
-      control( *buffer )
-{
-}
-
-auto EffectsData::operator=( EffectsData &&other ) noexcept -> EffectsData &
-{
-  buffer = std::move( other.buffer );
-
-  // rebind control to the new buffer location
-  control.setBuffer( *buffer );
-  // return the derefenced buffer object
-  return *this;
-}
-
-} // namespace ProceduralMaze::Audio
\ No newline at end of file
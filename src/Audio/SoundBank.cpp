@@ -1,75 +1,104 @@
 
+#include <Audio/Effects.hpp>
 #include <Audio/SoundBank.hpp>
+#include <Utils/AssetLoader.hpp>
 #include <SFML/Audio/PlaybackDevice.hpp>
 #include <SFML/Audio/SoundChannel.hpp>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <future>
+
 namespace ProceduralMaze::Audio
 {
 
-SoundBank::SoundBank() { sounds.emplace( "fallback", EffectsData{ "res/audio/fallback.wav" } ); }
+SoundBank::SoundBank( bool headless )
+    : m_headless( headless )
+{
+  add_effect( Effect::kFallback, load_buffer( "res/audio/fallback.wav" ) );
+  if ( m_headless ) return;
 
-void SoundBank::init()
+  // every voice needs a buffer to be constructed, it is rebound on each play()
+  m_voices.reserve( kMaxVoices );
+  for ( std::size_t i = 0; i < kMaxVoices; ++i )
+    m_voices.emplace_back( get_buffer( Effect::kFallback ) );
+}
+
+void SoundBank::init( Utils::AssetLoader &loader )
 {
   SPDLOG_DEBUG( "Initializing SoundBank..." );
-  // Initialize sound effects
-  sounds.emplace( "wormhole_jump", EffectsData{ "res/audio/wormhole_jump.wav" } );
-  sounds.emplace( "shrine_lighting", EffectsData{ "res/audio/shrine_lighting.wav" } );
-
-  sounds.emplace( "secret", EffectsData{ "res/audio/secret.wav" } );
-  sounds.emplace( "drop_relic", EffectsData{ "res/audio/drop_relic.wav" } );
-  sounds.emplace( "spawn_ghost", EffectsData{ "res/audio/spawn_ghost.wav" } );
-  sounds.emplace( "spawn_skeleton", EffectsData{ "res/audio/spawn_skeleton.wav" } );
-  sounds.emplace( "damage_player", EffectsData{ "res/audio/damage_player.wav" } );
-
-  sounds.emplace( "footsteps", EffectsData{ "res/audio/footsteps.wav" } );
-  sounds.emplace( "bomb_fuse", EffectsData{ "res/audio/fuse.wav" } );
-  sounds.emplace( "bomb_detonate", EffectsData{ "res/audio/detonate.wav" } );
-  sounds.emplace( "drop_loot", EffectsData{ "res/audio/drop_loot.wav" } );
-  sounds.emplace( "get_loot", EffectsData{ "res/audio/get_loot.wav" } );
-  sounds.emplace( "get_key", EffectsData{ "res/audio/get_key.wav" } );
-  sounds.emplace( "break_pot", EffectsData{ "res/audio/break_pot.wav" } );
-  sounds.emplace( "hit_pot", EffectsData{ "res/audio/hit_pot.mp3" } );
-  sounds.emplace( "hit_grave", EffectsData{ "res/audio/hit_grave.mp3" } );
-  sounds.emplace( "digging_earth", EffectsData{ "res/audio/digging_earth.mp3" } );
-  sounds.emplace( "chopping", EffectsData{ "res/audio/chopping.mp3" } );
-  sounds.emplace( "chopping_final", EffectsData{ "res/audio/chopping_final.mp3" } );
-  sounds.emplace( "axe_whip", EffectsData{ "res/audio/axe_whip.wav" } );
-  sounds.emplace( "skele_death", EffectsData{ "res/audio/skele_death.wav" } );
-
-  sounds.emplace( "pickaxe1", EffectsData{ "res/audio/pickaxe1.wav" } );
-  sounds.emplace( "pickaxe2", EffectsData{ "res/audio/pickaxe2.wav" } );
-  sounds.emplace( "pickaxe3", EffectsData{ "res/audio/pickaxe3.wav" } );
-  sounds.emplace( "pickaxe4", EffectsData{ "res/audio/pickaxe4.wav" } );
-  sounds.emplace( "pickaxe5", EffectsData{ "res/audio/pickaxe5.wav" } );
-  sounds.emplace( "pickaxe6", EffectsData{ "res/audio/pickaxe6.wav" } );
-  sounds.emplace( "pickaxe_final", EffectsData{ "res/audio/pickaxe_final.wav" } );
-
-  sounds.emplace( "crypt_open", EffectsData{ "res/audio/crypt_open2.wav" } );
-  sounds.emplace( "crypt_locked", EffectsData{ "res/audio/crypt_locked.wav" } );
-  sounds.emplace( "crypt_room_shuffle", EffectsData{ "res/audio/crypt_room_shuffle.wav" } );
-  sounds.emplace( "crypt_lever_open", EffectsData{ "res/audio/crypt_lever_open.mp3" } );
-  sounds.emplace( "crypt_chest_open", EffectsData{ "res/audio/crypt_chest_open.mp3" } );
-
-  sounds.emplace( "player_blood_splat", EffectsData{ "res/audio/player_blood_splat.mp3" } );
-  sounds.emplace( "bubbling_lava", EffectsData{ "res/audio/underwater.wav" } );
-  sounds.emplace( "spike_trap", EffectsData{ "res/audio/spike_trap.wav" } );
-  sounds.emplace( "banging_smashing_sounds", EffectsData{ "res/audio/BangingSmashingSounds.mp3" } );
-  sounds.emplace( "witch_scream", EffectsData{ "res/audio/witch_scream.mp3" } );
-  sounds.emplace( "lightning_strike", EffectsData{ "res/audio/lightning_strike.mp3" } );
-
-  // Initialize music (can't use initializer list because sf::Music is move-only)
-  music.emplace( "title_music", MusicData{ "res/audio/EerieScifi.mp3" } );
-  music.emplace( "game_music", MusicData{ "res/audio/SadWindyOrgan.mp3" } );
-  music.emplace( "ruin_creaking_rope", MusicData{ "res/audio/rope.mp3" } );
-  music.emplace( "ruin_music", MusicData{ "res/audio/PhaseTones.mp3" } );
+  // Decode the sound effects on the loader workers
+  const std::vector<std::pair<EffectId, std::filesystem::path>> effect_files{
+      { Effect::kWormholeJump, "res/audio/wormhole_jump.wav" },
+      { Effect::kShrineLighting, "res/audio/shrine_lighting.wav" },
+
+      { Effect::kSecret, "res/audio/secret.wav" },
+      { Effect::kDropRelic, "res/audio/drop_relic.wav" },
+      { Effect::kSpawnGhost, "res/audio/spawn_ghost.wav" },
+      { Effect::kSpawnSkeleton, "res/audio/spawn_skeleton.wav" },
+      { Effect::kDamagePlayer, "res/audio/damage_player.wav" },
+
+      { Effect::kFootsteps, "res/audio/footsteps.wav" },
+      { Effect::kBombFuse, "res/audio/fuse.wav" },
+      { Effect::kBombDetonate, "res/audio/detonate.wav" },
+      { Effect::kDropLoot, "res/audio/drop_loot.wav" },
+      { Effect::kGetLoot, "res/audio/get_loot.wav" },
+      { Effect::kGetKey, "res/audio/get_key.wav" },
+      { Effect::kBreakPot, "res/audio/break_pot.wav" },
+      { Effect::kHitPot, "res/audio/hit_pot.mp3" },
+      { Effect::kHitGrave, "res/audio/hit_grave.mp3" },
+      { Effect::kDiggingEarth, "res/audio/digging_earth.mp3" },
+      { Effect::kChopping, "res/audio/chopping.mp3" },
+      { Effect::kChoppingFinal, "res/audio/chopping_final.mp3" },
+      { Effect::kAxeWhip, "res/audio/axe_whip.wav" },
+      { Effect::kSkeleDeath, "res/audio/skele_death.wav" },
+
+      { Effect::kPickaxe[0], "res/audio/pickaxe1.wav" },
+      { Effect::kPickaxe[1], "res/audio/pickaxe2.wav" },
+      { Effect::kPickaxe[2], "res/audio/pickaxe3.wav" },
+      { Effect::kPickaxe[3], "res/audio/pickaxe4.wav" },
+      { Effect::kPickaxe[4], "res/audio/pickaxe5.wav" },
+      { Effect::kPickaxe[5], "res/audio/pickaxe6.wav" },
+      { Effect::kPickaxeFinal, "res/audio/pickaxe_final.wav" },
+
+      { Effect::kCryptOpen, "res/audio/crypt_open2.wav" },
+      { Effect::kCryptLocked, "res/audio/crypt_locked.wav" },
+      { Effect::kCryptRoomShuffle, "res/audio/crypt_room_shuffle.wav" },
+      { Effect::kCryptLeverOpen, "res/audio/crypt_lever_open.mp3" },
+      { Effect::kCryptChestOpen, "res/audio/crypt_chest_open.mp3" },
+
+      { Effect::kPlayerBloodSplat, "res/audio/player_blood_splat.mp3" },
+      { Effect::kBubblingLava, "res/audio/underwater.wav" },
+      { Effect::kSpikeTrap, "res/audio/spike_trap.wav" },
+      { Effect::kBangingSmashingSounds, "res/audio/BangingSmashingSounds.mp3" },
+      { Effect::kWitchScream, "res/audio/witch_scream.mp3" },
+      { Effect::kLightningStrike, "res/audio/lightning_strike.mp3" },
+  };
+
+  std::vector<std::pair<EffectId, std::future<std::unique_ptr<sf::SoundBuffer>>>> buffers;
+  buffers.reserve( effect_files.size() );
+  for ( const auto &[effect, path] : effect_files )
+    buffers.emplace_back( effect, loader.submit( [path = path]() { return load_buffer( path ); } ) );
+
+  // Initialize music while the effects decode. Streams only read their header here, so they stay on this thread with the other
+  // audio objects (can't use initializer list because sf::Music is move-only)
+  if ( not m_headless )
+  {
+    music.emplace( "title_music", MusicData{ "res/audio/EerieScifi.mp3" } );
+    music.emplace( "game_music", MusicData{ "res/audio/SadWindyOrgan.mp3" } );
+    music.emplace( "ruin_creaking_rope", MusicData{ "res/audio/rope.mp3" } );
+    music.emplace( "ruin_music", MusicData{ "res/audio/PhaseTones.mp3" } );
+  }
+
+  for ( auto &[effect, buffer] : buffers )
+    add_effect( effect, buffer.get() );
 }
 
 void SoundBank::update_effects_volume( float volume )
 {
-  for ( auto &[name, sound_data] : sounds )
+  for ( auto &voice : m_voices )
   {
-    sound_data.control.setVolume( volume );
+    voice.sound.setVolume( volume );
   }
 }
 
@@ -81,11 +110,124 @@ void SoundBank::update_music_volume( float volume )
   }
 }
 
-sf::Sound &SoundBank::get_effect( const std::string &name )
+void SoundBank::play( EffectId effect, Priority priority )
+{
+  const auto &buffer = get_buffer( effect );
+  if ( m_headless ) return;
+
+  auto *voice = acquire_voice( priority );
+  if ( not voice )
+  {
+    SPDLOG_DEBUG( "No voice free for effect {}, dropped", effect.name() );
+    return;
+  }
+
+  voice->sound.stop();
+  voice->sound.setBuffer( buffer );
+  voice->effect = effect;
+  voice->priority = priority;
+  voice->started = ++m_play_counter;
+  voice->sound.play();
+}
+
+void SoundBank::play_once( EffectId effect, Priority priority )
+{
+  if ( is_playing( effect ) ) return;
+  play( effect, priority );
+}
+
+void SoundBank::restart( EffectId effect, Priority priority )
+{
+  // stopping frees the voice, so play() takes it straight back
+  stop( effect );
+  play( effect, priority );
+}
+
+void SoundBank::stop( EffectId effect )
+{
+  for ( auto &voice : m_voices )
+  {
+    if ( voice.effect == effect ) voice.sound.stop();
+  }
+}
+
+void SoundBank::pause( EffectId effect )
+{
+  for ( auto &voice : m_voices )
+  {
+    if ( voice.effect == effect && voice.sound.getStatus() == sf::Sound::Status::Playing ) voice.sound.pause();
+  }
+}
+
+void SoundBank::resume( EffectId effect )
+{
+  for ( auto &voice : m_voices )
+  {
+    if ( voice.effect == effect && voice.sound.getStatus() == sf::Sound::Status::Paused ) voice.sound.play();
+  }
+}
+
+bool SoundBank::is_playing( EffectId effect ) const
+{
+  return std::ranges::any_of( m_voices, [effect]( const Voice &voice )
+                              { return voice.effect == effect && voice.sound.getStatus() == sf::Sound::Status::Playing; } );
+}
+
+SoundBank::Voice *SoundBank::acquire_voice( Priority priority )
+{
+  Voice *victim = nullptr;
+  for ( auto &voice : m_voices )
+  {
+    if ( voice.sound.getStatus() == sf::Sound::Status::Stopped ) return &voice;
+    if ( voice.priority > priority ) continue;
+    if ( not victim || voice.priority < victim->priority || ( voice.priority == victim->priority && voice.started < victim->started ) )
+      victim = &voice;
+  }
+  return victim;
+}
+
+void SoundBank::add_effect( EffectId effect, std::unique_ptr<sf::SoundBuffer> buffer )
+{
+  if ( m_buffers.size() <= effect.id() ) m_buffers.resize( effect.id() + 1u );
+  m_buffers[effect.id()] = std::move( buffer );
+}
+
+const sf::SoundBuffer &SoundBank::get_buffer( EffectId effect ) const
+{
+  if ( effect.id() < m_buffers.size() && m_buffers[effect.id()] ) { return *m_buffers[effect.id()]; }
+  SPDLOG_CRITICAL( "Audio effect {} not found!", effect.name() );
+  throw std::runtime_error( "Audio effect not found: " + effect.name() );
+}
+
+std::unique_ptr<sf::SoundBuffer> SoundBank::load_buffer( const std::filesystem::path &filepath )
+{
+  if ( not std::filesystem::exists( filepath ) )
+  {
+    SPDLOG_CRITICAL( "Sound effect file {} does not exist!", filepath.string() );
+    throw std::runtime_error( "Sound effect file not found: " + filepath.string() );
+  }
+  return std::make_unique<sf::SoundBuffer>( filepath );
+}
+
+void SoundBank::play_music( const std::string &name, bool looping )
+{
+  if ( m_headless ) return;
+  auto &stream = get_music( name );
+  if ( stream.getStatus() == sf::Music::Status::Playing ) return;
+  stream.setLooping( looping );
+  stream.play();
+}
+
+void SoundBank::stop_music( const std::string &name )
+{
+  if ( m_headless ) return;
+  get_music( name ).stop();
+}
+
+void SoundBank::set_music_pan( const std::string &name, float pan )
 {
-  if ( sounds.find( name ) != sounds.end() ) { return sounds.at( name ).control; }
-  SPDLOG_CRITICAL( "Audio effect {} not found!", name );
-  throw std::runtime_error( "Audio effect not found: " + name );
+  if ( m_headless ) return;
+  get_music( name ).setPan( pan );
 }
 
 sf::Music &SoundBank::get_music( const std::string &name )
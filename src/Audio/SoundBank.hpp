@@ -1,30 +1,128 @@
 #ifndef __SYS__FXSYSTEM_HPP__
 #define __SYS__FXSYSTEM_HPP__
 
-#include <Audio/EffectsItem.hpp>
+#include <Audio/EffectId.hpp>
 #include <Audio/MusicItem.hpp>
+#include <SFML/Audio/Sound.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
 #include <unordered_map>
+#include <vector>
+
+namespace ProceduralMaze::Utils
+{
+class AssetLoader;
+}
 
 namespace ProceduralMaze::Audio
 {
 
+//! @brief Owns the decoded sound effects, the music streams and a fixed pool of voices that play the effects.
+//! Effects are addressed by a pre-resolved EffectId (see Audio/Effects.hpp). Each `play()` takes its own voice, so overlapping
+//! triggers of the same effect layer instead of restarting each other. When every voice is busy the lowest-priority, oldest
+//! voice is stolen; a request never steals from a voice with a higher priority than its own.
+//! A headless SoundBank still decodes the effects, so missing files are caught, but creates no voices and opens no music
+//! streams, so it never opens an audio device. Every playback call is then a no-op.
 class SoundBank
 {
 public:
-  SoundBank();
-  void init();
+  //! @brief Number of sf::Sound voices shared by every effect. Bounds the audio sources the effects can hold at once.
+  static constexpr std::size_t kMaxVoices = 32;
+
+  enum class Priority : uint8_t
+  {
+    LOW,    // cosmetic and frequent, e.g. footsteps
+    NORMAL, // most gameplay feedback
+    HIGH    // must be heard, e.g. player damage
+  };
+
+  explicit SoundBank( bool headless = false );
+  //! @brief Load the sound effects and open the music streams. The effects are decoded on the `loader` workers.
+  void init( Utils::AssetLoader &loader );
   void update_effects_volume( float volume );
   void update_music_volume( float volume );
-  sf::Sound &get_effect( const std::string &name );
-  sf::Music &get_music( const std::string &name );
+
+  //! @brief Play `effect` on a free voice, or steal one if the pool is full. The request is dropped (with a debug log) when every
+  //! voice is playing something of higher priority.
+  //! @throws std::runtime_error If `effect` was never loaded
+  void play( EffectId effect, Priority priority = Priority::NORMAL );
+
+  //! @brief As `play()`, unless `effect` is already playing. For looping/ambient effects where restarting would stutter.
+  void play_once( EffectId effect, Priority priority = Priority::NORMAL );
+
+  //! @brief Play `effect` from the start, on the voice it is already using if it is playing. For effects that many entities
+  //! can trigger at once but that should only be heard once, e.g. a wormhole jump shared by every actor.
+  void restart( EffectId effect, Priority priority = Priority::NORMAL );
+
+  //! @brief Stop every voice playing `effect`, and release them back to the pool
+  void stop( EffectId effect );
+
+  //! @brief Pause every voice that is playing `effect`
+  void pause( EffectId effect );
+
+  //! @brief Resume every voice that was paused while playing `effect`
+  void resume( EffectId effect );
+
+  //! @brief Is any voice currently playing `effect`?
+  bool is_playing( EffectId effect ) const;
+
+  //! @brief Start the music stream `name`, unless it is already playing
+  //! @throws std::runtime_error If `name` was never opened
+  void play_music( const std::string &name, bool looping = false );
+
+  //! @brief Stop the music stream `name`
+  //! @throws std::runtime_error If `name` was never opened
+  void stop_music( const std::string &name );
+
+  //! @brief Set the stereo pan of the music stream `name`, -1 (left) to 1 (right)
+  //! @throws std::runtime_error If `name` was never opened
+  void set_music_pan( const std::string &name, float pan );
 
 private:
+  struct Voice
+  {
+    explicit Voice( const sf::SoundBuffer &buffer )
+        : sound( buffer )
+    {
+    }
+
+    sf::Sound sound;
+    EffectId effect{};
+    Priority priority{ Priority::LOW };
+    //! @brief Value of `m_play_counter` when the voice was started; lower is older
+    uint64_t started{ 0 };
+  };
+
+  //! @brief Decode the sound file at `filepath`. Safe to call from any thread.
+  //! @throws std::runtime_error If the file does not exist
+  static std::unique_ptr<sf::SoundBuffer> load_buffer( const std::filesystem::path &filepath );
+
   static sf::SoundBuffer generate_tone( float frequency = 440.0f, float duration = 0.5f, unsigned int sample_rate = 44100 );
 
-  std::unordered_map<std::string, EffectsData> sounds;
+  //! @brief Store `buffer` under `effect`, growing the table if needed
+  void add_effect( EffectId effect, std::unique_ptr<sf::SoundBuffer> buffer );
+
+  const sf::SoundBuffer &get_buffer( EffectId effect ) const;
+
+  //! @brief A stopped voice, else the lowest-priority then oldest voice not above `priority`, else nullptr
+  Voice *acquire_voice( Priority priority );
+
+  sf::Music &get_music( const std::string &name );
+
+  //! @brief Decoded effects, indexed by EffectId::id(). Empty slots were never loaded.
+  std::vector<std::unique_ptr<sf::SoundBuffer>> m_buffers;
+
+  //! @brief Fixed after construction, so sf::Sound addresses stay stable
+  std::vector<Voice> m_voices;
+  uint64_t m_play_counter{ 0 };
+  bool m_headless{ false };
+
   std::unordered_map<std::string, MusicData> music;
 };
 
 } // namespace ProceduralMaze::Audio
 
-#endif // __SYS__FXSYSTEM_HPP__
\ No newline at end of file
+#endif // __SYS__FXSYSTEM_HPP__
@@ -2,7 +2,7 @@
 #define __COMPONENTS_ARMED_HPP__
 
 #include <SFML/Graphics/Color.hpp>
-#include <SFML/System/Clock.hpp>
+#include <Utils/GameClock.hpp>
 #include <SFML/System/Time.hpp>
 
 namespace ProceduralMaze::Cmp
@@ -33,9 +33,9 @@ public:
   int m_index;
 
   sf::Time getElapsedFuseTime() const { return m_fuse_delay_clock.getElapsedTime(); }
-  sf::Clock m_fuse_delay_clock;
+  Utils::GameClock m_fuse_delay_clock;
   sf::Time getElapsedWarningTime() const { return m_warning_delay_clock.getElapsedTime(); }
-  sf::Clock m_warning_delay_clock;
+  Utils::GameClock m_warning_delay_clock;
 
   EpiCenter m_epicenter = EpiCenter::NO;
 
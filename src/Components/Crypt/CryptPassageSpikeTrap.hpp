@@ -2,7 +2,7 @@
 #define SRC_COMPONENTS_CRYPTPASSAGESPIKETRAP_HPP
 
 #include <SFML/Graphics/Rect.hpp>
-#include <SFML/System/Clock.hpp>
+#include <Utils/GameClock.hpp>
 #include <SFML/System/Time.hpp>
 #include <SFML/System/Vector2.hpp>
 
@@ -26,7 +26,7 @@ public:
   };
 
   unsigned int m_passage_id = 0;
-  sf::Clock m_cooldown_timer;
+  Utils::GameClock m_cooldown_timer;
   sf::Time m_cooldown_threshold{ sf::seconds( 2 ) };
 };
 
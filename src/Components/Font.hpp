@@ -9,6 +9,8 @@ namespace ProceduralMaze::Cmp
 class Font : public sf::Font
 {
 public:
+  //! @brief An unopened font, for headless runs that never draw text
+  Font() = default;
   Font( std::string font_path );
 };
 
@@ -1,13 +1,13 @@
 #ifndef __CMP_FOOTSTEPTIMER_HPP__
 #define __CMP_FOOTSTEPTIMER_HPP__
 
-#include <SFML/System/Clock.hpp>
+#include <Utils/GameClock.hpp>
 
 namespace ProceduralMaze::Cmp {
 
 struct FootStepTimer
 {
-  sf::Clock m_clock;
+  Utils::GameClock m_clock;
 };
 
 } // namespace ProceduralMaze::Cmp
@@ -4,6 +4,7 @@
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/Vertex.hpp>
 #include <SFML/System/Time.hpp>
+#include <Utils/GameClock.hpp>
 namespace ProceduralMaze::Cmp
 {
 
@@ -29,7 +30,7 @@ struct LightningStrike
 
   sf::Color color;
   sf::Time duration{ sf::Time::Zero };
-  sf::Clock timer;
+  Utils::GameClock timer;
 };
 
 } // namespace ProceduralMaze::Cmp
@@ -1,12 +1,12 @@
 #ifndef SRC_COMPONENTS_SHOCKWAVETIMER_
 #define SRC_COMPONENTS_SHOCKWAVETIMER_
 
-#include <SFML/System/Clock.hpp>
+#include <Utils/GameClock.hpp>
 
 namespace ProceduralMaze::Cmp
 {
 
-struct NpcShockwaveTimer : sf::Clock
+struct NpcShockwaveTimer : Utils::GameClock
 {
 };
 
@@ -6,25 +6,19 @@
 namespace ProceduralMaze::Cmp::Particle
 {
 
-//! @brief Implementation detail — do not use externally
-namespace detail
-{
-void FlameParticle::emit()
-{
-  static std::random_device rd;
-  static std::mt19937 rng( rd() );
-
-  m_wave_time = 0.f;
+Flame::Flame( size_t count )
+    : ParticleSpriteBase( count ) {};
 
-  m_phase = m_phase_dist( rng );
-  m_frequency = m_freq_dist( rng );
+void Flame::emit( std::size_t idx )
+{
+  m_particles.wave_time[idx] = 0.f;
 
-  m_velocity = sf::Vector2f( 0.f, -m_speed_dist( rng ) );
-};
-} // namespace detail
+  m_particles.phase[idx] = m_phase_dist( rng() );
+  m_particles.frequency[idx] = m_freq_dist( rng() );
 
-Flame::Flame( size_t count )
-    : ParticleSpriteBase( count ) {};
+  m_particles.vel_x[idx] = 0.f;
+  m_particles.vel_y[idx] = -m_speed_dist( rng() );
+}
 
 void Flame::simulate( sf::Time dt )
 {
@@ -37,42 +31,46 @@ void Flame::simulate( sf::Time dt )
   constexpr float k_flame_phase = 0.6f;   // first 50% of lifetime = flame
   constexpr float k_smoke_density = 0.1f; // 10% of particles visible in smoke phase
 
-  static std::mt19937 rng( std::random_device{}() );
   static std::uniform_real_distribution<float> density_dist( 0.f, 1.f );
 
-  for ( auto &p : m_particles_list )
-  {
-    p.m_lifetime -= dt;
-    p.m_wave_time += dt.asSeconds();
-    if ( p.m_lifetime <= sf::Time::Zero ) p.do_emit();
+  const float seconds = dt.asSeconds();
+  const float inv_max_lifetime = 1.f / m_max_lifetime.asSeconds();
+
+  age( dt );
+  for ( auto &wave_time : m_particles.wave_time )
+    wave_time += seconds;
+  emit_expired();
 
-    const float ratio = p.m_lifetime.asSeconds() / m_max_lifetime.asSeconds();
+  for ( std::size_t idx = 0; idx < m_particles.size(); ++idx )
+  {
+    const float ratio = m_particles.lifetime[idx] * inv_max_lifetime;
 
-    const float wave_x = ( ratio > 0.8f ) ? amplitude * std::sin( ( 2.f * std::numbers::pi_v<float> * p.m_frequency * p.m_wave_time ) + p.m_phase )
+    const float wave_x = ( ratio > 0.8f ) ? amplitude * std::sin( ( 2.f * std::numbers::pi_v<float> * m_particles.frequency[idx] *
+                                                                    m_particles.wave_time[idx] ) +
+                                                                  m_particles.phase[idx] )
                                           : 0.f;
 
-    p.m_vertex.position += sf::Vector2f{ wave_x, p.m_velocity.y } * dt.asSeconds();
+    m_particles.pos_x[idx] += wave_x * seconds;
+    m_particles.pos_y[idx] += m_particles.vel_y[idx] * seconds;
 
+    auto &color = m_particles.color[idx];
     if ( ratio > k_flame_phase )
     {
       // flame phase — lerp white -> red, ratio 1.0 = white, k_flame_phase = red
       const float t = 1.f - ( ( ratio - k_flame_phase ) / ( 1.f - k_flame_phase ) );
-      p.m_vertex.color.r = static_cast<std::uint8_t>(
-          std::lerp( static_cast<float>( start_flame_color.r ), static_cast<float>( final_flame_color.r ), t ) );
-      p.m_vertex.color.g = static_cast<std::uint8_t>(
-          std::lerp( static_cast<float>( start_flame_color.g ), static_cast<float>( final_flame_color.g ), t ) );
-      p.m_vertex.color.b = static_cast<std::uint8_t>(
-          std::lerp( static_cast<float>( start_flame_color.b ), static_cast<float>( final_flame_color.b ), t ) );
-      p.m_vertex.color.a = static_cast<std::uint8_t>( ratio * 255 );
+      color.r = static_cast<std::uint8_t>( std::lerp( static_cast<float>( start_flame_color.r ), static_cast<float>( final_flame_color.r ), t ) );
+      color.g = static_cast<std::uint8_t>( std::lerp( static_cast<float>( start_flame_color.g ), static_cast<float>( final_flame_color.g ), t ) );
+      color.b = static_cast<std::uint8_t>( std::lerp( static_cast<float>( start_flame_color.b ), static_cast<float>( final_flame_color.b ), t ) );
+      color.a = static_cast<std::uint8_t>( ratio * 255 );
     }
     else
     {
       // smoke phase — grey, 10% density, fade out
-      const bool visible = density_dist( rng ) < k_smoke_density;
-      p.m_vertex.color = smoke_color;
-      p.m_vertex.color.a = visible ? static_cast<std::uint8_t>( ratio * 255 ) : 0;
+      const bool visible = density_dist( rng() ) < k_smoke_density;
+      color = smoke_color;
+      color.a = visible ? static_cast<std::uint8_t>( ratio * 255 ) : 0;
     }
   }
 }
 
-} // namespace ProceduralMaze::Cmp::Particle
\ No newline at end of file
+} // namespace ProceduralMaze::Cmp::Particle
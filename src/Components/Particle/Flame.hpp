@@ -6,30 +6,16 @@
 namespace ProceduralMaze::Cmp::Particle
 {
 
-//! @brief Implementation detail — do not use externally
-namespace detail
-{
-struct FlameParticle : public Cmp::Particle::ParticleBase
-{
-  // independent per particle
-  float m_wave_time{ 0.f };
-  float m_phase{ 0.f };
-  float m_frequency{ 0.5f };
-
-private:
-  void emit() override;
-};
-} // namespace detail
-
 //! @brief
-class Flame : public ParticleSpriteBase<detail::FlameParticle>
+class Flame : public ParticleSpriteBase
 {
 public:
   //! @brief Construct a new Particle Sprite Test object
   Flame( size_t count );
   void simulate( sf::Time dt ) override;
 
-  float m_wave_time{ 0.f }; // single shared wave time for all particles
+private:
+  void emit( std::size_t idx ) override;
 };
 
 } // namespace ProceduralMaze::Cmp::Particle
@@ -0,0 +1,180 @@
+#include <Particle/ParticleSpriteBase.hpp>
+#include <Utils/RngStreams.hpp>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <functional>
+
+namespace ProceduralMaze::Cmp::Particle
+{
+
+ParticleSpriteBase::ParticleSpriteBase( size_t count )
+    : m_max_particles( count )
+{
+  m_particles.reset( count );
+  SPDLOG_INFO( "Created {} particles in sprite", count );
+}
+
+void ParticleSpriteBase::set_view_transform( const sf::RenderWindow &window, const sf::View &world_view )
+{
+  // Same mapping as RenderTarget::mapCoordsToPixel, folded into one matrix: world -> NDC -> viewport pixels
+  const sf::FloatRect viewport( window.getViewport( world_view ) );
+  sf::Transform ndc_to_pixel;
+  ndc_to_pixel.translate( viewport.position + viewport.size / 2.f );
+  ndc_to_pixel.scale( { viewport.size.x / 2.f, -viewport.size.y / 2.f } );
+  m_world_to_screen = ndc_to_pixel * world_view.getTransform();
+}
+
+void ParticleSpriteBase::stop()
+{
+  SPDLOG_INFO( "ParticleSprite Stop Signal Received" );
+
+  // prevent emit_expired() reseting the particle lifetime
+  std::ranges::fill( m_particles.active, 0 );
+  SPDLOG_INFO( "Particles have been disabled" );
+}
+
+void ParticleSpriteBase::prune_inactive_expired_particles()
+{
+  // After simulate() the free-list only holds the parked (inactive) slots. Removing them from the highest index down means
+  // the particle swapped into each hole is never one that is still waiting to be removed.
+  auto &free_slots = m_particles.free_slots;
+  std::erase_if( free_slots, [this]( uint32_t idx ) { return m_particles.active[idx] or m_particles.lifetime[idx] > 0.f; } );
+  std::ranges::sort( free_slots, std::greater{} );
+  for ( auto idx : free_slots )
+    m_particles.swap_remove( idx );
+  free_slots.clear();
+
+  if ( m_particles.empty() )
+  {
+    SPDLOG_INFO( "Particles have been deleted" );
+    // prevent ParticleSystem from calling this->simulate()
+    m_sprite_active = false;
+    SPDLOG_INFO( "ParticleSprite has stopped" );
+  }
+}
+
+void ParticleSpriteBase::restart()
+{
+  if ( m_sprite_active ) return;
+
+  m_particles.reset( m_max_particles );
+  m_sprite_active = true;
+
+  SPDLOG_INFO( "Restarting ParticleSprite" );
+}
+
+void ParticleSpriteBase::check_particle_collision( const sf::FloatRect &target )
+{
+  for ( std::size_t idx = 0; idx < m_particles.size(); ++idx )
+  {
+    if ( not target.contains( { m_particles.pos_x[idx], m_particles.pos_y[idx] } ) ) continue;
+    m_particles.lifetime[idx] = 0.f;
+  }
+}
+
+void ParticleSpriteBase::deactivate_extinct_particles()
+{
+  if ( m_max_generations == 0 ) return;
+
+  const bool all_particles_last_generation = std::ranges::all_of( m_particles.generation,
+                                                                  [this]( uint32_t gen ) { return gen >= m_max_generations; } );
+  if ( all_particles_last_generation ) { stop(); }
+}
+
+void ParticleSpriteBase::draw( sf::RenderTarget &target, sf::RenderStates states ) const
+{
+  states.texture = nullptr;
+  states.blendMode = sf::BlendAlpha;
+
+  SPDLOG_DEBUG( "Drawing {} particles", m_particles.size() );
+
+  constexpr float kSize = 2.f;
+  const std::size_t count = m_particles.size();
+  m_vertices.resize( count * 6 );
+
+  for ( std::size_t idx = 0; idx < count; ++idx )
+  {
+    // map world -> screen
+    const auto pos = m_world_to_screen.transformPoint( { m_particles.pos_x[idx], m_particles.pos_y[idx] } );
+    const auto col = m_particles.color[idx];
+
+    sf::Vertex *quad = &m_vertices[idx * 6];
+    // triangle 1
+    quad[0] = { { pos.x - kSize, pos.y - kSize }, col };
+    quad[1] = { { pos.x + kSize, pos.y - kSize }, col };
+    quad[2] = { { pos.x + kSize, pos.y + kSize }, col };
+    // triangle 2
+    quad[3] = { { pos.x - kSize, pos.y - kSize }, col };
+    quad[4] = { { pos.x + kSize, pos.y + kSize }, col };
+    quad[5] = { { pos.x - kSize, pos.y + kSize }, col };
+  }
+
+  target.draw( m_vertices.data(), m_vertices.size(), sf::PrimitiveType::Triangles, states );
+}
+
+void ParticleSpriteBase::set_lifetime_ms( std::uniform_int_distribution<int> lifetime_dist )
+{
+  m_lifetime_dist = lifetime_dist;
+  m_max_lifetime = sf::milliseconds( lifetime_dist.max() );
+  m_lifetime = sf::milliseconds( m_lifetime_dist( rng() ) );
+}
+
+void ParticleSpriteBase::set_lifetime_ms( sf::Time lifetime )
+{
+  m_lifetime = lifetime;
+  m_max_lifetime = lifetime;
+  m_lifetime_dist = std::uniform_int_distribution<int>( lifetime.asMilliseconds(), lifetime.asMilliseconds() );
+}
+
+void ParticleSpriteBase::age( sf::Time dt )
+{
+  const float seconds = dt.asSeconds();
+  auto &lifetimes = m_particles.lifetime;
+  // This is still one pass over the whole pool per frame: the countdown has to visit every slot anyway, and the free-list
+  // is rebuilt from scratch alongside it. Only emit_expired() and prune_inactive_expired_particles() are proportional to
+  // the number of expired slots.
+  m_particles.free_slots.clear();
+  for ( std::size_t idx = 0; idx < lifetimes.size(); ++idx )
+  {
+    lifetimes[idx] -= seconds;
+    if ( lifetimes[idx] <= 0.f ) m_particles.free_slots.push_back( static_cast<uint32_t>( idx ) );
+  }
+}
+
+void ParticleSpriteBase::emit_expired()
+{
+  // recycle the active slots, keeping the inactive ones on the free-list
+  std::erase_if( m_particles.free_slots,
+                 [this]( uint32_t idx )
+                 {
+                   if ( not m_particles.active[idx] ) return false;
+
+                   m_particles.pos_x[idx] = m_emitter_position.x;
+                   m_particles.pos_y[idx] = m_emitter_position.y;
+                   m_particles.lifetime[idx] = static_cast<float>( m_lifetime_dist( rng() ) ) / 1000.f;
+                   emit( idx );
+                   m_particles.generation[idx]++;
+                   return true;
+                 } );
+}
+
+void ParticleSpriteBase::integrate( sf::Time dt )
+{
+  const float seconds = dt.asSeconds();
+  const std::size_t count = m_particles.size();
+  float *pos_x = m_particles.pos_x.data();
+  float *pos_y = m_particles.pos_y.data();
+  const float *vel_x = m_particles.vel_x.data();
+  const float *vel_y = m_particles.vel_y.data();
+  for ( std::size_t idx = 0; idx < count; ++idx )
+  {
+    pos_x[idx] += vel_x[idx] * seconds;
+    pos_y[idx] += vel_y[idx] * seconds;
+  }
+}
+
+std::mt19937 &ParticleSpriteBase::rng() { return Utils::Rnd::RngStreams::engine( Utils::Rnd::Stream::PARTICLES ); }
+
+} // namespace ProceduralMaze::Cmp::Particle
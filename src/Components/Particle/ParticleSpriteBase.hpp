@@ -1,107 +1,117 @@
 #ifndef SRC_SYSTEM_PARTICLESPRITEBASE_HPP_
 #define SRC_SYSTEM_PARTICLESPRITEBASE_HPP_
 
-#include <Particle/ParticleConcepts.hpp>
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/View.hpp>
 #include <SFML/System/Time.hpp>
 #include <SFML/System/Vector2.hpp>
+
+#include <cstdint>
 #include <random>
+#include <string>
+#include <vector>
 
 namespace ProceduralMaze::Cmp::Particle
 {
 
 // ============================================================
-// IParticle — individual particle contract
+// ParticlePool — structure-of-arrays particle storage
 // ============================================================
 
-//! @brief Interface that all particle types must implement
-class IParticle
+//! @brief Storage for the particles of one ParticleSprite, one contiguous array ("lane") per attribute.
+//! Particle `i` is element `i` of every lane, so the simulation passes are plain loops over floats that the compiler can vectorise.
+struct ParticlePool
 {
-public:
-  virtual ~IParticle() = default;
-
-  //! @brief API for emitting the particle. Should be called by `simulate()` function of derived class.
-  //! @param emitter
-  //! @param lifetime
-  //! @param props
-  virtual void do_emit() = 0;
-  virtual size_t generations() = 0;
-
-  virtual void set_speed_dist( std::uniform_real_distribution<float> speed_dist ) = 0;
-  virtual void set_angle_dist( std::uniform_real_distribution<float> angle_dist ) = 0;
-  virtual void set_phase_dist( std::uniform_real_distribution<float> phase_dist ) = 0;
-  virtual void set_freq_dist( std::uniform_real_distribution<float> freq_dist ) = 0;
-  virtual void set_lifetime_dist( std::uniform_int_distribution<int> lifetime_dist ) = 0;
-  virtual void set_emitter_position( sf::Vector2f emitter_position ) = 0;
+  std::vector<float> pos_x;
+  std::vector<float> pos_y;
+  std::vector<float> vel_x;
+  std::vector<float> vel_y;
 
-private:
-  // See ParticleBase for docstrings
-  virtual void emit() = 0;
-  virtual void idle() = 0;
-};
+  //! @brief Remaining lifetime in seconds. Expired when <= 0.
+  std::vector<float> lifetime;
 
-struct ParticleBase : public Cmp::Particle::IParticle
-{
-  void do_emit() final
-  {
-    if ( m_particle_active )
-    {
-      m_vertex.position = m_emitter_position;
-      static std::random_device rd;
-      static std::mt19937 rng( rd() );
-      m_lifetime = sf::milliseconds( m_lifetime_dist( rng ) );
-      emit();
-      m_generation++;
-    }
-    else { idle(); }
-  }
+  std::vector<sf::Color> color;
 
-  //! @brief Disables IParticle::emit if false
-  bool m_particle_active{ true };
-  void set_speed_dist( std::uniform_real_distribution<float> speed_dist ) override { m_speed_dist = speed_dist; }
-  void set_angle_dist( std::uniform_real_distribution<float> angle_dist ) override { m_angle_dist = angle_dist; }
-  void set_phase_dist( std::uniform_real_distribution<float> phase_dist ) override { m_phase_dist = phase_dist; }
-  void set_freq_dist( std::uniform_real_distribution<float> freq_dist ) override { m_freq_dist = freq_dist; }
-  void set_emitter_position( sf::Vector2f emitter_position ) override { m_emitter_position = emitter_position; }
-  void set_lifetime_dist( std::uniform_int_distribution<int> lifetime_dist ) override { m_lifetime_dist = lifetime_dist; }
+  //! @brief Per-particle wave parameters, used by wavering effects (Flame, Smoke)
+  std::vector<float> wave_time;
+  std::vector<float> phase;
+  std::vector<float> frequency;
 
-  sf::Vertex m_vertex;
-  sf::Vector2f m_velocity;
-  sf::Time m_lifetime;
-  sf::Vector2f m_emitter_position;
+  //! @brief Number of times each particle has been emitted
+  std::vector<uint32_t> generation;
 
-  size_t generations() override { return m_generation; }
-  size_t m_generation{ 0 };
+  //! @brief Cleared by ParticleSpriteBase::stop(): the particle is not re-emitted when it expires
+  std::vector<uint8_t> active;
 
-protected:
-  std::uniform_real_distribution<float> m_speed_dist;
-  std::uniform_real_distribution<float> m_angle_dist;
-  std::uniform_real_distribution<float> m_phase_dist;
-  std::uniform_real_distribution<float> m_freq_dist;
-  std::uniform_int_distribution<int> m_lifetime_dist;
+  //! @brief Free-list of expired slots, rebuilt from a full scan by ParticleSpriteBase::age() each frame. The emitter recycles
+  //! the active slots in place, the inactive ones are left here for ParticleSpriteBase::prune_inactive_expired_particles().
+  //! Not a lane.
+  std::vector<uint32_t> free_slots;
 
-private:
-  //! @brief Run when the particle is enabled and expired. Derived class of ParticleBase must implement it.
-  //! @param emitter
-  //! @param lifetime
-  void emit() override = 0;
-
-  //! @brief Run when the particle is disabled and expired
-  //! @param emitter
-  void idle() override {}
+  std::size_t size() const { return lifetime.size(); }
+  bool empty() const { return lifetime.empty(); }
+
+  //! @brief Replace the pool with `count` active, expired particles (they are emitted on the first simulate())
+  void reset( std::size_t count )
+  {
+    for_each_lane(
+        [count]( auto &lane )
+        {
+          lane.clear();
+          lane.resize( count );
+        } );
+    active.assign( count, 1 );
+    free_slots.clear();
+  }
+
+  //! @brief Remove particle `idx` by moving the last particle into its slot. O(1), but does not preserve the order.
+  void swap_remove( std::size_t idx )
+  {
+    for_each_lane(
+        [idx]( auto &lane )
+        {
+          lane[idx] = lane.back();
+          lane.pop_back();
+        } );
+  }
+
+  //! @brief Apply `fn` to every lane
+  template <typename Fn>
+  void for_each_lane( Fn &&fn )
+  {
+    fn( pos_x );
+    fn( pos_y );
+    fn( vel_x );
+    fn( vel_y );
+    fn( lifetime );
+    fn( color );
+    fn( wave_time );
+    fn( phase );
+    fn( frequency );
+    fn( generation );
+    fn( active );
+  }
 };
 
 // ============================================================
 // IParticleSprite — particle sprite container contract
 // ============================================================
 
-//! @brief Non-template abstract base — allows ParticleSpriteOwner and find() to work without knowing TParticle
+//! @brief Abstract base — allows ParticleSpriteOwner and find() to work without knowing the concrete effect
 class IParticleSprite : public sf::Drawable, public sf::Transformable
 {
 public:
   virtual ~IParticleSprite() = default;
 
   //! @brief  Implements the simulation stage of all particles.
-  //          E.g. modify the vertex and velocity members of each particle,
+  //          E.g. modify the position and velocity lanes of the ParticlePool,
   //          and reset the particle if its lifetime has expired
   //! @param dt
   virtual void simulate( sf::Time dt ) = 0;
@@ -137,11 +147,8 @@ public:
   virtual void set_lifetime_ms( std::uniform_int_distribution<int> life_dist ) = 0;
 };
 
-//! @brief Defines the particle sprite base class template. This renders a list of TParticle vertices.
-//! @tparam TParticle The particle object type.
-//! @note The derived class must implement the update function and
-//        provide its own IParticle implementation that satisfies ParticleConcept.
-template <ParticleConcept TParticle>
+//! @brief Defines the particle sprite base class. This owns the ParticlePool and renders it.
+//! @note The derived class must implement `simulate()` and the private `emit()` hook that initialises a (re-)emitted particle.
 class ParticleSpriteBase : public IParticleSprite
 {
 public:
@@ -149,89 +156,25 @@ public:
 
   //! @brief Construct a new Particle Sprite Base object
   //! @param count Number of particles in this sprite
-  //! @param lifetime The lifetime of the particles in this sprite
-  //! @param emitter_pos The initial position of the emitter for this sprite
-  explicit ParticleSpriteBase( size_t count )
-      : m_max_particles( count ),
-        m_particles_list( count )
-
-  {
-    SPDLOG_INFO( "Created {} particles in sprite", count );
-  }
+  explicit ParticleSpriteBase( size_t count );
 
-  ~ParticleSpriteBase() {}
-
-  //! @brief Replaces the default translation function with a world -> screen translation function
+  //! @brief Replaces the default (identity) translation with the world -> screen transform of `world_view` in `window`
   //! @param window
   //! @param world_view
-  void set_view_transform( const sf::RenderWindow &window, const sf::View &world_view ) override
-  {
-    m_world_to_screen = [&window, world_view]( sf::Vector2f world_pos ) -> sf::Vector2f
-    { return sf::Vector2f( window.mapCoordsToPixel( world_pos, world_view ) ); };
-  }
+  void set_view_transform( const sf::RenderWindow &window, const sf::View &world_view ) override;
 
   //! @brief Disables the particles for this ParticleSprite (they will continue simulating until their lifetimes expire)
-  void stop() override
-  {
-    SPDLOG_INFO( "ParticleSprite Stop Signal Received" );
-
-    for ( auto &p : m_particles_list )
-    {
-      // prevent emit() reseting the particle lifetime
-      p.m_particle_active = false;
-    }
-    SPDLOG_INFO( "Particles have been disabled" );
-  }
+  void stop() override;
 
   //! @brief Remove inactive and dead particles for this ParticleSprite
-  void prune_inactive_expired_particles() override
-  {
-    for ( auto &p : m_particles_list )
-    {
-      std::erase_if( m_particles_list, []( const TParticle &p ) { return p.m_particle_active == false and p.m_lifetime <= sf::Time::Zero; } );
-
-      if ( m_particles_list.empty() )
-      {
-        SPDLOG_INFO( "Particles have been deleted" );
-        // prevent ParticleSystem from calling this->simulate()
-        m_sprite_active = false;
-        SPDLOG_INFO( "ParticleSprite has stopped" );
-      }
-    }
-  }
+  void prune_inactive_expired_particles() override;
 
-  //! @brief Creates a new particle list, enables the particles, resets the generation counter and restarts the simulation.
-  void restart() override
-  {
-    if ( m_sprite_active ) return;
-
-    m_particles_list = std::vector<TParticle>( m_max_particles );
-    for ( auto &p : m_particles_list )
-    {
-      p.set_speed_dist( m_speed_dist );
-      p.set_angle_dist( m_angle_dist );
-      p.set_phase_dist( m_phase_dist );
-      p.set_freq_dist( m_freq_dist );
-      p.set_emitter_position( m_emitter_position );
-      p.set_lifetime_dist( m_lifetime_dist );
-      p.m_particle_active = true;
-    }
-    m_sprite_active = true;
-
-    SPDLOG_INFO( "Restarting ParticleSprite" );
-  }
+  //! @brief Creates a new particle pool, enables the particles, resets the generation counter and restarts the simulation.
+  void restart() override;
 
   //! @brief Check if the Particles from this ParticleSprite colide with the target
   //! @param target Rectangle collision area
-  void check_particle_collision( const sf::FloatRect &target ) override
-  {
-    //
-    for ( auto &p : m_particles_list )
-    {
-      if ( not target.contains( p.m_vertex.position ) ) continue;
-      p.m_lifetime = sf::Time::Zero;
-    }
-  }
+  void check_particle_collision( const sf::FloatRect &target ) override;
 
   //! @brief Is simulation running for this ParticleSprite?
   //! @return true
@@ -239,62 +182,13 @@ public:
   bool is_active() override { return m_sprite_active; }
 
   //! @brief Increase the generation count when the ParticleSprite lifetime has expired
-  void deactivate_extinct_particles() override
-  {
-    if ( m_max_generations == 0 ) return;
-
-    bool all_particles_last_generation = true;
-    for ( auto &p : m_particles_list )
-    {
-      if ( p.m_generation < m_max_generations ) { all_particles_last_generation = false; }
-    }
-
-    if ( all_particles_last_generation ) { stop(); }
-  }
+  void deactivate_extinct_particles() override;
 
   //! @brief Allows this sprite to be passed into RenderWindow.draw()
+  //! Streams the particle quads into a vertex array that is reused between frames.
   //! @param target
   //! @param states
-  void draw( sf::RenderTarget &target, sf::RenderStates states ) const override
-  {
-    states.texture = nullptr;
-    states.blendMode = sf::BlendAlpha;
-
-    // project out just the vertices for drawing
-    std::vector<sf::Vertex> verts;
-    verts.reserve( m_particles_list.size() );
-    SPDLOG_DEBUG( "Drawing {} particles", m_particles.size() );
-
-    constexpr float kSize = 2.f;
-    for ( const auto &p : m_particles_list )
-    {
-
-      // map world -> screen
-      const auto pos = m_world_to_screen( p.m_vertex.position );
-
-      const auto col = p.m_vertex.color;
-
-      // triangle 1
-      verts.push_back( { { pos.x - kSize, pos.y - kSize }, col } );
-      verts.push_back( { { pos.x + kSize, pos.y - kSize }, col } );
-      verts.push_back( { { pos.x + kSize, pos.y + kSize }, col } );
-      // triangle 2
-      verts.push_back( { { pos.x - kSize, pos.y - kSize }, col } );
-      verts.push_back( { { pos.x + kSize, pos.y + kSize }, col } );
-      verts.push_back( { { pos.x - kSize, pos.y + kSize }, col } );
-    }
-
-    target.draw( verts.data(), verts.size(), sf::PrimitiveType::Triangles, states );
-  }
-
-  //! @brief Max size of `m_particles_list`
-  size_t m_max_particles;
-
-  //! @brief The list of particles in this sprite
-  std::vector<TParticle> m_particles_list;
-
-  //! @brief The lifetime of the particles in this sprite
-  sf::Time m_lifetime{ sf::Time::Zero };
+  void draw( sf::RenderTarget &target, sf::RenderStates states ) const override;
 
   void set_tag( const std::string &tag ) override { m_tag = tag; }
   std::string get_tag() const override { return m_tag; }
@@ -302,133 +196,74 @@ public:
   void set_generations( size_t gen ) override { m_max_generations = gen; }
   size_t get_generations() override { return m_max_generations; }
 
-  void set_speed( std::uniform_real_distribution<float> speed_dist ) override
-  {
-    m_speed_dist = speed_dist;
-    for ( auto &p : m_particles_list )
-    {
-      p.set_speed_dist( m_speed_dist );
-    }
-  }
+  void set_speed( std::uniform_real_distribution<float> speed_dist ) override { m_speed_dist = speed_dist; }
+  void set_speed( float speed ) override { m_speed_dist = std::uniform_real_distribution<float>( speed, speed ); }
 
-  void set_speed( float speed ) override
-  {
-    m_speed_dist = std::uniform_real_distribution<float>( speed, speed );
-    for ( auto &p : m_particles_list )
-    {
-      p.set_speed_dist( m_speed_dist );
-    }
-  }
+  void set_angle( std::uniform_real_distribution<float> angle_dist ) override { m_angle_dist = angle_dist; }
+  void set_angle( float angle ) override { m_angle_dist = std::uniform_real_distribution<float>( angle, angle ); }
 
-  void set_angle( std::uniform_real_distribution<float> angle_dist ) override
-  {
-    m_angle_dist = angle_dist;
-    for ( auto &p : m_particles_list )
-    {
-      p.set_angle_dist( m_angle_dist );
-    }
-  }
+  void set_phase( std::uniform_real_distribution<float> phase_dist ) override { m_phase_dist = phase_dist; }
+  void set_phase( float phase ) override { m_phase_dist = std::uniform_real_distribution<float>( phase, phase ); }
 
-  void set_angle( float angle ) override
-  {
-    m_angle_dist = std::uniform_real_distribution<float>( angle, angle );
-    for ( auto &p : m_particles_list )
-    {
-      p.set_angle_dist( m_angle_dist );
-    }
-  }
+  void set_freq( std::uniform_real_distribution<float> freq_dist ) override { m_freq_dist = freq_dist; }
+  void set_freq( float freq ) override { m_freq_dist = std::uniform_real_distribution<float>( freq, freq ); }
 
-  void set_phase( std::uniform_real_distribution<float> phase_dist ) override
-  {
-    m_phase_dist = phase_dist;
-    for ( auto &p : m_particles_list )
-    {
-      p.set_phase_dist( m_phase_dist );
-    }
-  }
+  //! @brief
+  //! @param position
+  void set_emitter_position( sf::Vector2f emitter_position ) override { m_emitter_position = emitter_position; }
+  sf::Vector2f get_emitter_position() { return m_emitter_position; }
 
-  void set_phase( float phase ) override
-  {
-    m_phase_dist = std::uniform_real_distribution<float>( phase, phase );
-    for ( auto &p : m_particles_list )
-    {
-      p.set_phase_dist( m_phase_dist );
-    }
-  }
+  void set_lifetime_ms( std::uniform_int_distribution<int> lifetime_dist ) override;
+  void set_lifetime_ms( sf::Time lifetime ) override;
 
-  void set_freq( std::uniform_real_distribution<float> freq_dist ) override
-  {
-    m_freq_dist = freq_dist;
-    for ( auto &p : m_particles_list )
-    {
-      p.set_freq_dist( m_freq_dist );
-    }
-  }
+  //! @brief Max size of `m_particles`
+  size_t m_max_particles;
 
-  void set_freq( float freq ) override
-  {
-    m_freq_dist = std::uniform_real_distribution<float>( freq, freq );
-    for ( auto &p : m_particles_list )
-    {
-      p.set_freq_dist( m_freq_dist );
-    }
-  }
+  //! @brief The particles in this sprite
+  ParticlePool m_particles;
 
-  //! @brief
-  //! @param position
-  void set_emitter_position( sf::Vector2f emitter_position ) override
-  {
-    m_emitter_position = emitter_position;
-    for ( auto &p : m_particles_list )
-    {
-      p.set_emitter_position( emitter_position );
-    }
-  }
+  //! @brief The lifetime of the particles in this sprite
+  sf::Time m_lifetime{ sf::Time::Zero };
 
-  sf::Vector2f get_emitter_position() { return m_emitter_position; }
+protected:
+  //! @brief Simulation pass: count down every lifetime by `dt` and rebuild the free-list of expired slots. O(pool size).
+  void age( sf::Time dt );
 
-  void set_lifetime_ms( std::uniform_int_distribution<int> lifetime_dist ) override
-  {
-    m_lifetime_dist = lifetime_dist;
-    m_max_lifetime = sf::milliseconds( lifetime_dist.max() );
-    static std::random_device rd;
-    static std::mt19937 rng( rd() );
-    m_lifetime = sf::milliseconds( m_lifetime_dist( rng ) );
-    for ( auto &p : m_particles_list )
-    {
-      p.set_lifetime_dist( lifetime_dist );
-    }
-  }
-  void set_lifetime_ms( sf::Time lifetime ) override
-  {
-    m_lifetime = lifetime;
-    m_max_lifetime = lifetime;
-    m_lifetime_dist = std::uniform_int_distribution<int>( lifetime.asMilliseconds(), lifetime.asMilliseconds() );
-    for ( auto &p : m_particles_list )
-    {
-      p.set_lifetime_dist( m_lifetime_dist );
-    }
-  }
+  //! @brief Simulation pass: re-emit the active slots of the free-list from the emitter. Expired inactive slots are left for pruning.
+  void emit_expired();
 
-protected:
-  //! @brief Default translation function is a noop. See set_view_transform()
-  std::function<sf::Vector2f( sf::Vector2f )> m_world_to_screen = []( sf::Vector2f p ) { return p; };
+  //! @brief Simulation pass: move every particle along its velocity
+  void integrate( sf::Time dt );
+
+  //! @brief Shared generator for the emission distributions
+  static std::mt19937 &rng();
+
+  //! @brief World -> screen transform used by draw(). Identity by default, see set_view_transform()
+  sf::Transform m_world_to_screen{ sf::Transform::Identity };
 
   //! @brief Disables IParticleSprite::simulate() if false
   bool m_sprite_active{ true };
   sf::Time m_max_lifetime;
 
-private:
-  size_t m_max_generations{ 0 };
   std::uniform_real_distribution<float> m_speed_dist{ 0.f, 1.f };
   std::uniform_real_distribution<float> m_angle_dist{ 0.f, 360.f };
   std::uniform_real_distribution<float> m_phase_dist{ 0.f, 1.f };
   std::uniform_real_distribution<float> m_freq_dist{ 0.f, 1.f };
   std::uniform_int_distribution<int> m_lifetime_dist{ 0, 1 };
+
+private:
+  //! @brief Run when particle `idx` is (re-)emitted, after its position and lifetime have been reset.
+  //! Derived classes initialise the remaining lanes, e.g. the velocity.
+  virtual void emit( std::size_t idx ) = 0;
+
+  //! @brief Screen space quads for draw(), kept between frames to avoid reallocating
+  mutable std::vector<sf::Vertex> m_vertices;
+
+  size_t m_max_generations{ 0 };
   std::string m_tag;
   //! @brief The emitter position
   sf::Vector2f m_emitter_position{ 0, 0 };
 };
 } // namespace ProceduralMaze::Cmp::Particle
 
-#endif // SRC_SYSTEM_PARTICLESPRITEBASE_HPP_
\ No newline at end of file
+#endif // SRC_SYSTEM_PARTICLESPRITEBASE_HPP_
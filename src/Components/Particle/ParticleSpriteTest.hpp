@@ -8,25 +8,17 @@
 namespace ProceduralMaze::Cmp::Particle
 {
 
-//! @brief Implementation detail — do not use externally
-namespace detail
-{
-struct ParticleTest : public Cmp::Particle::ParticleBase
-{
-
-private:
-  void emit() override;
-};
-} // namespace detail
-
 //! @brief
-class ParticleSpriteTest : public ParticleSpriteBase<detail::ParticleTest>
+class ParticleSpriteTest : public ParticleSpriteBase
 {
 public:
   //! @brief Construct a new Particle Sprite Test object
   ParticleSpriteTest( size_t count );
 
   void simulate( sf::Time dt ) override;
+
+private:
+  void emit( std::size_t idx ) override;
 };
 
 } // namespace ProceduralMaze::Cmp::Particle
@@ -1,47 +1,30 @@
 #include <Particle/ShockWave.hpp>
 
-#include <random>
-
 namespace ProceduralMaze::Cmp::Particle
 {
 
-//! @brief Implementation detail — do not use externally
-namespace detail
-{
-void ShockWaveParticle::emit()
-{
-  // create random number generator
-  static std::random_device rd;
-  static std::mt19937 rng( rd() );
-
-  const sf::Angle angle = sf::degrees( m_angle_dist( rng ) );
-  const float speed = m_speed_dist( rng );
-  m_velocity = sf::Vector2f( speed, angle );
-};
-} // namespace detail
-
 ShockWave::ShockWave( size_t count )
     : ParticleSpriteBase( count ) {};
 
-void ShockWave::simulate( sf::Time dt )
+void ShockWave::emit( std::size_t idx )
 {
+  const sf::Angle angle = sf::degrees( m_angle_dist( rng() ) );
+  const float speed = m_speed_dist( rng() );
+  const sf::Vector2f velocity( speed, angle );
+  m_particles.vel_x[idx] = velocity.x;
+  m_particles.vel_y[idx] = velocity.y;
+}
 
-  for ( auto &p : m_particles_list )
-  {
-    // update the particle lifetime
-    p.m_lifetime -= dt;
-
-    // if the particle is dead, respawn it
-    if ( p.m_lifetime <= sf::Time::Zero ) { p.do_emit(); }
+void ShockWave::simulate( sf::Time dt )
+{
+  // update the particle lifetimes, respawning the dead particles
+  age( dt );
+  emit_expired();
 
-    // update the position of the corresponding vertex
-    p.m_vertex.position += p.m_velocity * dt.asSeconds();
+  // update the particle positions
+  integrate( dt );
 
-    p.m_vertex.color.a = 128;
-    p.m_vertex.color.r = 255;
-    p.m_vertex.color.g = 0;
-    p.m_vertex.color.b = 255;
-  }
+  std::ranges::fill( m_particles.color, sf::Color( 255, 0, 255, 128 ) );
 }
 
-} // namespace ProceduralMaze::Cmp::Particle
\ No newline at end of file
+} // namespace ProceduralMaze::Cmp::Particle
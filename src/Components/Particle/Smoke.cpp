@@ -7,25 +7,19 @@
 namespace ProceduralMaze::Cmp::Particle
 {
 
-//! @brief Implementation detail — do not use externally
-namespace detail
-{
-void SmokeParticle::emit()
-{
-  static std::random_device rd;
-  static std::mt19937 rng( rd() );
-
-  m_wave_time = 0.f;
+Smoke::Smoke( size_t count )
+    : ParticleSpriteBase( count ) {};
 
-  m_phase = m_phase_dist( rng );
-  m_frequency = m_freq_dist( rng );
+void Smoke::emit( std::size_t idx )
+{
+  m_particles.wave_time[idx] = 0.f;
 
-  m_velocity = sf::Vector2f( 0.f, -m_speed_dist( rng ) );
-};
-} // namespace detail
+  m_particles.phase[idx] = m_phase_dist( rng() );
+  m_particles.frequency[idx] = m_freq_dist( rng() );
 
-Smoke::Smoke( size_t count )
-    : ParticleSpriteBase( count ) {};
+  m_particles.vel_x[idx] = 0.f;
+  m_particles.vel_y[idx] = -m_speed_dist( rng() );
+}
 
 void Smoke::simulate( sf::Time dt )
 {
@@ -35,26 +29,32 @@ void Smoke::simulate( sf::Time dt )
   const sf::Color smoke_color{ 0, 0, 0 };
   constexpr float k_smoke_density = 0.5f; // 10% of particles visible in smoke phase
 
-  static std::mt19937 rng( std::random_device{}() );
   static std::uniform_real_distribution<float> density_dist( 0.f, 1.f );
 
-  for ( auto &p : m_particles_list )
+  const float seconds = dt.asSeconds();
+  const float inv_max_lifetime = 1.f / m_max_lifetime.asSeconds();
+
+  age( dt );
+  for ( auto &wave_time : m_particles.wave_time )
+    wave_time += seconds;
+  emit_expired();
+
+  for ( std::size_t idx = 0; idx < m_particles.size(); ++idx )
   {
-    // p.m_emitter.y -= m_rise_speed * dt.asSeconds(); // move emitter upward over time
-    p.m_lifetime -= dt;
-    p.m_wave_time += dt.asSeconds();
-    const float ratio = p.m_lifetime.asSeconds() / m_max_lifetime.asSeconds();
-    if ( p.m_lifetime <= sf::Time::Zero ) p.do_emit();
+    const float ratio = m_particles.lifetime[idx] * inv_max_lifetime;
 
-    const float wave_x = ( ratio > 0.8f ) ? amplitude * std::sin( ( 2.f * std::numbers::pi_v<float> * p.m_frequency * p.m_wave_time ) + p.m_phase )
+    const float wave_x = ( ratio > 0.8f ) ? amplitude * std::sin( ( 2.f * std::numbers::pi_v<float> * m_particles.frequency[idx] *
+                                                                    m_particles.wave_time[idx] ) +
+                                                                  m_particles.phase[idx] )
                                           : 0.f;
 
-    p.m_vertex.position += sf::Vector2f{ wave_x, p.m_velocity.y } * dt.asSeconds();
+    m_particles.pos_x[idx] += wave_x * seconds;
+    m_particles.pos_y[idx] += m_particles.vel_y[idx] * seconds;
 
-    const bool visible = density_dist( rng ) < k_smoke_density;
-    p.m_vertex.color = smoke_color;
-    p.m_vertex.color.a = visible ? static_cast<std::uint8_t>( ratio * 255 ) : 0;
+    const bool visible = density_dist( rng() ) < k_smoke_density;
+    m_particles.color[idx] = smoke_color;
+    m_particles.color[idx].a = visible ? static_cast<std::uint8_t>( ratio * 255 ) : 0;
   }
 }
 
-} // namespace ProceduralMaze::Cmp::Particle
\ No newline at end of file
+} // namespace ProceduralMaze::Cmp::Particle
@@ -6,32 +6,19 @@
 namespace ProceduralMaze::Cmp::Particle
 {
 
-//! @brief Implementation detail — do not use externally
-namespace detail
-{
-struct SmokeParticle : public Cmp::Particle::ParticleBase
-{
-  // independent per particle
-  float m_wave_time{ 0.f };
-  float m_phase{ 0.f };
-  float m_frequency{ 0.5f };
-
-private:
-  void emit() override;
-};
-} // namespace detail
-
 //! @brief
-class Smoke : public ParticleSpriteBase<detail::SmokeParticle>
+class Smoke : public ParticleSpriteBase
 {
 public:
   //! @brief Construct a new Particle Sprite Test object
   Smoke( size_t count );
   void simulate( sf::Time dt ) override;
 
-  float m_wave_time{ 0.f };   // single shared wave time for all particles
   float m_elapsed{ 0.f };     // tracks total time elapsed
   float m_rise_speed{ 20.f }; // pixels per second upward
+
+private:
+  void emit( std::size_t idx ) override;
 };
 
 } // namespace ProceduralMaze::Cmp::Particle
@@ -1,7 +1,7 @@
 #ifndef SRC_CMPS_PLAYER_PLAYERCHARACTER_HPP_
 #define SRC_CMPS_PLAYER_PLAYERCHARACTER_HPP_
 
-#include <SFML/System/Clock.hpp>
+#include <Utils/GameClock.hpp>
 
 namespace ProceduralMaze::Cmp
 {
@@ -14,9 +14,9 @@ public:
 
   bool underwater{ false };
 
-  sf::Clock m_damage_cooldown_timer;
+  Utils::GameClock m_damage_cooldown_timer;
 
-  // Custom copy constructor to handle sf::Clock
+  // Custom copy constructor to handle Utils::GameClock
   PlayerCharacter( const PlayerCharacter &other )
       : has_active_bomb( other.has_active_bomb ),
         underwater( other.underwater ),
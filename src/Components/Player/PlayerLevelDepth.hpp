@@ -2,6 +2,7 @@
 #define SRC_CMPS_PLAYER_PLAYERLEVELDEPTH_HPP_
 
 #include <SFML/System/Time.hpp>
+#include <Utils/GameClock.hpp>
 
 namespace ProceduralMaze::Cmp
 {
@@ -23,7 +24,7 @@ public:
   unsigned int get_count() const { return m_level; }
 
   sf::Time display_cooldown{ sf::seconds( 5 ) };
-  sf::Clock display_timer;
+  Utils::GameClock display_timer;
 
 private:
   unsigned int m_level;
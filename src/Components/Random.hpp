@@ -1,55 +1,30 @@
 #ifndef __COMPONENTS_RANDOM_HPP__
 #define __COMPONENTS_RANDOM_HPP__
 
+#include <Utils/RngStreams.hpp>
+
 #include <random>
+#include <stdexcept>
+#include <type_traits>
 
 namespace ProceduralMaze::Cmp
 {
 
-// Non-template base class holds shared static state
-// This allows all template instantiations to share a global seed (if set).
-class RandomBase
-{
-protected:
-  inline static unsigned long s_global_seed;
-  inline static bool s_global_seed_set;
-  inline static unsigned long s_instance_counter;
-
-public:
-  //! @brief Polymorphic destructor for derived classes
-  virtual ~RandomBase() = default;
-
-  static void setGlobalSeed( unsigned long seed )
-  {
-    s_global_seed = seed;
-    s_global_seed_set = true;
-    s_instance_counter = 0;
-  }
-
-  static void clearGlobalSeed()
-  {
-    s_global_seed_set = false;
-    s_instance_counter = 0;
-  }
-
-  static bool isGlobalSeedSet() { return s_global_seed_set; }
-};
-
+//! @brief A uniform distribution over [min, max] with its own engine.
+//! The engine is seeded from a Utils::Rnd::RngStreams stream, so every instance is reproducible under a fixed game seed.
 template <typename T>
-class Random : public RandomBase
+class Random
 {
 public:
   // set the rng range
-  Random( T min, T max )
-      : m_dist( min, max )
+  Random( T min, T max, Utils::Rnd::Stream stream = Utils::Rnd::Stream::GENERAL )
+      : m_randgen( Utils::Rnd::RngStreams::engine( stream )() ),
+        m_dist( min, max )
   {
     if constexpr ( not std::is_integral_v<T> )
     {
       if ( min >= max ) throw std::invalid_argument( "Random<float>: min must be strictly less than max" );
     }
-    // Use shared global seed if set
-    if ( s_global_seed_set ) { m_randgen.seed( s_global_seed + s_instance_counter++ ); }
-    // else: already initialized with random_device in member initializer
   }
 
   //! @brief Returns raw bits - Satisfies UniformRandomBitGenerator — enables use with std::shuffle etc.
@@ -65,7 +40,7 @@ public:
   void seed( unsigned long s ) { m_randgen = std::mt19937( s ); }
 
 private:
-  std::mt19937 m_randgen{ std::random_device{}() };
+  std::mt19937 m_randgen;
 
   // clang-format off
   typename std::conditional_t<std::is_integral_v<T>, 
@@ -51,7 +51,7 @@ struct SpriteAnimation
 
   AnimType m_anim_type;
 
-  float get_framerate() { return m_framerate; }
+  float get_framerate() const { return m_framerate; }
 
 private:
   float m_framerate;
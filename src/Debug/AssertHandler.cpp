@@ -131,6 +131,8 @@ void stack_trace( void )
 
   Debug::stack_trace();
 
+  // the logger may be asynchronous, so drain it before the process goes away
+  spdlog::shutdown();
   std::abort();
 }
 
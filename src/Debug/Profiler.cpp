@@ -0,0 +1,234 @@
+#include <Debug/Profiler.hpp>
+
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+
+namespace ProceduralMaze::Debug
+{
+
+namespace
+{
+
+//! @brief The zones recorded by one thread
+struct ThreadBuffer
+{
+  explicit ThreadBuffer( uint32_t thread_id )
+      : tid( thread_id )
+  {
+  }
+
+  std::mutex mutex;
+  std::vector<Profiler::Event> ring = std::vector<Profiler::Event>( Profiler::kEventsPerThread );
+  //! @brief Total zones ever pushed; the next slot is `head % kEventsPerThread`
+  std::size_t head{ 0 };
+  uint32_t tid;
+  //! @brief Nesting level of the next zone. Only touched by the owning thread.
+  uint16_t depth{ 0 };
+
+  void push( const Profiler::Event &event )
+  {
+    std::lock_guard lock( mutex );
+    ring[head % ring.size()] = event;
+    ++head;
+  }
+
+  //! @brief Copy out the buffered zones that started at or after `since_ns`, in the order they closed
+  void copy_since( int64_t since_ns, std::vector<Profiler::Event> &out )
+  {
+    std::lock_guard lock( mutex );
+    const std::size_t count = std::min( head, ring.size() );
+    for ( std::size_t i = head - count; i < head; ++i )
+    {
+      const auto &event = ring[i % ring.size()];
+      if ( event.start_ns >= since_ns ) out.push_back( event );
+    }
+  }
+};
+
+struct ProfilerState
+{
+  std::mutex mutex;
+  //! @brief Kept alive after their thread exits, so the trace dump still has the zones of finished workers
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+  uint32_t next_tid{ 0 };
+
+  // frame data, only touched by the frame thread
+  ThreadBuffer *frame_buffer{ nullptr };
+  int64_t frame_start_ns{ 0 };
+  int64_t last_frame_start_ns{ 0 };
+  int64_t last_frame_end_ns{ 0 };
+  std::vector<Profiler::Event> last_frame_events;
+  std::vector<Profiler::ZoneStats> last_frame;
+  std::vector<float> frame_history;
+};
+
+ProfilerState &state()
+{
+  static ProfilerState instance;
+  return instance;
+}
+
+ThreadBuffer &thread_buffer()
+{
+  thread_local std::shared_ptr<ThreadBuffer> buffer = []
+  {
+    auto &st = state();
+    std::lock_guard lock( st.mutex );
+    return st.buffers.emplace_back( std::make_shared<ThreadBuffer>( st.next_tid++ ) );
+  }();
+  return *buffer;
+}
+
+//! @brief Merge `events` (in start order) into a tree keyed on (parent, name) and flatten it depth-first
+std::vector<Profiler::ZoneStats> build_zone_tree( const std::vector<Profiler::Event> &events )
+{
+  struct Node
+  {
+    Profiler::ZoneStats stats;
+    std::vector<std::size_t> children;
+  };
+  // node 0 is the frame itself
+  std::vector<Node> nodes( 1 );
+  std::vector<std::pair<std::size_t, int64_t>> stack; // (node, end_ns) of the open zones
+
+  for ( const auto &event : events )
+  {
+    while ( not stack.empty() && stack.back().second <= event.start_ns )
+      stack.pop_back();
+    const std::size_t parent = stack.empty() ? 0 : stack.back().first;
+
+    auto &siblings = nodes[parent].children;
+    auto it = std::ranges::find_if( siblings, [&]( std::size_t idx ) { return nodes[idx].stats.name == event.name; } );
+    std::size_t idx = 0;
+    if ( it != siblings.end() ) { idx = *it; }
+    else
+    {
+      idx = nodes.size();
+      nodes[parent].children.push_back( idx );
+      nodes.push_back( Node{ Profiler::ZoneStats{ event.name, event.depth, 0, 0.0, 0.0 }, {} } );
+    }
+
+    const double ms = static_cast<double>( event.end_ns - event.start_ns ) / 1e6;
+    nodes[idx].stats.calls++;
+    nodes[idx].stats.total_ms += ms;
+    nodes[idx].stats.self_ms += ms;
+    if ( parent != 0 ) nodes[parent].stats.self_ms -= ms;
+    stack.emplace_back( idx, event.end_ns );
+  }
+
+  std::vector<Profiler::ZoneStats> flat;
+  flat.reserve( nodes.size() - 1 );
+  std::vector<std::size_t> pending( nodes[0].children.rbegin(), nodes[0].children.rend() );
+  while ( not pending.empty() )
+  {
+    const auto idx = pending.back();
+    pending.pop_back();
+    flat.push_back( nodes[idx].stats );
+    pending.insert( pending.end(), nodes[idx].children.rbegin(), nodes[idx].children.rend() );
+  }
+  return flat;
+}
+
+} // namespace
+
+Profiler::Zone::Zone( const char *name )
+    : m_name( name ),
+      m_start_ns( now_ns() ),
+      m_depth( thread_buffer().depth++ )
+{
+}
+
+Profiler::Zone::~Zone()
+{
+  auto &buffer = thread_buffer();
+  buffer.depth--;
+  buffer.push( Event{ m_name, m_start_ns, now_ns(), m_depth } );
+}
+
+int64_t Profiler::now_ns()
+{
+  static const auto kEpoch = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - kEpoch ).count();
+}
+
+void Profiler::begin_frame()
+{
+  auto &st = state();
+  st.frame_buffer = &thread_buffer();
+  st.frame_start_ns = now_ns();
+}
+
+void Profiler::end_frame()
+{
+  auto &st = state();
+  if ( not st.frame_buffer ) return;
+  const auto frame_end_ns = now_ns();
+
+  st.last_frame_events.clear();
+  st.frame_buffer->copy_since( st.frame_start_ns, st.last_frame_events );
+  // zones are pushed as they close (children first), the tree wants them as they opened
+  std::ranges::sort( st.last_frame_events, []( const Event &lhs, const Event &rhs )
+                     { return lhs.start_ns != rhs.start_ns ? lhs.start_ns < rhs.start_ns : lhs.depth < rhs.depth; } );
+  st.last_frame = build_zone_tree( st.last_frame_events );
+  st.last_frame_start_ns = st.frame_start_ns;
+  st.last_frame_end_ns = frame_end_ns;
+
+  if ( st.frame_history.size() == kFrameHistory ) st.frame_history.erase( st.frame_history.begin() );
+  st.frame_history.push_back( static_cast<float>( frame_end_ns - st.frame_start_ns ) / 1e6f );
+}
+
+const std::vector<Profiler::ZoneStats> &Profiler::last_frame() { return state().last_frame; }
+
+const std::vector<Profiler::Event> &Profiler::last_frame_events() { return state().last_frame_events; }
+
+int64_t Profiler::last_frame_start_ns() { return state().last_frame_start_ns; }
+
+int64_t Profiler::last_frame_end_ns() { return state().last_frame_end_ns; }
+
+const std::vector<float> &Profiler::frame_history() { return state().frame_history; }
+
+bool Profiler::dump_chrome_trace( const std::filesystem::path &path )
+{
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+  {
+    auto &st = state();
+    std::lock_guard lock( st.mutex );
+    buffers = st.buffers;
+  }
+
+  nlohmann::json trace_events = nlohmann::json::array();
+  std::vector<Event> events;
+  for ( const auto &buffer : buffers )
+  {
+    events.clear();
+    buffer->copy_since( 0, events );
+    for ( const auto &event : events )
+    {
+      // Chrome trace timestamps are in microseconds
+      trace_events.push_back( { { "name", event.name },
+                                { "ph", "X" },
+                                { "ts", static_cast<double>( event.start_ns ) / 1e3 },
+                                { "dur", static_cast<double>( event.end_ns - event.start_ns ) / 1e3 },
+                                { "pid", 1 },
+                                { "tid", buffer->tid } } );
+    }
+  }
+
+  std::ofstream file( path );
+  if ( not file )
+  {
+    SPDLOG_ERROR( "Unable to write profiler trace to {}", path.string() );
+    return false;
+  }
+  file << nlohmann::json{ { "traceEvents", std::move( trace_events ) }, { "displayTimeUnit", "ms" } }.dump();
+  SPDLOG_INFO( "Wrote profiler trace to {}", path.string() );
+  return true;
+}
+
+} // namespace ProceduralMaze::Debug
@@ -0,0 +1,117 @@
+#ifndef SRC_DEBUG_PROFILER_HPP_
+#define SRC_DEBUG_PROFILER_HPP_
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace ProceduralMaze::Debug
+{
+
+//! @brief A scoped-zone frame profiler.
+//! Each thread records finished zones into its own fixed-size ring buffer, so recording never allocates and threads only
+//! contend on their own (uncontended) buffer lock. The main loop brackets every frame with `begin_frame()`/`end_frame()`,
+//! which turns the main thread's zones into a per-zone timing tree for the debug overlay. `dump_chrome_trace()` writes every
+//! buffered zone, from every thread, as Chrome trace JSON (open with chrome://tracing or https://ui.perfetto.dev).
+//!
+//! Zones are placed with PROFILE_ZONE, which compiles to nothing unless the build defines PROCEDURALMAZE_PROFILER
+//! (cmake -DPROCEDURALMAZE_PROFILER=ON).
+//!
+//! @example
+//! void NpcSystem::update( sf::Time dt )
+//! {
+//!   PROFILE_ZONE( "NpcSystem::update" );
+//!   ...
+//! }
+class Profiler
+{
+public:
+  //! @brief Zones kept per thread; older zones are overwritten
+  static constexpr std::size_t kEventsPerThread = 16384;
+  //! @brief Frame times kept for the overlay graph
+  static constexpr std::size_t kFrameHistory = 240;
+
+  //! @brief A finished zone. `name` must be a string literal (or otherwise outlive the profiler).
+  struct Event
+  {
+    const char *name{ nullptr };
+    int64_t start_ns{ 0 };
+    int64_t end_ns{ 0 };
+    uint16_t depth{ 0 };
+  };
+
+  //! @brief Accumulated time of one node in the zone tree of the last frame
+  struct ZoneStats
+  {
+    const char *name{ nullptr };
+    uint16_t depth{ 0 };
+    uint32_t calls{ 0 };
+    double total_ms{ 0.0 };
+    //! @brief `total_ms` minus the time spent in child zones
+    double self_ms{ 0.0 };
+  };
+
+  //! @brief RAII marker, see PROFILE_ZONE
+  class Zone
+  {
+  public:
+    explicit Zone( const char *name );
+    ~Zone();
+
+    Zone( const Zone & ) = delete;
+    Zone &operator=( const Zone & ) = delete;
+
+  private:
+    const char *m_name;
+    int64_t m_start_ns;
+    uint16_t m_depth;
+  };
+
+  //! @brief Start a frame. The calling thread is the one whose zones are shown in the overlay.
+  static void begin_frame();
+
+  //! @brief Close the frame and rebuild `last_frame()` from the zones recorded since `begin_frame()`
+  static void end_frame();
+
+  //! @brief The zone tree of the last complete frame, flattened depth-first
+  static const std::vector<ZoneStats> &last_frame();
+
+  //! @brief The main-thread zones of the last complete frame, in start order
+  static const std::vector<Event> &last_frame_events();
+
+  //! @brief Start and end of the last complete frame, on the same clock as the events
+  static int64_t last_frame_start_ns();
+  static int64_t last_frame_end_ns();
+
+  //! @brief Durations of the most recent frames in milliseconds, oldest first
+  static const std::vector<float> &frame_history();
+
+  //! @brief Write every buffered zone of every thread as Chrome trace JSON
+  //! @return false if the file could not be written
+  static bool dump_chrome_trace( const std::filesystem::path &path );
+
+  //! @brief Is PROFILE_ZONE compiled in?
+  static constexpr bool enabled()
+  {
+#ifdef PROCEDURALMAZE_PROFILER
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  //! @brief Nanoseconds since the profiler clock started
+  static int64_t now_ns();
+};
+
+} // namespace ProceduralMaze::Debug
+
+#ifdef PROCEDURALMAZE_PROFILER
+#define PROFILE_ZONE_CONCAT_( a, b ) a##b
+#define PROFILE_ZONE_CONCAT( a, b ) PROFILE_ZONE_CONCAT_( a, b )
+#define PROFILE_ZONE( name ) const ::ProceduralMaze::Debug::Profiler::Zone PROFILE_ZONE_CONCAT( profile_zone_, __LINE__ )( name )
+#else
+#define PROFILE_ZONE( name ) static_cast<void>( 0 )
+#endif
+
+#endif // SRC_DEBUG_PROFILER_HPP_
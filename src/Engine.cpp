@@ -3,6 +3,7 @@
 #include <Components/Persistent/EffectsVolume.hpp>
 #include <Components/Persistent/MusicVolume.hpp>
 #include <Components/Player/PlayerMortality.hpp>
+#include <Debug/Profiler.hpp>
 #include <Engine.hpp>
 #include <Events/PauseClocksEvent.hpp>
 #include <Events/ResumeClocksEvent.hpp>
@@ -13,19 +14,80 @@
 #include <SceneControl/Scenes/GraveyardScene.hpp>
 #include <SceneControl/Scenes/TitleScene.hpp>
 #include <Systems/BaseSystem.hpp>
+#include <Systems/Render/RenderSystem.hpp>
 #include <Systems/SystemStore.hpp>
 #include <Systems/Threats/HazardFieldSystem.hpp>
 #include <Systems/Threats/HazardFieldSystemImpl.hpp>
+#include <Utils/AssetLoader.hpp>
+#include <Utils/GameClock.hpp>
 #include <imgui-SFML.h>
 
+#include <algorithm>
+#include <charconv>
 #include <memory>
+#include <ranges>
 #include <stacktrace>
+#include <unordered_map>
 
 namespace ProceduralMaze
 {
 
-Engine::Engine()
+std::optional<HeadlessOptions::Scenario> HeadlessOptions::parse_scenario( std::string_view spec )
 {
+  using Type = Events::SceneManagerEvent::Type;
+  static const std::unordered_map<std::string_view, Type> kEventNames = {
+      { "EXIT_GAME", Type::EXIT_GAME },
+      { "SETTINGS_MENU", Type::SETTINGS_MENU },
+      { "EXIT_SETTINGS_MENU", Type::EXIT_SETTINGS_MENU },
+      { "START_GAME", Type::START_GAME },
+      { "QUIT_GAME", Type::QUIT_GAME },
+      { "PAUSE_GAME", Type::PAUSE_GAME },
+      { "RESUME_GAME", Type::RESUME_GAME },
+      { "GAME_OVER", Type::GAME_OVER },
+      { "LEVEL_COMPLETE", Type::LEVEL_COMPLETE },
+      { "ENTER_CRYPT", Type::ENTER_CRYPT },
+      { "EXIT_CRYPT", Type::EXIT_CRYPT },
+      { "ENTER_HOLYWELL", Type::ENTER_HOLYWELL },
+      { "EXIT_HOLYWELL", Type::EXIT_HOLYWELL },
+      { "ENTER_RUIN_LOWER", Type::ENTER_RUIN_LOWER },
+      { "ENTER_RUIN_UPPER", Type::ENTER_RUIN_UPPER },
+      { "EXIT_RUIN_UPPER", Type::EXIT_RUIN_UPPER },
+      { "EXIT_RUIN", Type::EXIT_RUIN },
+      { "ENTER_SHOP", Type::ENTER_SHOP },
+      { "EXIT_SHOP", Type::EXIT_SHOP },
+      { "RETURN_TO_TITLE", Type::RETURN_TO_TITLE },
+  };
+
+  Scenario scenario;
+  for ( const auto step : std::views::split( spec, ',' ) )
+  {
+    const std::string_view step_sv( step.begin(), step.end() );
+    const auto colon = step_sv.find( ':' );
+    if ( colon == std::string_view::npos ) return std::nullopt;
+
+    unsigned int frame = 0;
+    const auto frame_sv = step_sv.substr( 0, colon );
+    const auto [ptr, ec] = std::from_chars( frame_sv.data(), frame_sv.data() + frame_sv.size(), frame );
+    if ( ec != std::errc{} || ptr != frame_sv.data() + frame_sv.size() ) return std::nullopt;
+
+    const auto event = kEventNames.find( step_sv.substr( colon + 1 ) );
+    if ( event == kEventNames.end() ) return std::nullopt;
+    scenario.emplace_back( frame, event->second );
+  }
+  std::ranges::stable_sort( scenario, {}, &Scenario::value_type::first );
+  return scenario;
+}
+
+Engine::Engine( std::optional<HeadlessOptions> headless )
+    : m_headless( std::move( headless ) )
+{
+  if ( m_headless )
+  {
+    // nothing is drawn or heard, the systems only need the (closed) window for its size and event queue
+    Sys::RenderSystem::set_headless( true );
+    SPDLOG_INFO( "Headless run: {} frames at {} ms", m_headless->frames, m_headless->timestep.asMilliseconds() );
+    return;
+  }
 
   if ( !m_window->isOpen() )
   {
@@ -61,9 +123,11 @@ Engine::Engine()
 
 bool Engine::run()
 {
+  if ( m_headless ) return run_headless( *m_headless );
+
   try
   {
-    loading_screen( [this]() { this->init_systems(); }, m_splash_texture );
+    loading_screen( [this]() { this->init_systems(); } );
 
     auto title_scene = std::make_unique<Scene::TitleScene>( *m_sound_bank, *m_system_store, m_nav_event_dispatcher );
     m_scene_manager->push( std::move( title_scene ) );
@@ -74,23 +138,29 @@ bool Engine::run()
     while ( m_window->isOpen() )
     {
       sf::Time dt = tick.restart();
+      Utils::GameClock::advance( dt );
+      Debug::Profiler::begin_frame();
+      {
+        PROFILE_ZONE( "Engine::run" );
 
-      // call the scene at the top of the scene manager stack
-      m_scene_manager->update( dt );
+        // call the scene at the top of the scene manager stack
+        m_scene_manager->update( dt );
 
-      // trigger any enqueued events now we are outside of the scene update function.
-      Sys::BaseSystem::get_systems_event_queue().update();
+        // trigger any enqueued events now we are outside of the scene update function.
+        Sys::BaseSystem::get_systems_event_queue().update();
 
-      // catch the resize events
-      while ( const std::optional event = m_window->pollEvent() )
-      {
-        if ( const auto *resized = event->getIf<sf::Event::Resized>() )
+        // catch the resize events
+        while ( const std::optional event = m_window->pollEvent() )
         {
-          // update the view to the new size of the window
-          sf::FloatRect visibleArea( { 0.f, 0.f }, sf::Vector2f( resized->size ) );
-          m_window->setView( sf::View( visibleArea ) );
+          if ( const auto *resized = event->getIf<sf::Event::Resized>() )
+          {
+            // update the view to the new size of the window
+            sf::FloatRect visibleArea( { 0.f, 0.f }, sf::Vector2f( resized->size ) );
+            m_window->setView( sf::View( visibleArea ) );
+          }
         }
       }
+      Debug::Profiler::end_frame();
     } /// MAIN LOOP ENDS
 
   } catch ( const std::exception &e )
@@ -107,11 +177,63 @@ bool Engine::run()
   return true; // exit game
 }
 
+bool Engine::run_headless( const HeadlessOptions &options )
+{
+  try
+  {
+    init_systems();
+
+    auto title_scene = std::make_unique<Scene::TitleScene>( *m_sound_bank, *m_system_store, m_nav_event_dispatcher );
+    m_scene_manager->push( std::move( title_scene ) );
+
+    auto next_step = options.scenario.begin();
+    sf::Clock wall_clock;
+
+    unsigned int frame = 0;
+    for ( ; frame < options.frames && not m_scene_manager->exit_requested(); ++frame )
+    {
+      // raised before the update, so the scene manager handles them at the end of this frame
+      for ( ; next_step != options.scenario.end() && next_step->first <= frame; ++next_step )
+      {
+        m_scenemanager_event_queue.enqueue( Events::SceneManagerEvent( next_step->second ) );
+      }
+
+      Debug::Profiler::begin_frame();
+      {
+        PROFILE_ZONE( "Engine::run_headless" );
+        Utils::GameClock::advance( options.timestep );
+        m_scene_manager->update( options.timestep );
+        Sys::BaseSystem::get_systems_event_queue().update();
+      }
+      Debug::Profiler::end_frame();
+    }
+
+    const auto elapsed = wall_clock.getElapsedTime();
+    if ( frame < options.frames ) { SPDLOG_INFO( "Headless run ended by EXIT_GAME after {} of {} frames", frame, options.frames ); }
+    SPDLOG_INFO( "Headless run complete: {} frames in {:.2f} s ({:.3f} ms/frame)", frame, elapsed.asSeconds(),
+                 frame ? elapsed.asSeconds() * 1000.f / static_cast<float>( frame ) : 0.f );
+
+  } catch ( const std::exception &e )
+  {
+    SPDLOG_CRITICAL( "Unhandled exception in Engine::run_headless(): {}", e.what() );
+    return false;
+  } catch ( ... )
+  {
+    SPDLOG_CRITICAL( "Unhandled unknown exception in Engine::run_headless()" );
+    return false;
+  }
+  return true;
+}
+
 void Engine::init_systems()
 {
-  m_sprite_factory = std::make_unique<Sprites::SpriteFactory>();
-  m_sprite_factory->init();
-  m_sound_bank->init();
+  {
+    // decode the sprite and sound assets in parallel, the loading screen shows the progress
+    Utils::AssetLoader loader;
+    m_sprite_factory = std::make_unique<Sprites::SpriteFactory>( m_headless.has_value() );
+    m_sprite_factory->init( loader );
+    m_sound_bank->init( loader );
+  }
   m_system_store = std::make_unique<Sys::Store>( *m_window, *m_sprite_factory, *m_sound_bank, m_nav_event_dispatcher, m_scenemanager_event_queue );
   m_scene_manager = std::make_unique<Scene::SceneManager>( *m_window, *m_sound_bank, *m_system_store, m_nav_event_dispatcher,
                                                            m_scenemanager_event_queue, *m_sprite_factory );
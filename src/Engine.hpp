@@ -13,21 +13,46 @@
 
 #include <Audio/SoundBank.hpp>
 #include <Components/Font.hpp>
+#include <SceneControl/Events/SceneManagerEvent.hpp>
 #include <SceneControl/SceneManager.hpp>
 #include <Sprites/SpriteFactory.hpp>
 #include <Systems/SystemStore.hpp>
+#include <Utils/AssetLoader.hpp>
 
 #include <future>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 namespace ProceduralMaze
 {
 
+//! @brief Settings for a headless run: the scenes and systems are updated with a fixed timestep, nothing is drawn or played,
+//! and the run ends after `frames` frames or when the scenario raises EXIT_GAME. Useful for soak tests, profiling and reproducing bugs from a script.
+struct HeadlessOptions
+{
+  //! @brief Scene manager events to raise, as (frame, event) pairs
+  using Scenario = std::vector<std::pair<unsigned int, Events::SceneManagerEvent::Type>>;
+
+  unsigned int frames{ 3600 };
+  sf::Time timestep{ sf::seconds( 1.f / 60.f ) };
+  //! @brief The run starts on the title scene, so a scenario usually begins with START_GAME at frame 0
+  Scenario scenario{ { 0, Events::SceneManagerEvent::Type::START_GAME } };
+
+  //! @brief Parse a scenario such as "0:START_GAME,600:ENTER_CRYPT,1200:EXIT_CRYPT"
+  //! @return std::nullopt if any step is malformed or names an unknown event
+  static std::optional<Scenario> parse_scenario( std::string_view spec );
+};
+
 class Engine
 {
 public:
-  explicit Engine();
+  //! @brief Open the game window, or with `headless` set run without a window, see HeadlessOptions.
+  //! Headless runs create no textures, fonts, shaders or audio devices, so they need no OpenGL context or sound card.
+  explicit Engine( std::optional<HeadlessOptions> headless = std::nullopt );
 
   Engine( const Engine & ) = delete;
   Engine &operator=( const Engine & ) = delete;
@@ -38,6 +63,9 @@ public:
   bool run();
 
 private:
+  // fixed timestep loop without window, rendering or sound
+  bool run_headless( const HeadlessOptions &options );
+
   // initialize all ECS systems
   void init_systems();
 
@@ -46,7 +74,7 @@ private:
 
   // display a loading screen while executing the provided callable
   template <typename Callable>
-  void loading_screen( Callable &&callable, [[maybe_unused]] const sf::Texture &loading_texture )
+  void loading_screen( Callable &&callable )
   {
     Cmp::Font font( "res/fonts/tuffy.ttf" );
     sf::Text loading_text( font, "Loading", 48 );
@@ -79,11 +107,15 @@ private:
       if ( clock.getElapsedTime().asSeconds() >= text_update_interval )
       {
         dot_count = ( dot_count + 1 ) % 4; // Cycle 0 -> 1 -> 2 -> 3 -> 0
-        std::string dots( dot_count, '.' );
-        loading_text.setString( "Loading" + dots );
         clock.restart();
       }
 
+      // Add the asset loader progress, if assets are loading
+      std::string dots( dot_count, '.' );
+      const auto progress = Utils::AssetLoader::progress();
+      if ( progress.total == 0 ) { loading_text.setString( "Loading" + dots ); }
+      else { loading_text.setString( "Loading" + dots + " " + std::to_string( progress.done ) + "/" + std::to_string( progress.total ) ); }
+
       m_window->clear( sf::Color::Black );
       m_window->draw( loading_text );
       m_window->display();
@@ -93,17 +125,17 @@ private:
     future.get();
   }
 
-  // load the splash texture first
-  sf::Texture m_splash_texture{ "res/textures/splash.png" };
+  std::optional<HeadlessOptions> m_headless;
 
-  // Create the opengl window
+  // Create the opengl window, or a closed one for headless runs
   // use fallback resolution for loading screen position since we dont have registry access at this point
-  std::unique_ptr<sf::RenderWindow> m_window = std::make_unique<sf::RenderWindow>( sf::VideoMode( Constants::kFallbackDisplaySize ), "ProceduralMaze",
-                                                                                   sf::State::Fullscreen );
+  std::unique_ptr<sf::RenderWindow> m_window = m_headless ? std::make_unique<sf::RenderWindow>()
+                                                          : std::make_unique<sf::RenderWindow>( sf::VideoMode( Constants::kFallbackDisplaySize ),
+                                                                                                "ProceduralMaze", sf::State::Fullscreen );
 
   // create MultiSprite resources
   std::unique_ptr<Sprites::SpriteFactory> m_sprite_factory;
-  std::unique_ptr<Audio::SoundBank> m_sound_bank = std::make_unique<Audio::SoundBank>();
+  std::unique_ptr<Audio::SoundBank> m_sound_bank = std::make_unique<Audio::SoundBank>( m_headless.has_value() );
 
   std::unique_ptr<Sys::Store> m_system_store;
   std::unique_ptr<Scene::SceneManager> m_scene_manager;
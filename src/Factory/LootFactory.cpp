@@ -40,11 +40,11 @@ std::vector<entt::entity> gen_loot_containers( entt::registry &reg, Sprites::Spr
   for ( std::size_t i = 0; i < num_loot_containers; ++i )
   {
     auto [random_entity, random_origin_position] = Utils::Rnd::get_random_position(
-        reg, {}, Utils::Rnd::ExcludePack<Cmp::PlayerCharacter, Cmp::ReservedPosition, Cmp::Obstacle>{}, 0 );
+        reg, {}, Utils::Rnd::ExcludePack<Cmp::PlayerCharacter, Cmp::ReservedPosition, Cmp::Obstacle>{}, 0, Utils::Rnd::Stream::PROCGEN );
 
     float zorder = sprite_factory.get_sprite_size_by_type( "sprite.graveyard.pots" ).y;
 
-    Cmp::RandomInt pot_picker( 0, 2 );
+    Cmp::RandomInt pot_picker( 0, 2, Utils::Rnd::Stream::PROCGEN );
     Factory::create_loot_container( reg, random_entity, random_origin_position, "sprite.graveyard.pots", pot_picker.gen(), zorder );
     assigned_entts.push_back( random_entity );
   }
@@ -181,10 +181,11 @@ void add_multiblock_with_segments( entt::registry &reg, sf::Vector2f position, c
   Factory::detail::create_multiblock<MULTIBLOCK>( reg, entt, pos, ms, ms_index );
   Factory::detail::create_multiblock_segments<MULTIBLOCK, MBSEGMENT>( reg, entt, pos, ms );
 
-  for ( auto [view_entt, view_cmp, view_zorder] : reg.view<MULTIBLOCK, Cmp::ZOrderValue>().each() )
+  for ( auto view_entt : reg.view<MULTIBLOCK, Cmp::ZOrderValue>() )
   {
-    if ( ms.get_zorder( 0 ) != 0 ) { view_zorder.setZOrder( ms.get_zorder( 0 ) ); }
-    else { view_zorder.setZOrder( view_cmp.position.y + ms.getSpriteSizePixels().y ); }
+    const auto &view_cmp = reg.get<MULTIBLOCK>( view_entt );
+    float z = ms.get_zorder( 0 ) != 0 ? ms.get_zorder( 0 ) : view_cmp.position.y + ms.getSpriteSizePixels().y;
+    reg.patch<Cmp::ZOrderValue>( view_entt, [z]( auto &zorder_cmp ) { zorder_cmp.setZOrder( z ); } );
   }
 }
 
@@ -234,7 +234,7 @@ std::vector<entt::entity> gen_npc_containers( entt::registry &reg, Sprites::Spri
   for ( std::size_t i = 0; i < num_npc_containers; ++i )
   {
     auto [random_entity, random_origin_position] = Utils::Rnd::get_random_position(
-        reg, {}, Utils::Rnd::ExcludePack<Cmp::PlayerCharacter, Cmp::ReservedPosition, Cmp::Obstacle>{}, 0 );
+        reg, {}, Utils::Rnd::ExcludePack<Cmp::PlayerCharacter, Cmp::ReservedPosition, Cmp::Obstacle>{}, 0, Utils::Rnd::Stream::NPC_SPAWNS );
 
     // pick a random loot container type and texture index
     // clang-format off
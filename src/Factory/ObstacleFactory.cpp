@@ -39,7 +39,7 @@ void create_obstacle( entt::registry &registry, entt::entity entity, Cmp::Positi
 {
   if ( sprite_tile_idx > ms.get_sprite_count() - 1 )
   {
-    throw std::runtime_error( "Unable to get index " + std::to_string( sprite_tile_idx ) + " in " + ms.get_sprite_type() +
+    throw std::runtime_error( "Unable to get index " + std::to_string( sprite_tile_idx ) + " in " + ms.get_sprite_type().name() +
                               " ( size: " + std::to_string( ms.get_sprite_count() ) + " )" );
   }
   Cmp::ZOrderValue zorder( 0 );
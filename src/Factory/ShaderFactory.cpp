@@ -2,56 +2,67 @@
 #include <Persistent/DisplayResolution.hpp>
 #include <Shaders/DrippingBloodShader.hpp>
 #include <Shaders/TitleScreenShader.hpp>
+#include <Systems/Render/RenderSystem.hpp>
 
 namespace ProceduralMaze::Factory::Shader
 {
 
+namespace
+{
+
+//! @brief Render texture size for the world effects. They follow the camera, so they only need to cover the world view.
+sf::Vector2u view_texture_size() { return Sys::RenderSystem::kWorldViewSize + Sprites::BaseShaderSprite::kViewMarginPx * 2u; }
+
+//! @brief Every shader compiles a GL program and owns a render texture, and a headless run never draws them, so none are added
+bool skip_shaders() { return Sys::RenderSystem::is_headless(); }
+
+} // namespace
+
 void add_title( Sys::ShaderSystem &shader_sys, const Cmp::Persist::DisplayResolution &display_res )
 {
+  if ( skip_shaders() ) return;
   auto title_screen_shader = std::make_unique<Sprites::TitleScreenShader>( "res/shaders/Generic.vert", "res/shaders/TitleScreen.frag", display_res );
   title_screen_shader->set_tag( "TitleShader" );
   shader_sys.add( std::move( title_screen_shader ), Cmp::ZOrderValue( 20000.f ) );
 }
 
-void add_mist( Sys::ShaderSystem &shader_sys, sf::Vector2f map_size_pixel )
+void add_mist( Sys::ShaderSystem &shader_sys )
 {
-  sf::Vector2u map_size_pixel_2u( map_size_pixel );
-  auto mist_shader = std::make_unique<Sprites::MistShader>( "res/shaders/Generic.vert", "res/shaders/MistShader.frag",
-                                                            map_size_pixel_2u.componentWiseMul( { 2, 2 } ) );
+  if ( skip_shaders() ) return;
+  auto mist_shader = std::make_unique<Sprites::MistShader>( "res/shaders/Generic.vert", "res/shaders/MistShader.frag", view_texture_size() );
   mist_shader->set_tag( "MistShader" );
   shader_sys.add( std::move( mist_shader ), Cmp::ZOrderValue( 20000.f ) );
 }
 
 void add_water( Sys::ShaderSystem &shader_sys, sf::Vector2f map_size_pixel )
 {
-  sf::Vector2u map_size_pixel_2u( map_size_pixel );
-  auto water_shader = std::make_unique<Sprites::FloodWaterShader>( "res/shaders/Generic.vert", "res/shaders/FloodWater2.frag",
-                                                                   map_size_pixel_2u.componentWiseMul( { 2, 2 } ) );
+  if ( skip_shaders() ) return;
+  auto water_shader = std::make_unique<Sprites::FloodWaterShader>( "res/shaders/Generic.vert", "res/shaders/FloodWater2.frag", view_texture_size(),
+                                                                   map_size_pixel.componentWiseMul( { 2.f, 2.f } ) );
   water_shader->set_tag( "WaterShader" );
   shader_sys.add( std::move( water_shader ), Cmp::ZOrderValue( -20000.f ) );
 }
 
-void add_night_static( Sys::ShaderSystem &shader_sys, sf::Vector2f map_size_pixel )
+void add_night_static( Sys::ShaderSystem &shader_sys )
 {
-  sf::Vector2u map_size_pixel_2u( map_size_pixel );
-  auto pulsing_shader = std::make_unique<Sprites::NightStaticShader>( "res/shaders/Generic.vert", "res/shaders/NightStatic.frag", map_size_pixel_2u );
+  if ( skip_shaders() ) return;
+  auto pulsing_shader = std::make_unique<Sprites::NightStaticShader>( "res/shaders/Generic.vert", "res/shaders/NightStatic.frag", view_texture_size() );
   pulsing_shader->set_tag( "NightStatic" );
   shader_sys.add( std::move( pulsing_shader ), Cmp::ZOrderValue( 40000.f ) );
 }
 
-void add_dark( Sys::ShaderSystem &shader_sys, sf::Vector2f map_size_pixel )
+void add_dark( Sys::ShaderSystem &shader_sys )
 {
-  sf::Vector2u map_size_pixel_2u( map_size_pixel );
-  auto dark_mode_shader = std::make_unique<Sprites::DarkModeShader>( "res/shaders/Generic.vert", "res/shaders/DarkMode.frag", map_size_pixel_2u );
+  if ( skip_shaders() ) return;
+  auto dark_mode_shader = std::make_unique<Sprites::DarkModeShader>( "res/shaders/Generic.vert", "res/shaders/DarkMode.frag", view_texture_size() );
   dark_mode_shader->set_tag( "DarkShader" );
   shader_sys.add( std::move( dark_mode_shader ), Cmp::ZOrderValue( 20000.f ) );
 }
 
-void add_curse( Sys::ShaderSystem &shader_sys, sf::Vector2f map_size_pixel )
+void add_curse( Sys::ShaderSystem &shader_sys )
 {
-  sf::Vector2u map_size_pixel_2u( map_size_pixel );
-  auto cursed_mode_shader = std::make_unique<Sprites::DrippingBloodShader>( "res/shaders/Generic.vert", "res/shaders/Generic.frag",
-                                                                            map_size_pixel_2u );
+  if ( skip_shaders() ) return;
+  auto cursed_mode_shader = std::make_unique<Sprites::DrippingBloodShader>( "res/shaders/Generic.vert", "res/shaders/Generic.frag", view_texture_size() );
   shader_sys.add( std::move( cursed_mode_shader ), Cmp::ZOrderValue( 20000.f ) );
 }
 } // namespace ProceduralMaze::Factory::Shader
\ No newline at end of file
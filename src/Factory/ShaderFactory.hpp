@@ -13,11 +13,11 @@ namespace ProceduralMaze::Factory::Shader
 {
 
 void add_title( Sys::ShaderSystem &shader_sys, const Cmp::Persist::DisplayResolution &display_res );
-void add_mist( Sys::ShaderSystem &shader_sys, sf::Vector2f map_size_pixel );
+void add_mist( Sys::ShaderSystem &shader_sys );
 void add_water( Sys::ShaderSystem &shader_sys, sf::Vector2f map_size_pixel );
-void add_night_static( Sys::ShaderSystem &shader_sys, sf::Vector2f map_size_pixel );
-void add_dark( Sys::ShaderSystem &shader_sys, sf::Vector2f map_size_pixel );
-void add_curse( Sys::ShaderSystem &shader_sys, sf::Vector2f map_size_pixel );
+void add_night_static( Sys::ShaderSystem &shader_sys );
+void add_dark( Sys::ShaderSystem &shader_sys );
+void add_curse( Sys::ShaderSystem &shader_sys );
 
 } // namespace ProceduralMaze::Factory::Shader
 
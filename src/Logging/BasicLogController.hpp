@@ -1,11 +1,15 @@
 #ifndef __LOGGING_BASICLOGGER_HPP__
 #define __LOGGING_BASICLOGGER_HPP__
 
+#include <spdlog/async.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/callback_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/spdlog.h>
 
+#include <chrono>
+#include <optional>
+
 // Usage:
 //
 // #include <BasicLogController.hpp>
@@ -16,22 +20,37 @@
 namespace ProceduralMaze::Logging
 {
 
-//! @brief A non-synchronous log controller using SPDLog
+//! @brief Settings for BasicLogController's asynchronous mode
+struct AsyncLogOptions
+{
+  //! @brief Capacity of the message queue shared with the writer thread
+  std::size_t queue_size{ 8192 };
+  //! @brief What a log call does when the queue is full: block, overwrite the oldest message or drop the new one
+  spdlog::async_overflow_policy overflow_policy{ spdlog::async_overflow_policy::overrun_oldest };
+  //! @brief Buffered output is flushed at least this often. Warnings and above are flushed immediately.
+  std::chrono::seconds flush_interval{ 1 };
+};
+
+//! @brief A log controller using SPDLog
 //
 //  Follows the Model–view–controller pattern:
 //
 // 1 Internal Model:
-// - `spdlog::logger`
+// - `spdlog::async_logger`, or `spdlog::logger` when constructed without AsyncLogOptions
 //
 // 3 External Views:
 // - `spdlog::sinks::stdout_color_sink_mt`
 // - `spdlog::sinks::basic_file_sink_mt`
 // - `spdlog::sinks::callback_sink_mt`
 //
+// In async mode the calling thread only formats the message into a bounded queue; a single background thread writes the
+// sinks (including the callback sink) and flushes them in batches, so logging never blocks a frame on disk I/O.
+//
 class BasicLogController
 {
 public:
-  BasicLogController( std::string log_name, std::string log_path )
+  //! @param async Log on a background thread, or synchronously (flushing every message) when empty
+  BasicLogController( std::string log_name, std::string log_path, std::optional<AsyncLogOptions> async = AsyncLogOptions{} )
       : m_log_name( log_name ),
         m_log_path( log_path )
   {
@@ -43,10 +62,32 @@ public:
     // m_file_sink->set_pattern("[%c] [%^%l%$] %s:%v");
     m_file_sink->set_pattern( "%s:%# - %v" );
 
+    const spdlog::sinks_init_list sinks{
+        m_file_sink, m_console_sink,
+        m_callback_sink // DISABLE CALLBACK HERE
+    };
+    if ( async )
+    {
+      spdlog::init_thread_pool( async->queue_size, 1 );
+      m_logger = std::make_shared<spdlog::async_logger>( m_log_name, sinks, spdlog::thread_pool(), async->overflow_policy );
+      m_logger->flush_on( spdlog::level::warn );
+      spdlog::flush_every( async->flush_interval );
+    }
+    else
+    {
+      m_logger = std::make_shared<spdlog::logger>( m_log_name, sinks );
+      m_logger->flush_on( spdlog::level::trace );
+    }
+
     spdlog::set_default_logger( m_logger );
-    spdlog::flush_on( spdlog::level::trace );
   }
 
+  //! @brief Drain the queue and join the writer thread, so nothing logged before exit is lost
+  ~BasicLogController() { spdlog::shutdown(); }
+
+  BasicLogController( const BasicLogController & ) = delete;
+  BasicLogController &operator=( const BasicLogController & ) = delete;
+
 private:
   std::string m_log_name{};
   std::string m_log_path{};
@@ -63,11 +104,7 @@ private:
         // std::cout << "BasicLogController Callback!!!" << "\n";
       } ) };
 
-  // initialise spdlog::logger with sinks
-  std::shared_ptr<spdlog::logger> m_logger{ std::make_shared<spdlog::logger>( spdlog::logger( m_log_name, {
-                                                                                                              m_file_sink, m_console_sink,
-                                                                                                              m_callback_sink // DISABLE CALLBACK HERE
-                                                                                                          } ) ) };
+  std::shared_ptr<spdlog::logger> m_logger;
 };
 
 } // namespace ProceduralMaze::Logging
@@ -2,92 +2,167 @@
 #include <Constants.hpp>
 #include <Npc/Npc.hpp>
 #include <PathFinding/AStar.hpp>
+#include <PathFinding/IndexedMinHeap.hpp>
 #include <Player/PlayerCharacter.hpp>
 #include <SpatialHashGrid.hpp>
 #include <Utils/Maths.hpp>
 #include <Utils/Npc.hpp>
-#include <unordered_map>
+
+#include <algorithm>
+#include <cstdint>
 
 namespace ProceduralMaze::PathFinding
 {
 
-using ClosedList = std::unordered_map<Cmp::Position, PathNode, PathNode::PosHash>;
+namespace
+{
+
+//! @brief Search state for a single navmesh cell. Records are only valid when `gen` matches the current search generation,
+//! so the pool never has to be cleared between searches.
+struct NodeRecord
+{
+  sf::Vector2f pos{};
+  sf::Vector2f size{};
+  double g{ 0 };
+  double h{ 0 };
+  std::size_t parent{ IndexedMinHeap<std::pair<double, double>>::npos };
+  std::uint32_t gen{ 0 };
+  bool closed{ false };
+};
+
+//! @brief Flat, grid-indexed node pool plus the open list. Reused by every call to `astar()` on this thread.
+struct SearchPool
+{
+  std::vector<NodeRecord> records;
+  //! @brief priority is {f, h}: ties on f favour the node nearest the goal
+  IndexedMinHeap<std::pair<double, double>> open_list;
+  std::uint32_t generation{ 0 };
+
+  //! @brief Start a new search over `cell_count` cells, invalidating all records from previous searches
+  void begin( std::size_t cell_count )
+  {
+    if ( records.size() < cell_count ) records.resize( cell_count );
+    open_list.reserve_ids( cell_count );
+    open_list.clear();
+
+    if ( ++generation == 0 )
+    {
+      // generation counter wrapped, so stale records could alias the new generation
+      for ( auto &record : records )
+        record.gen = 0;
+      generation = 1;
+    }
+  }
+
+  //! @brief Get the record for `idx`, resetting it if it belongs to a previous search
+  //! @return NodeRecord& and true if this is the first time `idx` has been seen in this search
+  std::pair<NodeRecord &, bool> visit( std::size_t idx )
+  {
+    auto &record = records[idx];
+    if ( record.gen == generation ) return { record, false };
+    record = NodeRecord{};
+    record.gen = generation;
+    return { record, true };
+  }
+};
+
+} // namespace
 
 std::vector<PathNode> astar( entt::registry &reg, const PathFinding::SpatialHashGrid &spatial_grid, Cmp::Position start, Cmp::Position goal,
                              PathFinding::QueryCompass offset )
 {
+  static constexpr std::size_t kNoIndex = IndexedMinHeap<std::pair<double, double>>::npos;
+  thread_local SearchPool pool;
+
+  // Map navmesh cell coords into the flat pool
+  auto [min_cell, max_cell] = spatial_grid.cell_bounds();
+  if ( max_cell.x < min_cell.x || max_cell.y < min_cell.y ) return {};
+  const auto grid_width = static_cast<std::size_t>( max_cell.x - min_cell.x + 1 );
+  const auto grid_height = static_cast<std::size_t>( max_cell.y - min_cell.y + 1 );
+  auto to_index = [&]( const Cmp::Position &pos ) -> std::size_t
+  {
+    auto [cx, cy] = spatial_grid.cell( pos );
+    if ( cx < min_cell.x || cx > max_cell.x || cy < min_cell.y || cy > max_cell.y ) return kNoIndex;
+    return static_cast<std::size_t>( cx - min_cell.x ) + ( static_cast<std::size_t>( cy - min_cell.y ) * grid_width );
+  };
 
-  std::vector<PathNode> openList;
-  ClosedList closedList;
-  closedList.reserve( 512 ); // prevent rehashing which invalidates parent pointers
+  const auto start_idx = to_index( start );
+  const auto goal_idx = to_index( goal );
+  if ( start_idx == kNoIndex || goal_idx == kNoIndex ) return {};
 
-  std::size_t nodesExpanded = 0;
+  pool.begin( grid_width * grid_height );
 
-  PathNode startNode( start, 0, Utils::Maths::getManhattanDistance( start.position, goal.position ) );
+  auto [start_record, _] = pool.visit( start_idx );
+  start_record.pos = start.position;
+  start_record.size = start.size;
+  start_record.h = Utils::Maths::getManhattanDistance( start.position, goal.position );
+  pool.open_list.push_or_decrease( start_idx, { start_record.g + start_record.h, start_record.h } );
 
-  openList.push_back( startNode );
+  std::size_t end_idx = kNoIndex;
+  std::size_t nodesExpanded = 0;
 
-  PathNode *endNode = nullptr;
-  static constexpr std::size_t kMaxNodes = 256; // bail out if goal is unreachable
+  // bail out if goal is unreachable: large enough to cover most of the open cells on the 99x99 graveyard
+  static constexpr std::size_t kMaxNodes = 4096;
 
-  while ( not openList.empty() )
+  while ( not pool.open_list.empty() )
   {
     if ( ++nodesExpanded > kMaxNodes ) break; // goal unreachable, don't exhaust search space
 
-    // Find PathNode with smallest f
-    auto currentIt = std::min_element( openList.begin(), openList.end(), []( const PathNode &a, const PathNode &b ) { return a.f() < b.f(); } );
-    PathNode current = *currentIt;
-    openList.erase( currentIt );
-    closedList.emplace( current.pos, current );
+    // PathNode with smallest f
+    const auto current_idx = pool.open_list.pop();
+    auto &current = pool.records[current_idx];
+    current.closed = true;
 
-    if ( current.x() == goal.x() && current.y() == goal.y() )
+    if ( current_idx == goal_idx )
     {
-      endNode = &closedList.at( current.pos );
+      end_idx = current_idx;
       break;
     }
 
-    const std::vector<entt::entity> neighbours_list = spatial_grid.neighbours( current.pos, offset );
-
-    for ( auto neighbour_entt : neighbours_list )
-    {
-      auto *neighbour_pos = reg.try_get<Cmp::Position>( neighbour_entt );
-      if ( not neighbour_pos ) continue;
-
-      // Skip other NPCs so they don't block each other's pathfinding
-      if ( reg.any_of<Cmp::NPC>( neighbour_entt ) ) continue;
-
-      auto heuristic = Utils::Maths::getManhattanDistance( neighbour_pos->position, goal.position );
-
-      if ( closedList.count( *neighbour_pos ) > 0 ) continue;
-
-      // +1 since we only care about relative difference between steps, not the actual pixel distance.
-      PathNode new_neighbor( *neighbour_pos, current.g + 1, heuristic, &closedList.at( current.pos ) );
-
-      auto it = std::find_if( openList.begin(), openList.end(),
-                              // existence check
-                              [&]( const PathNode &n ) { return n == new_neighbor; } );
-
-      // either add the new neighbour or add duplicate one if this is nearer to the goal
-      if ( it == openList.end() || new_neighbor.g < it->g )
-      {
-        if ( it != openList.end() ) openList.erase( it );
-        openList.push_back( new_neighbor );
-      }
-    }
+    spatial_grid.for_each_neighbour( Cmp::Position( current.pos, current.size ), offset,
+                                     [&]( entt::entity neighbour_entt )
+                                     {
+                                       auto *neighbour_pos = reg.try_get<Cmp::Position>( neighbour_entt );
+                                       if ( not neighbour_pos ) return;
+
+                                       // Skip other NPCs so they don't block each other's pathfinding
+                                       if ( reg.any_of<Cmp::NPC>( neighbour_entt ) ) return;
+
+                                       const auto neighbour_idx = to_index( *neighbour_pos );
+                                       if ( neighbour_idx == kNoIndex ) return;
+
+                                       auto [neighbour, first_visit] = pool.visit( neighbour_idx );
+                                       if ( neighbour.closed ) return;
+
+                                       // +1 since we only care about relative difference between steps, not the actual pixel distance.
+                                       const double new_g = current.g + 1;
+                                       if ( first_visit )
+                                       {
+                                         // the goal cell always resolves to the exact goal position so callers can compare against it
+                                         const auto &node_pos = neighbour_idx == goal_idx ? goal : *neighbour_pos;
+                                         neighbour.pos = node_pos.position;
+                                         neighbour.size = node_pos.size;
+                                         neighbour.h = Utils::Maths::getManhattanDistance( node_pos.position, goal.position );
+                                       }
+                                       else if ( new_g >= neighbour.g ) { return; }
+
+                                       // either add the new neighbour or re-prioritise the existing one if this route is nearer to the goal
+                                       neighbour.g = new_g;
+                                       neighbour.parent = current_idx;
+                                       pool.open_list.push_or_decrease( neighbour_idx, { neighbour.g + neighbour.h, neighbour.h } );
+                                     } );
   }
 
   // Reconstruct path
   std::vector<PathNode> path;
-  PathNode *p = endNode;
-
-  while ( p != nullptr )
+  for ( auto idx = end_idx; idx != kNoIndex; idx = pool.records[idx].parent )
   {
-    path.push_back( *p );
-    p = p->parent;
+    const auto &record = pool.records[idx];
+    path.emplace_back( Cmp::Position( record.pos, record.size ), record.g, record.h );
   }
 
   std::reverse( path.begin(), path.end() );
   return path;
 }
 
-} // namespace ProceduralMaze::PathFinding
\ No newline at end of file
+} // namespace ProceduralMaze::PathFinding
@@ -22,14 +22,11 @@ struct PathNode
   double g;
   //! @brief Heuristic cost to goal
   double h;
-  //! @brief Pointer to parent node
-  PathNode *parent{ nullptr };
 
-  PathNode( Cmp::Position pos, double g = 0, double h = 0, PathNode *p = nullptr )
+  PathNode( Cmp::Position pos, double g = 0, double h = 0 )
       : pos( pos ),
         g( g ),
-        h( h ),
-        parent( p )
+        h( h )
   {
   }
 
@@ -37,7 +34,7 @@ struct PathNode
   //! @return double
   double f() const { return g + h; }
 
-  //! @brief Used for hash comparison in closedlist and std::find in openlist
+  //! @brief Nodes are equal when they share the same whole-pixel position
   //! @param other
   //! @return true
   //! @return false
@@ -46,22 +43,17 @@ struct PathNode
     return static_cast<int>( pos.position.x ) == static_cast<int>( other.pos.position.x ) &&
            static_cast<int>( pos.position.y ) == static_cast<int>( other.pos.position.y );
   }
-
-  //! @brief Used to create a hash for the ClosedList key. Use int to prevent rounding errors (also faster)
-  struct PosHash
-  {
-    //! @brief
-    //! @param p
-    //! @return std::size_t
-    std::size_t operator()( const Cmp::Position &p ) const noexcept
-    {
-      std::size_t h1 = std::hash<int>{}( static_cast<int>( p.position.x ) );
-      std::size_t h2 = std::hash<int>{}( static_cast<int>( p.position.y ) );
-      return h1 ^ ( h2 << 1 );
-    }
-  };
 };
 
+//! @brief Find the shortest path from `start` to `goal` over the walkable cells of `grid`.
+//! The open list is an indexed binary heap and per-cell search state lives in a flat, generation-stamped pool
+//! that is reused between calls, so a search does not allocate once the pool has grown to the navmesh size.
+//! @param reg
+//! @param grid The pathfinding navmesh
+//! @param start
+//! @param goal
+//! @param query_compass Neighbour offsets to expand; BOTH allows diagonal steps
+//! @return std::vector<PathNode> Path from start to goal inclusive, or empty if the goal was not reached
 std::vector<PathNode> astar( entt::registry &reg, const PathFinding::SpatialHashGrid &grid, Cmp::Position start, Cmp::Position goal,
                              PathFinding::QueryCompass query_compass = PathFinding::QueryCompass::CARDINAL );
 
@@ -0,0 +1,147 @@
+#include <Components/Npc/Npc.hpp>
+#include <Components/Position.hpp>
+#include <PathFinding/FlowField.hpp>
+#include <PathFinding/SpatialHashGrid.hpp>
+#include <Utils/Constants.hpp>
+#include <Utils/Maths.hpp>
+
+namespace ProceduralMaze::PathFinding
+{
+
+void FlowField::update( entt::registry &reg, const SpatialHashGrid &grid, const Cmp::Position &goal )
+{
+  auto goal_cell = SpatialHashGrid::cell( goal );
+  auto [min_cell, max_cell] = grid.cell_bounds();
+  const bool stale = not m_valid || goal_cell != m_goal_cell || grid.version() != m_navmesh_version || min_cell != m_min_cell ||
+                     max_cell != m_max_cell;
+  if ( stale )
+  {
+    rebuild( reg, grid, goal );
+    return;
+  }
+
+  // goal moved within its cell: keep the field, just track the exact goal position
+  m_goal_pos = goal.position;
+  if ( auto idx = index( goal_cell ); idx != npos ) m_cells[idx].pos = goal.position;
+}
+
+void FlowField::rebuild( entt::registry &reg, const SpatialHashGrid &grid, const Cmp::Position &goal )
+{
+  std::tie( m_min_cell, m_max_cell ) = grid.cell_bounds();
+  m_goal_cell = SpatialHashGrid::cell( goal );
+  m_goal_pos = goal.position;
+  m_navmesh_version = grid.version();
+  m_valid = true;
+
+  if ( m_max_cell.x < m_min_cell.x || m_max_cell.y < m_min_cell.y ) return;
+  const auto cell_count = static_cast<std::size_t>( m_max_cell.x - m_min_cell.x + 1 ) * static_cast<std::size_t>( m_max_cell.y - m_min_cell.y + 1 );
+  if ( m_cells.size() < cell_count ) m_cells.resize( cell_count );
+
+  if ( ++m_generation == 0 )
+  {
+    // generation counter wrapped, so stale records could alias the new generation
+    for ( auto &record : m_cells )
+      record.gen = 0;
+    m_generation = 1;
+  }
+
+  const auto goal_idx = index( m_goal_cell );
+  if ( goal_idx == npos ) return;
+
+  // the goal cell is always walkable and resolves to the exact goal position
+  auto &goal_record = m_cells[goal_idx];
+  goal_record = CellRecord{ goal.position, goal.size, 0, m_generation, true };
+
+  m_frontier.clear();
+  m_frontier.push_back( goal_idx );
+
+  const auto width = static_cast<std::size_t>( m_max_cell.x - m_min_cell.x + 1 );
+  const auto offsets = SpatialHashGrid::offsets( m_query_compass );
+
+  // Unit-cost steps, so a FIFO frontier visits cells in distance order
+  for ( std::size_t head = 0; head < m_frontier.size(); ++head )
+  {
+    const auto current_idx = m_frontier[head];
+    const auto current_dist = m_cells[current_idx].dist;
+    const int cx = static_cast<int>( current_idx % width ) + m_min_cell.x;
+    const int cy = static_cast<int>( current_idx / width ) + m_min_cell.y;
+
+    for ( auto [dx, dy] : offsets.subspan( 1 ) ) // skip self
+    {
+      const auto neighbour_idx = index( { cx + dx, cy + dy } );
+      if ( neighbour_idx == npos ) continue;
+      auto &neighbour = probe( reg, grid, neighbour_idx );
+      if ( not neighbour.walkable || neighbour.dist >= 0 ) continue;
+      neighbour.dist = current_dist + 1;
+      m_frontier.push_back( neighbour_idx );
+    }
+  }
+}
+
+std::optional<Cmp::Position> FlowField::next_step( const Cmp::Position &pos ) const
+{
+  if ( not m_valid ) return std::nullopt;
+  auto [cx, cy] = SpatialHashGrid::cell( pos );
+  if ( std::pair{ cx, cy } == m_goal_cell ) return std::nullopt;
+
+  const auto offsets = SpatialHashGrid::offsets( m_query_compass );
+
+  // pick the reachable neighbour with the lowest distance, breaking ties on proximity to the goal
+  const CellRecord *best = nullptr;
+  float best_heuristic = 0.f;
+  for ( auto [dx, dy] : offsets.subspan( 1 ) ) // skip self
+  {
+    const auto idx = index( { cx + dx, cy + dy } );
+    if ( idx == npos ) continue;
+    const auto &record = m_cells[idx];
+    if ( record.gen != m_generation || record.dist < 0 ) continue;
+
+    const float heuristic = Utils::Maths::getManhattanDistance( record.pos, m_goal_pos );
+    if ( best == nullptr || record.dist < best->dist || ( record.dist == best->dist && heuristic < best_heuristic ) )
+    {
+      best = &record;
+      best_heuristic = heuristic;
+    }
+  }
+
+  if ( best == nullptr ) return std::nullopt;
+  return Cmp::Position( best->pos, best->size );
+}
+
+std::size_t FlowField::index( std::pair<int, int> cell_coords ) const
+{
+  auto [cx, cy] = cell_coords;
+  if ( cx < m_min_cell.x || cx > m_max_cell.x || cy < m_min_cell.y || cy > m_max_cell.y ) return npos;
+  const auto width = static_cast<std::size_t>( m_max_cell.x - m_min_cell.x + 1 );
+  return static_cast<std::size_t>( cx - m_min_cell.x ) + ( static_cast<std::size_t>( cy - m_min_cell.y ) * width );
+}
+
+FlowField::CellRecord &FlowField::probe( entt::registry &reg, const SpatialHashGrid &grid, std::size_t idx )
+{
+  auto &record = m_cells[idx];
+  if ( record.gen == m_generation ) return record;
+  record = CellRecord{};
+  record.gen = m_generation;
+
+  const auto width = static_cast<std::size_t>( m_max_cell.x - m_min_cell.x + 1 );
+  const sf::Vector2f cell_pos{ static_cast<float>( static_cast<int>( idx % width ) + m_min_cell.x ) * Constants::kGridSizePxF.x,
+                               static_cast<float>( static_cast<int>( idx / width ) + m_min_cell.y ) * Constants::kGridSizePxF.y };
+
+  grid.for_each_at( Cmp::Position( cell_pos, Constants::kGridSizePxF ),
+                    [&]( entt::entity entt )
+                    {
+                      auto *pos_cmp = reg.try_get<Cmp::Position>( entt );
+                      if ( not pos_cmp ) return true;
+
+                      // Skip NPCs so they don't block each other's pathfinding
+                      if ( reg.any_of<Cmp::NPC>( entt ) ) return true;
+
+                      record.pos = pos_cmp->position;
+                      record.size = pos_cmp->size;
+                      record.walkable = true;
+                      return false;
+                    } );
+  return record;
+}
+
+} // namespace ProceduralMaze::PathFinding
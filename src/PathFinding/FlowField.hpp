@@ -0,0 +1,82 @@
+#ifndef SRC_PATHFINDING_FLOWFIELD_HPP_
+#define SRC_PATHFINDING_FLOWFIELD_HPP_
+
+#include <Position.hpp>
+#include <SpatialHashGrid.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace ProceduralMaze::PathFinding
+{
+
+//! @brief Breadth-first distance field rooted at a single goal (i.e. the player) over the walkable cells of the navmesh.
+//! Every NPC chasing the same goal shares one field, so the cost of pathfinding no longer scales with the number of NPCs.
+//! A cell is walkable when it holds at least one non-NPC entity, matching the NPC-occupancy rule used by `astar()`.
+//! The field is cached on `SpatialHashGrid::version()`, so the navmesh must be tracked with `SpatialHashGrid::track()`
+//! for destroyed entities to free their cells.
+class FlowField
+{
+public:
+  explicit FlowField( QueryCompass query_compass = QueryCompass::CARDINAL )
+      : m_query_compass( query_compass )
+  {
+  }
+
+  //! @brief Rebuild the field if the goal has changed cell or the navmesh topology has changed since the last build
+  //! @param reg
+  //! @param grid The pathfinding navmesh
+  //! @param goal
+  void update( entt::registry &reg, const SpatialHashGrid &grid, const Cmp::Position &goal );
+
+  //! @brief Look up the next step towards the goal from `pos`.
+  //! @param pos
+  //! @return std::optional<Cmp::Position> The neighbouring cell position nearest the goal (the exact goal position for the goal cell),
+  //! or std::nullopt if `pos` is already in the goal cell or cannot reach it.
+  std::optional<Cmp::Position> next_step( const Cmp::Position &pos ) const;
+
+  //! @brief discard the field so the next `update()` always rebuilds
+  void invalidate() { m_valid = false; }
+
+private:
+  //! @brief Per-cell state. Only valid when `gen` matches `m_generation`, so nothing is cleared between builds.
+  struct CellRecord
+  {
+    sf::Vector2f pos{};
+    sf::Vector2f size{};
+    std::int32_t dist{ -1 };
+    std::uint32_t gen{ 0 };
+    bool walkable{ false };
+  };
+
+  QueryCompass m_query_compass;
+
+  std::vector<CellRecord> m_cells;
+  //! @brief BFS frontier, reused between builds
+  std::vector<std::size_t> m_frontier;
+  std::uint32_t m_generation{ 0 };
+
+  //! @brief cell bounds of the navmesh at the last build
+  sf::Vector2i m_min_cell{};
+  sf::Vector2i m_max_cell{ -1, -1 };
+
+  //! @brief cache keys for the last build
+  bool m_valid{ false };
+  std::pair<int, int> m_goal_cell{};
+  sf::Vector2f m_goal_pos{};
+  std::size_t m_navmesh_version{ 0 };
+
+  void rebuild( entt::registry &reg, const SpatialHashGrid &grid, const Cmp::Position &goal );
+
+  //! @return std::size_t index into m_cells, or npos if `cell_coords` is out of bounds
+  std::size_t index( std::pair<int, int> cell_coords ) const;
+  static constexpr std::size_t npos = static_cast<std::size_t>( -1 );
+
+  //! @brief Get the record for `idx`, probing the navmesh for walkability the first time it is seen in this build
+  CellRecord &probe( entt::registry &reg, const SpatialHashGrid &grid, std::size_t idx );
+};
+
+} // namespace ProceduralMaze::PathFinding
+
+#endif // SRC_PATHFINDING_FLOWFIELD_HPP_
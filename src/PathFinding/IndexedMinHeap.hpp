@@ -0,0 +1,123 @@
+#ifndef SRC_PATHFINDING_INDEXEDMINHEAP_HPP_
+#define SRC_PATHFINDING_INDEXEDMINHEAP_HPP_
+
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace ProceduralMaze::PathFinding
+{
+
+//! @brief Binary min-heap over dense integer ids (e.g. node pool indices) with O(log n) decrease-key.
+//! @note Storage is kept between uses: `clear()` only resets the slots of ids still queued, so
+//!       once warmed up the heap never allocates.
+//! @tparam Priority Any type with `operator<`
+template <typename Priority>
+class IndexedMinHeap
+{
+public:
+  static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+  //! @brief Make sure ids in the range [0, id_count) can be queued
+  //! @param id_count
+  void reserve_ids( std::size_t id_count )
+  {
+    if ( m_slot.size() < id_count ) m_slot.resize( id_count, npos );
+  }
+
+  bool empty() const { return m_heap.empty(); }
+  std::size_t size() const { return m_heap.size(); }
+
+  //! @brief Is `id` currently queued?
+  bool contains( std::size_t id ) const { return id < m_slot.size() && m_slot[id] != npos; }
+
+  //! @brief Queue `id` with `priority`, or lower the priority of `id` if it is already queued.
+  //! @note Higher priorities for an already queued `id` are ignored
+  //! @return true if the heap was modified
+  bool push_or_decrease( std::size_t id, Priority priority )
+  {
+    reserve_ids( id + 1 );
+    if ( m_slot[id] != npos )
+    {
+      auto slot = m_slot[id];
+      if ( not( priority < m_heap[slot].priority ) ) return false;
+      m_heap[slot].priority = std::move( priority );
+      sift_up( slot );
+      return true;
+    }
+    m_heap.push_back( Entry{ std::move( priority ), id } );
+    m_slot[id] = m_heap.size() - 1;
+    sift_up( m_heap.size() - 1 );
+    return true;
+  }
+
+  //! @brief Remove and return the id with the smallest priority. Heap must not be empty.
+  std::size_t pop()
+  {
+    auto top_id = m_heap.front().id;
+    swap_entries( 0, m_heap.size() - 1 );
+    m_heap.pop_back();
+    m_slot[top_id] = npos;
+    if ( not m_heap.empty() ) sift_down( 0 );
+    return top_id;
+  }
+
+  //! @brief Empty the heap without releasing memory
+  void clear()
+  {
+    for ( const auto &entry : m_heap )
+      m_slot[entry.id] = npos;
+    m_heap.clear();
+  }
+
+private:
+  struct Entry
+  {
+    Priority priority;
+    std::size_t id;
+  };
+
+  //! @brief the binary heap itself
+  std::vector<Entry> m_heap;
+  //! @brief id --> index into m_heap, or npos if not queued
+  std::vector<std::size_t> m_slot;
+
+  void swap_entries( std::size_t a, std::size_t b )
+  {
+    std::swap( m_heap[a], m_heap[b] );
+    m_slot[m_heap[a].id] = a;
+    m_slot[m_heap[b].id] = b;
+  }
+
+  void sift_up( std::size_t i )
+  {
+    while ( i > 0 )
+    {
+      auto parent = ( i - 1 ) / 2;
+      if ( not( m_heap[i].priority < m_heap[parent].priority ) ) break;
+      swap_entries( i, parent );
+      i = parent;
+    }
+  }
+
+  void sift_down( std::size_t i )
+  {
+    const auto n = m_heap.size();
+    while ( true )
+    {
+      auto smallest = i;
+      auto left = ( 2 * i ) + 1;
+      auto right = left + 1;
+      if ( left < n && m_heap[left].priority < m_heap[smallest].priority ) smallest = left;
+      if ( right < n && m_heap[right].priority < m_heap[smallest].priority ) smallest = right;
+      if ( smallest == i ) break;
+      swap_entries( i, smallest );
+      i = smallest;
+    }
+  }
+};
+
+} // namespace ProceduralMaze::PathFinding
+
+#endif // SRC_PATHFINDING_INDEXEDMINHEAP_HPP_
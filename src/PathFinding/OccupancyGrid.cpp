@@ -0,0 +1,137 @@
+#include <Constants.hpp>
+#include <OccupancyGrid.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace ProceduralMaze::PathFinding
+{
+
+void OccupancyGrid::add( const sf::FloatRect &rect )
+{
+  auto range = cell_range( rect );
+  if ( range.min.x >= range.max.x || range.min.y >= range.max.y ) return;
+  grow( range.max );
+  for ( int y = range.min.y; y < range.max.y; ++y )
+  {
+    for ( int x = range.min.x; x < range.max.x; ++x )
+      ++m_counts[static_cast<std::size_t>( y ) * m_size.x + x];
+  }
+  ++m_version;
+}
+
+void OccupancyGrid::remove( const sf::FloatRect &rect )
+{
+  auto range = cell_range( rect );
+  range.max = { std::min( range.max.x, m_size.x ), std::min( range.max.y, m_size.y ) };
+  for ( int y = range.min.y; y < range.max.y; ++y )
+  {
+    for ( int x = range.min.x; x < range.max.x; ++x )
+    {
+      auto &count = m_counts[static_cast<std::size_t>( y ) * m_size.x + x];
+      if ( count > 0 ) --count;
+    }
+  }
+  ++m_version;
+}
+
+bool OccupancyGrid::is_free( sf::Vector2i origin, sf::Vector2i footprint ) const
+{
+  update_sums();
+  return blocked_in( origin, origin + footprint ) == 0;
+}
+
+const std::vector<sf::Vector2i> &OccupancyGrid::free_cells( sf::Vector2i footprint ) const
+{
+  if ( m_free_cells_valid && m_free_cells_version == m_version && m_free_cells_footprint == footprint ) return m_free_cells;
+
+  update_sums();
+  m_free_cells.clear();
+  for ( int y = 0; y + footprint.y <= m_size.y; ++y )
+  {
+    for ( int x = 0; x + footprint.x <= m_size.x; ++x )
+    {
+      if ( blocked_in( { x, y }, { x + footprint.x, y + footprint.y } ) == 0 ) m_free_cells.emplace_back( x, y );
+    }
+  }
+  m_free_cells_footprint = footprint;
+  m_free_cells_version = m_version;
+  m_free_cells_valid = true;
+  return m_free_cells;
+}
+
+sf::Vector2i OccupancyGrid::footprint( sf::Vector2f size_px )
+{
+  return { std::max( 1, static_cast<int>( std::ceil( size_px.x / Constants::kGridSizePxF.x ) ) ),
+           std::max( 1, static_cast<int>( std::ceil( size_px.y / Constants::kGridSizePxF.y ) ) ) };
+}
+
+sf::Vector2i OccupancyGrid::cell_of( const sf::FloatRect &pos )
+{
+  return { static_cast<int>( std::floor( pos.position.x / Constants::kGridSizePxF.x ) ),
+           static_cast<int>( std::floor( pos.position.y / Constants::kGridSizePxF.y ) ) };
+}
+
+sf::Vector2f OccupancyGrid::cell_position( sf::Vector2i cell )
+{
+  return { static_cast<float>( cell.x ) * Constants::kGridSizePxF.x, static_cast<float>( cell.y ) * Constants::kGridSizePxF.y };
+}
+
+OccupancyGrid::CellRange OccupancyGrid::cell_range( const sf::FloatRect &rect )
+{
+  // touching edges do not overlap, matching sf::FloatRect::findIntersection()
+  const auto cell_size = Constants::kGridSizePxF;
+  CellRange range{ cell_of( rect ),
+                   { static_cast<int>( std::ceil( ( rect.position.x + rect.size.x ) / cell_size.x ) ),
+                     static_cast<int>( std::ceil( ( rect.position.y + rect.size.y ) / cell_size.y ) ) } };
+  range.min = { std::max( range.min.x, 0 ), std::max( range.min.y, 0 ) };
+  return range;
+}
+
+void OccupancyGrid::grow( sf::Vector2i max )
+{
+  if ( max.x <= m_size.x && max.y <= m_size.y ) return;
+
+  const sf::Vector2i new_size( std::max( max.x, m_size.x ), std::max( max.y, m_size.y ) );
+  std::vector<std::uint16_t> counts( static_cast<std::size_t>( new_size.x ) * new_size.y, 0 );
+  for ( int y = 0; y < m_size.y; ++y )
+  {
+    auto row = m_counts.begin() + static_cast<std::ptrdiff_t>( y ) * m_size.x;
+    std::copy( row, row + m_size.x, counts.begin() + static_cast<std::ptrdiff_t>( y ) * new_size.x );
+  }
+  m_counts = std::move( counts );
+  m_size = new_size;
+  m_sums_valid = false;
+}
+
+void OccupancyGrid::update_sums() const
+{
+  if ( m_sums_valid && m_sums_version == m_version ) return;
+
+  const auto stride = static_cast<std::size_t>( m_size.x ) + 1;
+  m_blocked_sums.assign( stride * ( static_cast<std::size_t>( m_size.y ) + 1 ), 0 );
+  for ( int y = 0; y < m_size.y; ++y )
+  {
+    std::uint32_t row_sum = 0;
+    for ( int x = 0; x < m_size.x; ++x )
+    {
+      row_sum += m_counts[static_cast<std::size_t>( y ) * m_size.x + x] > 0 ? 1 : 0;
+      m_blocked_sums[( y + 1 ) * stride + x + 1] = m_blocked_sums[y * stride + x + 1] + row_sum;
+    }
+  }
+  m_sums_version = m_version;
+  m_sums_valid = true;
+}
+
+std::uint32_t OccupancyGrid::blocked_in( sf::Vector2i min, sf::Vector2i max ) const
+{
+  min = { std::clamp( min.x, 0, m_size.x ), std::clamp( min.y, 0, m_size.y ) };
+  max = { std::clamp( max.x, 0, m_size.x ), std::clamp( max.y, 0, m_size.y ) };
+  if ( min.x >= max.x || min.y >= max.y ) return 0;
+
+  const auto stride = static_cast<std::size_t>( m_size.x ) + 1;
+  auto at = [&]( int x, int y ) { return m_blocked_sums[static_cast<std::size_t>( y ) * stride + x]; };
+  return at( max.x, max.y ) - at( min.x, max.y ) - at( max.x, min.y ) + at( min.x, min.y );
+}
+
+} // namespace ProceduralMaze::PathFinding
@@ -0,0 +1,182 @@
+#ifndef SRC_PATHFINDING_OCCUPANCYGRID_HPP_
+#define SRC_PATHFINDING_OCCUPANCYGRID_HPP_
+
+#include <Components/Position.hpp>
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <entt/entity/registry.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace ProceduralMaze::PathFinding
+{
+
+//! @brief Per-cell count of the blocking rects covering each map cell, answering "is this footprint clear" in O(1)
+//! and "which cells can this footprint start from" with one pass over the map.
+//! The grid grows to fit the blocking rects added to it; cells outside it are free.
+class OccupancyGrid
+{
+public:
+  //! @brief Add a blocking rect. It covers every cell it overlaps by a non-zero area.
+  void add( const sf::FloatRect &rect );
+
+  //! @brief Remove a blocking rect previously passed to `add()`
+  void remove( const sf::FloatRect &rect );
+
+  //! @brief True if no blocking rect covers the `footprint` cells starting at `origin`
+  bool is_free( sf::Vector2i origin, sf::Vector2i footprint ) const;
+
+  //! @brief Every origin cell where `footprint` fits inside the grid without touching a blocked cell, in row-major order.
+  //! The list is cached until the grid changes or a different footprint is requested.
+  const std::vector<sf::Vector2i> &free_cells( sf::Vector2i footprint ) const;
+
+  //! @brief Grid dimensions in cells
+  sf::Vector2i size() const { return m_size; }
+
+  //! @brief Incremented by every `add()`/`remove()`
+  std::size_t version() const { return m_version; }
+
+  //! @brief Cells covered by an object of `size_px` placed at a cell origin
+  static sf::Vector2i footprint( sf::Vector2f size_px );
+
+  //! @brief Cell containing the top-left corner of `pos`
+  static sf::Vector2i cell_of( const sf::FloatRect &pos );
+
+  //! @brief Pixel position of the top-left corner of `cell`
+  static sf::Vector2f cell_position( sf::Vector2i cell );
+
+private:
+  //! @brief Half-open range of cells [min, max) covered by a rect
+  struct CellRange
+  {
+    sf::Vector2i min;
+    sf::Vector2i max;
+  };
+
+  sf::Vector2i m_size{ 0, 0 };
+
+  //! @brief number of blocking rects covering each cell, row-major
+  std::vector<std::uint16_t> m_counts;
+
+  std::size_t m_version{ 0 };
+
+  //! @brief summed-area table of blocked cells, (m_size.x + 1) * (m_size.y + 1), rebuilt on the first query after a change
+  mutable std::vector<std::uint32_t> m_blocked_sums;
+  mutable std::size_t m_sums_version{ 0 };
+  mutable bool m_sums_valid{ false };
+
+  mutable std::vector<sf::Vector2i> m_free_cells;
+  mutable sf::Vector2i m_free_cells_footprint{ 0, 0 };
+  mutable std::size_t m_free_cells_version{ 0 };
+  mutable bool m_free_cells_valid{ false };
+
+  static CellRange cell_range( const sf::FloatRect &rect );
+
+  //! @brief Grow the grid (keeping its contents) so cells [0, max) exist
+  void grow( sf::Vector2i max );
+
+  void update_sums() const;
+
+  //! @brief Number of blocked cells in [min, max), both clamped to the grid
+  std::uint32_t blocked_in( sf::Vector2i min, sf::Vector2i max ) const;
+};
+
+//! @brief The OccupancyGrid of every entity owning a Cmp::Position and any of `Blockers`. A blocker that is itself a
+//! Cmp::Position (i.e. Cmp::VoidPosition, whose entities own no Cmp::Position) blocks its own rect.
+//! One instance per blocker set lives in the registry context, so each scene has its own. It is populated on first use and
+//! kept current through EnTT signals on `Blockers` and Cmp::Position; changes are queued and applied by the next `get()`.
+//! @note Entities that move by mutating their Cmp::Position in place (player/NPCs) raise no signal, so do not use them as blockers.
+template <typename... Blockers>
+class BlockerOccupancy : public OccupancyGrid
+{
+public:
+  //! @brief Get the occupancy grid for `reg`, creating it on first use and applying any pending changes
+  static const OccupancyGrid &get( entt::registry &reg )
+  {
+    auto *occupancy = reg.ctx().find<BlockerOccupancy>();
+    if ( not occupancy )
+    {
+      occupancy = &reg.ctx().emplace<BlockerOccupancy>();
+      ( connect<Blockers>( reg ), ... );
+      reg.on_construct<Cmp::Position>().template connect<&BlockerOccupancy::on_position_change>();
+      reg.on_update<Cmp::Position>().template connect<&BlockerOccupancy::on_position_change>();
+      reg.on_destroy<Cmp::Position>().template connect<&BlockerOccupancy::on_position_change>();
+      ( occupancy->template mark_all<Blockers>( reg ), ... );
+    }
+    occupancy->sync( reg );
+    return *occupancy;
+  }
+
+private:
+  //! @brief the rect each tracked entity was added with, so it can be removed after it moves or loses its blocker
+  std::unordered_map<entt::entity, sf::FloatRect> m_tracked;
+
+  //! @brief entities whose blocker or position changed since the last `sync()`
+  std::vector<entt::entity> m_dirty;
+
+  template <typename Blocker>
+  static void connect( entt::registry &reg )
+  {
+    reg.on_construct<Blocker>().template connect<&BlockerOccupancy::on_blocker_change>();
+    reg.on_destroy<Blocker>().template connect<&BlockerOccupancy::on_blocker_change>();
+  }
+
+  template <typename Blocker>
+  void mark_all( entt::registry &reg )
+  {
+    for ( auto entt : reg.view<Blocker>() )
+      m_dirty.push_back( entt );
+  }
+
+  void sync( entt::registry &reg )
+  {
+    for ( auto entt : m_dirty )
+    {
+      if ( auto it = m_tracked.find( entt ); it != m_tracked.end() )
+      {
+        remove( it->second );
+        m_tracked.erase( it );
+      }
+      // destroy signals fire before the component is gone, so the entity is re-checked here rather than in the handler
+      if ( not reg.valid( entt ) || not reg.any_of<Blockers...>( entt ) ) continue;
+      const auto *rect = rect_of( reg, entt );
+      if ( not rect ) continue;
+      add( *rect );
+      m_tracked.emplace( entt, *rect );
+    }
+    m_dirty.clear();
+  }
+
+  //! @brief The entity's Cmp::Position, or else its first blocker that is a Cmp::Position
+  static const sf::FloatRect *rect_of( entt::registry &reg, entt::entity entt )
+  {
+    const sf::FloatRect *rect = reg.try_get<Cmp::Position>( entt );
+    ( ( rect = rect ? rect : positioned_blocker<Blockers>( reg, entt ) ), ... );
+    return rect;
+  }
+
+  template <typename Blocker>
+  static const sf::FloatRect *positioned_blocker( entt::registry &reg, entt::entity entt )
+  {
+    if constexpr ( std::derived_from<Blocker, Cmp::Position> ) { return reg.try_get<Blocker>( entt ); }
+    else { return nullptr; }
+  }
+
+  static void on_blocker_change( entt::registry &reg, entt::entity entt ) { reg.ctx().get<BlockerOccupancy>().m_dirty.push_back( entt ); }
+
+  //! @brief only blocking entities care about position changes, which keeps everything else out of the queue
+  static void on_position_change( entt::registry &reg, entt::entity entt )
+  {
+    auto &occupancy = reg.ctx().get<BlockerOccupancy>();
+    if ( occupancy.m_tracked.contains( entt ) || reg.any_of<Blockers...>( entt ) ) occupancy.m_dirty.push_back( entt );
+  }
+};
+
+} // namespace ProceduralMaze::PathFinding
+
+#endif // SRC_PATHFINDING_OCCUPANCYGRID_HPP_
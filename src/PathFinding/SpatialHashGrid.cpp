@@ -2,81 +2,181 @@
 
 #include <Components/Position.hpp>
 
+#include <algorithm>
+#include <utility>
+
 namespace ProceduralMaze::PathFinding
 {
 
+SpatialHashGrid::SpatialHashGrid( sf::Vector2u map_grid_size )
+    : m_dense( static_cast<std::size_t>( map_grid_size.x ) * map_grid_size.y ),
+      m_dense_size( static_cast<int>( map_grid_size.x ), static_cast<int>( map_grid_size.y ) )
+{
+}
+
 void SpatialHashGrid::insert( entt::entity e, const Cmp::Position &pos )
 {
-  auto [cx, cy] = cell( pos );
-  m_grid[encode( cx, cy )].push_back( e );
+  do_insert( e, cell( pos ) );
+  ++m_version;
 }
 
 void SpatialHashGrid::remove( entt::entity e, const Cmp::Position &pos )
 {
-  auto [cx, cy] = cell( pos );
-  auto it = m_grid.find( encode( cx, cy ) );
-  if ( it == m_grid.end() ) return;
-  auto &bucket = it->second;
-  std::erase( bucket, e );
+  do_remove( e, cell( pos ) );
+  ++m_version;
+}
+
+bool SpatialHashGrid::erase( entt::entity e, const Cmp::Position &pos )
+{
+  auto cell_coords = cell( pos );
+  auto bucket = find_bucket( cell_coords.first, cell_coords.second );
+  if ( std::ranges::find( bucket, e ) == bucket.end() ) return false;
+  do_remove( e, cell_coords );
+  ++m_version;
+  return true;
+}
+
+void SpatialHashGrid::track( entt::registry &reg, const std::shared_ptr<SpatialHashGrid> &navmesh )
+{
+  if ( auto *tracker = reg.ctx().find<Tracker>() )
+  {
+    tracker->navmesh = navmesh;
+    return;
+  }
+  reg.ctx().emplace<Tracker>().navmesh = navmesh;
+  reg.on_destroy<Cmp::Position>().connect<&Tracker::on_destroy>();
+}
+
+void SpatialHashGrid::Tracker::on_destroy( entt::registry &reg, entt::entity e )
+{
+  auto navmesh = reg.ctx().get<Tracker>().navmesh.lock();
+  if ( navmesh ) navmesh->erase( e, reg.get<Cmp::Position>( e ) );
 }
 
 void SpatialHashGrid::update( entt::entity e, const Cmp::Position &old_pos, const Cmp::Position &new_pos )
 {
-  remove( e, old_pos );
-  insert( e, new_pos );
+  auto old_cell = cell( old_pos );
+  auto new_cell = cell( new_pos );
+  if ( old_cell == new_cell )
+  {
+    // same bucket: nothing to do unless `e` was never inserted
+    auto bucket = find_bucket( new_cell.first, new_cell.second );
+    if ( std::ranges::find( bucket, e ) != bucket.end() ) return;
+  }
+  do_remove( e, old_cell );
+  do_insert( e, new_cell );
+}
+
+void SpatialHashGrid::do_insert( entt::entity e, std::pair<int, int> cell_coords )
+{
+  auto [cx, cy] = cell_coords;
+  auto *dense = dense_cell( cx, cy );
+  if ( dense && not dense->spilled && dense->count < kInlineCellCapacity ) { dense->entities[dense->count++] = e; }
+  else if ( dense && not dense->spilled )
+  {
+    // inline storage is full: move the whole bucket into the hash map
+    auto &bucket = m_grid[encode( cx, cy )];
+    bucket.assign( dense->entities.begin(), dense->entities.begin() + dense->count );
+    bucket.push_back( e );
+    dense->count = 0;
+    dense->spilled = true;
+  }
+  else { m_grid[encode( cx, cy )].push_back( e ); }
+  m_min_cell = { std::min( m_min_cell.x, cx ), std::min( m_min_cell.y, cy ) };
+  m_max_cell = { std::max( m_max_cell.x, cx ), std::max( m_max_cell.y, cy ) };
+}
+
+void SpatialHashGrid::do_remove( entt::entity e, std::pair<int, int> cell_coords )
+{
+  auto [cx, cy] = cell_coords;
+  if ( auto *dense = dense_cell( cx, cy ); dense && not dense->spilled )
+  {
+    auto first = dense->entities.begin();
+    auto last = std::remove( first, first + dense->count, e );
+    dense->count = static_cast<std::uint8_t>( last - first );
+    return;
+  }
+  auto it = m_grid.find( encode( cx, cy ) );
+  if ( it == m_grid.end() ) return;
+  auto &bucket = it->second;
+  std::erase( bucket, e );
 }
 
 std::vector<entt::entity> SpatialHashGrid::at( const Cmp::Position &pos ) const
 {
   std::vector<entt::entity> result{};
-  auto [cx, cy] = cell( pos );
-  auto it = m_grid.find( encode( cx, cy ) );
-  if ( it == m_grid.end() ) return {};
-  result.insert( result.end(), it->second.begin(), it->second.end() );
+  for_each_at( pos, [&]( entt::entity e ) { result.push_back( e ); } );
   return result;
 }
 
+std::size_t SpatialHashGrid::at( const Cmp::Position &pos, std::span<entt::entity> out ) const
+{
+  std::size_t count = 0;
+  for_each_at( pos,
+               [&]( entt::entity e )
+               {
+                 if ( count < out.size() ) out[count] = e;
+                 ++count;
+               } );
+  return count;
+}
+
 std::vector<entt::entity> SpatialHashGrid::neighbours( const Cmp::Position &pos, QueryCompass offset ) const
 {
   std::vector<entt::entity> result;
-  auto [cx, cy] = cell( pos );
+  for_each_neighbour( pos, offset, [&]( entt::entity e ) { result.push_back( e ); } );
+  return result;
+}
+
+std::size_t SpatialHashGrid::neighbours( const Cmp::Position &pos, std::span<entt::entity> out, QueryCompass offset ) const
+{
+  std::size_t count = 0;
+  for_each_neighbour( pos, offset,
+                      [&]( entt::entity e )
+                      {
+                        if ( count < out.size() ) out[count] = e;
+                        ++count;
+                      } );
+  return count;
+}
 
-  static constexpr std::array<std::pair<int, int>, 5> cardinal_offsets{ {
-      { 0, 0 },  // self
-      { 0, -1 }, // up
-      { 0, +1 }, // down
-      { -1, 0 }, // left
-      { +1, 0 }, // right
-  } };
-
-  static constexpr std::array<std::pair<int, int>, 9> all_offsets{ {
-      { 0, 0 },   // self
-      { 0, -1 },  // up
-      { 0, +1 },  // down
-      { -1, 0 },  // left
-      { +1, 0 },  // right
-      { -1, -1 }, // top-left
-      { +1, -1 }, // top-right
-      { -1, +1 }, // bottom-left
-      { +1, +1 }, // bottom-right
-  } };
-
-  auto query_offsets = [&]( auto &offsets )
+std::size_t SpatialHashGrid::neighbour_count( const Cmp::Position &pos, QueryCompass offset ) const
+{
+  std::size_t count = 0;
+  auto [cx, cy] = cell( pos );
+  for ( auto [dx, dy] : offsets( offset ) )
   {
-    for ( auto [dx, dy] : offsets )
-    {
-      auto it = m_grid.find( encode( cx + dx, cy + dy ) );
-      if ( it == m_grid.end() ) continue;
-      result.insert( result.end(), it->second.begin(), it->second.end() );
-    }
-  };
+    count += find_bucket( cx + dx, cy + dy ).size();
+  }
+  return count;
+}
 
-  offset == QueryCompass::CARDINAL ? query_offsets( cardinal_offsets ) : query_offsets( all_offsets );
+std::size_t SpatialHashGrid::size() const
+{
+  auto dense_buckets = std::ranges::count_if( m_dense, []( const DenseCell &dense ) { return dense.count > 0; } );
+  return static_cast<std::size_t>( dense_buckets ) + m_grid.size();
+}
 
-  return result;
+std::span<const entt::entity> SpatialHashGrid::find_bucket( int x, int y ) const
+{
+  if ( const auto *dense = dense_cell( x, y ); dense && not dense->spilled ) return { dense->entities.data(), dense->count };
+  auto it = m_grid.find( encode( x, y ) );
+  if ( it == m_grid.end() ) return {};
+  return it->second;
+}
+
+SpatialHashGrid::DenseCell *SpatialHashGrid::dense_cell( int x, int y )
+{
+  return const_cast<DenseCell *>( std::as_const( *this ).dense_cell( x, y ) );
+}
+
+const SpatialHashGrid::DenseCell *SpatialHashGrid::dense_cell( int x, int y ) const
+{
+  if ( x < 0 || y < 0 || x >= m_dense_size.x || y >= m_dense_size.y ) return nullptr;
+  return &m_dense[static_cast<std::size_t>( x ) + ( static_cast<std::size_t>( y ) * static_cast<std::size_t>( m_dense_size.x ) )];
 }
 
-std::pair<int, int> SpatialHashGrid::cell( const Cmp::Position &pos ) const
+std::pair<int, int> SpatialHashGrid::cell( const Cmp::Position &pos )
 {
   return { static_cast<int>( std::floor( pos.position.x / m_cell_size ) ), static_cast<int>( std::floor( pos.position.y / m_cell_size ) ) };
 }
@@ -4,6 +4,12 @@
 #include <Constants.hpp>
 
 #include <entt/entt.hpp>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -15,20 +21,60 @@ class Position;
 namespace ProceduralMaze::PathFinding
 {
 
-//! @brief Select Cardinal or All offsets for query function
+//! @brief Select Cardinal, Ordinal or All offsets for query function
 enum class QueryCompass {
   CARDINAL, // cardinal only
-  ORDINAL,
-  BOTH // include diagonals
+  ORDINAL,  // diagonals only
+  BOTH      // include diagonals
 };
 
-//! @brief Store buckets of entities using their pixel positions as a key
+//! @brief Store buckets of entities using their pixel positions as a key.
+//! When the map bounds are known up front the buckets inside them live in a contiguous dense cell array
+//! with small inline storage, and only cells outside the bounds (or overfull cells) fall back to the hash map.
 class SpatialHashGrid
 {
 public:
-  //! @brief Construct a new Spatial Hash Grid object
+  //! @brief Cell offsets visited by QueryCompass::CARDINAL queries
+  static constexpr std::array<std::pair<int, int>, 5> kCardinalOffsets{ {
+      { 0, 0 },  // self
+      { 0, -1 }, // up
+      { 0, +1 }, // down
+      { -1, 0 }, // left
+      { +1, 0 }, // right
+  } };
+
+  //! @brief Cell offsets visited by QueryCompass::ORDINAL queries
+  static constexpr std::array<std::pair<int, int>, 5> kOrdinalOffsets{ {
+      { 0, 0 },   // self
+      { -1, -1 }, // top-left
+      { +1, -1 }, // top-right
+      { -1, +1 }, // bottom-left
+      { +1, +1 }, // bottom-right
+  } };
+
+  //! @brief Cell offsets visited by QueryCompass::BOTH queries
+  static constexpr std::array<std::pair<int, int>, 9> kAllOffsets{ {
+      { 0, 0 },   // self
+      { 0, -1 },  // up
+      { 0, +1 },  // down
+      { -1, 0 },  // left
+      { +1, 0 },  // right
+      { -1, -1 }, // top-left
+      { +1, -1 }, // top-right
+      { -1, +1 }, // bottom-left
+      { +1, +1 }, // bottom-right
+  } };
+
+  //! @brief Entities stored inline per dense cell before the cell spills over into the hash map
+  static constexpr std::size_t kInlineCellCapacity = 3;
+
+  //! @brief Construct a new Spatial Hash Grid object with unbounded, hash map backed storage
   SpatialHashGrid() = default;
 
+  //! @brief Construct a new Spatial Hash Grid object with dense storage for cells [0, map_grid_size)
+  //! @param map_grid_size Map dimensions in cells, i.e. the grid size from `SceneData::map_size()`
+  explicit SpatialHashGrid( sf::Vector2u map_grid_size );
+
   //! @brief insert entt `e` into the bucket for `pos`
   //! @param e
   //! @param pos
@@ -39,38 +85,183 @@ public:
   //! @param pos
   void remove( entt::entity e, const Cmp::Position &pos );
 
-  //! @brief Remove `e` from its old position and re-insert at new position
+  //! @brief Remove `e` from the bucket for `pos` if it is there
+  //! @return true if `e` was removed, in which case `version()` has changed
+  bool erase( entt::entity e, const Cmp::Position &pos );
+
+  //! @brief Keep `navmesh` in sync with `reg`: an entity that is destroyed or loses its Cmp::Position while still in the
+  //! navmesh is erased from it, so cached queries (i.e. FlowField) see the change through `version()`. Entities that were
+  //! never inserted (i.e. footprints) cost one bucket lookup and leave `version()` alone.
+  //! Call after populating a scene's navmesh. Replaces any navmesh previously tracked for `reg`.
+  static void track( entt::registry &reg, const std::shared_ptr<SpatialHashGrid> &navmesh );
+
+  //! @brief Remove `e` from its old position and re-insert at new position.
+  //! @note Moves of dynamic entities (player/NPC) do not change `version()`. Moves within the same cell are a no-op
+  //! once `e` is in the grid.
   //! @param e
   //! @param old_pos
   //! @param new_pos
   void update( entt::entity e, const Cmp::Position &old_pos, const Cmp::Position &new_pos );
 
+  //! @brief Copy the bucket for `pos` into a new vector
+  //! @param pos
+  //! @return std::vector<entt::entity>
   std::vector<entt::entity> at( const Cmp::Position &pos ) const;
 
+  //! @brief Allocation-free version of `at()`: copies as many entities as fit into `out`
+  //! @param pos
+  //! @param out Caller-provided buffer
+  //! @return std::size_t The total number of entities in the bucket, which may exceed `out.size()`
+  std::size_t at( const Cmp::Position &pos, std::span<entt::entity> out ) const;
+
+  //! @brief Call `visitor( entt::entity )` for every entity in the bucket for `pos`.
+  //! If `visitor` returns bool, returning false stops the query early.
+  //! @param pos
+  //! @param visitor
+  template <typename Visitor>
+  void for_each_at( const Cmp::Position &pos, Visitor &&visitor ) const
+  {
+    auto [cx, cy] = cell( pos );
+    for ( auto e : find_bucket( cx, cy ) )
+    {
+      if ( not visit( visitor, e ) ) return;
+    }
+  }
+
   //! @brief Using `pos` as a lookup, flattens neighbouring buckets (9 max) into single vector
   //! @param pos
   //! @return std::vector<entt::entity>
   std::vector<entt::entity> neighbours( const Cmp::Position &pos, QueryCompass offset = QueryCompass::BOTH ) const;
 
-  size_t size() { return m_grid.size(); }
+  //! @brief Allocation-free version of `neighbours()`: copies as many entities as fit into `out`
+  //! @param pos
+  //! @param out Caller-provided buffer, i.e. a std::array on the stack
+  //! @param offset
+  //! @return std::size_t The total number of neighbouring entities, which may exceed `out.size()`
+  std::size_t neighbours( const Cmp::Position &pos, std::span<entt::entity> out, QueryCompass offset = QueryCompass::BOTH ) const;
+
+  //! @brief Count the entities in the neighbouring buckets (9 max) without copying them
+  //! @param pos
+  //! @param offset
+  //! @return std::size_t
+  std::size_t neighbour_count( const Cmp::Position &pos, QueryCompass offset = QueryCompass::BOTH ) const;
+
+  //! @brief Call `visitor( entt::entity )` for every entity in the neighbouring buckets (9 max).
+  //! If `visitor` returns bool, returning false stops the query early.
+  //! @param pos
+  //! @param offset
+  //! @param visitor
+  template <typename Visitor>
+  void for_each_neighbour( const Cmp::Position &pos, QueryCompass offset, Visitor &&visitor ) const
+  {
+    auto [cx, cy] = cell( pos );
+    for ( auto [dx, dy] : offsets( offset ) )
+    {
+      for ( auto e : find_bucket( cx + dx, cy + dy ) )
+      {
+        if ( not visit( visitor, e ) ) return;
+      }
+    }
+  }
+
+  //! @brief Get the cell offsets visited for `offset`, including self at index 0
+  //! @param offset
+  //! @return std::span<const std::pair<int, int>>
+  static constexpr std::span<const std::pair<int, int>> offsets( QueryCompass offset )
+  {
+    switch ( offset )
+    {
+      case QueryCompass::CARDINAL:
+        return kCardinalOffsets;
+      case QueryCompass::ORDINAL:
+        return kOrdinalOffsets;
+      case QueryCompass::BOTH:
+        break;
+    }
+    return kAllOffsets;
+  }
+
+  //! @brief Number of non-empty buckets
+  size_t size() const;
+
+  //! @brief Convert pixel coords into cell coords
+  //! @param pos
+  //! @return std::pair<int, int>
+  static std::pair<int, int> cell( const Cmp::Position &pos );
+
+  //! @brief Incremented by every `insert()`/`remove()`. Lets cached navmesh queries (i.e. FlowField) detect topology changes.
+  std::size_t version() const { return m_version; }
+
+  //! @brief Inclusive min/max cell coords of every bucket inserted so far.
+  //! Used to size flat, grid-indexed lookups such as the AStar node pool.
+  //! @return std::pair<sf::Vector2i, sf::Vector2i> min, max. max < min when the grid is empty.
+  std::pair<sf::Vector2i, sf::Vector2i> cell_bounds() const { return { m_min_cell, m_max_cell }; }
 
 private:
   //! @brief dimensions of a single cell in the game area grid
   static constexpr float m_cell_size{ Constants::kGridSizePxF.x };
 
-  //! @brief spatial encoding of coords --> multiple entt bucket
+  //! @brief Bucket storage for a cell inside the dense bounds. Once a cell has more than `kInlineCellCapacity`
+  //! entities its bucket moves to `m_grid` for good.
+  struct DenseCell
+  {
+    std::array<entt::entity, kInlineCellCapacity> entities{};
+    std::uint8_t count{ 0 };
+    bool spilled{ false };
+  };
+
+  //! @brief row-major dense cells, empty when the grid is unbounded
+  std::vector<DenseCell> m_dense;
+  sf::Vector2i m_dense_size{ 0, 0 };
+
+  //! @brief spatial encoding of coords --> multiple entt bucket, for cells outside the dense bounds or spilled dense cells
   std::unordered_map<long long, std::vector<entt::entity>> m_grid;
 
-  //! @brief Convert pixel coords into cell coords
-  //! @param pos
-  //! @return std::pair<int, int>
-  std::pair<int, int> cell( const Cmp::Position &pos ) const;
+  //! @brief see `version()`
+  std::size_t m_version{ 0 };
+
+  //! @brief bounding box of inserted cells, see `cell_bounds()`
+  sf::Vector2i m_min_cell{ std::numeric_limits<int>::max(), std::numeric_limits<int>::max() };
+  sf::Vector2i m_max_cell{ std::numeric_limits<int>::min(), std::numeric_limits<int>::min() };
 
   //! @brief Creates a bijective encoding of two x/y inputs into one output
   //! @param x
   //! @param y
   //! @return long long Packed x and y
   long long encode( int x, int y ) const;
+
+  //! @brief Get the bucket for cell x/y
+  //! @return std::span<const entt::entity> empty if the bucket does not exist
+  std::span<const entt::entity> find_bucket( int x, int y ) const;
+
+  //! @brief Get the dense cell for cell x/y
+  //! @return DenseCell* or nullptr if x/y is outside the dense bounds
+  DenseCell *dense_cell( int x, int y );
+  const DenseCell *dense_cell( int x, int y ) const;
+
+  //! @brief Invoke a query visitor, normalising void/bool return types
+  //! @return false if the visitor asked to stop
+  template <typename Visitor>
+  static bool visit( Visitor &visitor, entt::entity e )
+  {
+    if constexpr ( std::is_same_v<std::invoke_result_t<Visitor &, entt::entity>, bool> ) { return visitor( e ); }
+    else
+    {
+      visitor( e );
+      return true;
+    }
+  }
+
+  //! @brief Registry context entry for `track()`
+  struct Tracker
+  {
+    std::weak_ptr<SpatialHashGrid> navmesh;
+    static void on_destroy( entt::registry &reg, entt::entity e );
+  };
+
+  //! @brief bucket insert/remove without touching `m_version`
+  void do_insert( entt::entity e, std::pair<int, int> cell_coords );
+  void do_remove( entt::entity e, std::pair<int, int> cell_coords );
 };
 
 } // namespace ProceduralMaze::PathFinding
@@ -1,9 +1,9 @@
 #include <Player/PlayerLevelDepth.hpp>
 #include <Stats/PlayerStats.hpp>
-#ifdef SPDLOG_ACTIVE_LEVEL
-#undef SPDLOG_ACTIVE_LEVEL
-#endif
+// Release builds set the level floor on the command line (see src/CMakeLists.txt), which must win over this
+#ifndef SPDLOG_ACTIVE_LEVEL
 #define SPDLOG_ACTIVE_LEVEL SPDLOG_LEVEL_DEBUG
+#endif
 
 #include <spdlog/spdlog.h>
 
@@ -3,6 +3,7 @@
 #include <Components/Persistent/PlayerStartPosition.hpp>
 #include <Components/Player/PlayerKeysCount.hpp>
 #include <Components/Ruin/RuinObjectiveType.hpp>
+#include <Debug/Profiler.hpp>
 #include <SceneControl/IScene.hpp>
 #include <SceneControl/RegistryTransfer.hpp>
 #include <SceneControl/Scene.hpp>
@@ -41,6 +42,7 @@ SceneManager::SceneManager( sf::RenderWindow &w, Audio::SoundBank &sound_bank, S
 
 void SceneManager::update( sf::Time dt )
 {
+  PROFILE_ZONE( "SceneManager::update" );
 
   if ( m_scene_stack.empty() ) return;
 
@@ -60,7 +62,7 @@ void SceneManager::push( std::unique_ptr<IScene> new_scene, RegCopyMode mode )
   if ( not m_scene_stack.empty() )
   {
     reg_copy = m_reg_xfer.copy_reg( m_scene_stack.current(), mode );
-    loading_screen( [&]() { m_scene_stack.current().on_exit(); }, m_splash_texture );
+    loading_screen( [&]() { m_scene_stack.current().on_exit(); } );
   }
 
   m_scene_stack.push( std::move( new_scene ) );
@@ -75,8 +77,8 @@ void SceneManager::push( std::unique_ptr<IScene> new_scene, RegCopyMode mode )
     m_reg_xfer.xfer_component_entt<Cmp::RuinObjectiveType>( *reg_copy, m_scene_stack.current().registry() );
   }
 
-  loading_screen( [&]() { m_scene_stack.current().on_init(); }, m_splash_texture );
-  loading_screen( [&]() { m_scene_stack.current().on_enter(); }, m_splash_texture );
+  loading_screen( [&]() { m_scene_stack.current().on_init(); } );
+  loading_screen( [&]() { m_scene_stack.current().on_enter(); } );
 }
 
 void SceneManager::push_no_exit( std::unique_ptr<IScene> new_scene, RegCopyMode mode )
@@ -98,8 +100,8 @@ void SceneManager::push_no_exit( std::unique_ptr<IScene> new_scene, RegCopyMode
     m_reg_xfer.xfer_component_entt<Cmp::RuinObjectiveType>( *reg_copy, m_scene_stack.current().registry() );
   }
 
-  loading_screen( [&]() { m_scene_stack.current().on_init(); }, m_splash_texture );
-  loading_screen( [&]() { m_scene_stack.current().on_enter(); }, m_splash_texture );
+  loading_screen( [&]() { m_scene_stack.current().on_init(); } );
+  loading_screen( [&]() { m_scene_stack.current().on_enter(); } );
 }
 
 void SceneManager::pop( RegCopyMode mode )
@@ -107,7 +109,7 @@ void SceneManager::pop( RegCopyMode mode )
   if ( m_scene_stack.size() == 1 ) return;
 
   RegistryTransfer::RegCopy reg_copy = m_reg_xfer.copy_reg( m_scene_stack.current(), mode );
-  loading_screen( [&]() { m_scene_stack.current().on_exit(); }, m_splash_texture );
+  loading_screen( [&]() { m_scene_stack.current().on_exit(); } );
 
   m_scene_stack.pop();
   m_scene_stack.print_stack();
@@ -123,7 +125,7 @@ void SceneManager::pop( RegCopyMode mode )
 
   if ( !m_scene_stack.empty() )
   {
-    loading_screen( [&]() { m_scene_stack.current().on_enter(); }, m_splash_texture );
+    loading_screen( [&]() { m_scene_stack.current().on_enter(); } );
   }
 }
 
@@ -145,7 +147,7 @@ void SceneManager::pop_no_exit( RegCopyMode mode )
     m_reg_xfer.xfer_component_entt<Cmp::RuinObjectiveType>( *reg_copy, m_scene_stack.current().registry() );
   }
 
-  loading_screen( [&]() { m_scene_stack.current().on_enter(); }, m_splash_texture );
+  loading_screen( [&]() { m_scene_stack.current().on_enter(); } );
 }
 
 void SceneManager::replace( std::unique_ptr<IScene> new_scene, RegCopyMode mode )
@@ -153,7 +155,7 @@ void SceneManager::replace( std::unique_ptr<IScene> new_scene, RegCopyMode mode
   RegistryTransfer::RegCopy reg_copy = m_reg_xfer.copy_reg( m_scene_stack.current(), mode );
 
   // exit the current scene before popping
-  loading_screen( [&]() { m_scene_stack.current().on_exit(); }, m_splash_texture );
+  loading_screen( [&]() { m_scene_stack.current().on_exit(); } );
 
   // replace the current scene
   m_scene_stack.print_stack();
@@ -171,8 +173,8 @@ void SceneManager::replace( std::unique_ptr<IScene> new_scene, RegCopyMode mode
     m_reg_xfer.xfer_component_entt<Cmp::RuinObjectiveType>( *reg_copy, m_scene_stack.current().registry() );
   }
 
-  loading_screen( [&]() { m_scene_stack.current().on_init(); }, m_splash_texture );
-  loading_screen( [&]() { m_scene_stack.current().on_enter(); }, m_splash_texture );
+  loading_screen( [&]() { m_scene_stack.current().on_init(); } );
+  loading_screen( [&]() { m_scene_stack.current().on_enter(); } );
 }
 
 void SceneManager::replace_no_exit( std::unique_ptr<IScene> new_scene, RegCopyMode mode )
@@ -195,8 +197,8 @@ void SceneManager::replace_no_exit( std::unique_ptr<IScene> new_scene, RegCopyMo
     m_reg_xfer.xfer_component_entt<Cmp::RuinObjectiveType>( *reg_copy, m_scene_stack.current().registry() );
   }
 
-  loading_screen( [&]() { m_scene_stack.current().on_init(); }, m_splash_texture );
-  loading_screen( [&]() { m_scene_stack.current().on_enter(); }, m_splash_texture );
+  loading_screen( [&]() { m_scene_stack.current().on_init(); } );
+  loading_screen( [&]() { m_scene_stack.current().on_enter(); } );
 }
 
 void SceneManager::handle_events( const Events::SceneManagerEvent &event )
@@ -274,6 +276,7 @@ void SceneManager::handle_events( const Events::SceneManagerEvent &event )
     }
     case Events::SceneManagerEvent::Type::EXIT_GAME: {
       SPDLOG_INFO( "SceneManager: Events::SceneManagerEvent::Type::EXIT_GAME requested" );
+      m_exit_requested = true;
       m_window.close();
       break;
     }
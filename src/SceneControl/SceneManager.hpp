@@ -12,8 +12,10 @@
 #include <SceneControl/RegistryTransfer.hpp>
 #include <SceneControl/SceneStack.hpp>
 #include <Systems/BaseSystem.hpp>
+#include <Systems/Render/RenderSystem.hpp>
 #include <Systems/SystemStore.hpp>
 
+#include <Utils/AssetLoader.hpp>
 #include <Utils/Constants.hpp>
 #include <future>
 #include <memory>
@@ -51,14 +53,24 @@ public:
   // Event handler for scene manager events
   void handle_events( const Events::SceneManagerEvent &event );
 
+  //! @brief True once an EXIT_GAME event has been handled. A headless run has no window to close, so it checks this instead.
+  bool exit_requested() const { return m_exit_requested; }
+
 private:
   // Helper function to inject the current scene's registry into the system store
   void inject_current_scene_registry_into_systems();
 
   // Loading screen implementation
   template <typename Callable>
-  void loading_screen( Callable &&callable, [[maybe_unused]] const sf::Texture &loading_texture )
+  void loading_screen( Callable &&callable )
   {
+    // nothing to show in a headless run, so just do the work
+    if ( Sys::RenderSystem::is_headless() )
+    {
+      callable();
+      return;
+    }
+
     Cmp::Font font( "res/fonts/tuffy.ttf" );
     sf::Text loading_text( font, "Loading", 48 );
     loading_text.setFillColor( sf::Color::White );
@@ -89,11 +101,15 @@ private:
       if ( clock.getElapsedTime().asSeconds() >= text_update_interval )
       {
         dot_count = ( dot_count + 1 ) % 4; // Cycle 0 -> 1 -> 2 -> 3 -> 0
-        std::string dots( dot_count, '.' );
-        loading_text.setString( "Loading" + dots );
         clock.restart();
       }
 
+      // Add the asset loader progress, if assets are loading
+      std::string dots( dot_count, '.' );
+      const auto progress = Utils::AssetLoader::progress();
+      if ( progress.total == 0 ) { loading_text.setString( "Loading" + dots ); }
+      else { loading_text.setString( "Loading" + dots + " " + std::to_string( progress.done ) + "/" + std::to_string( progress.total ) ); }
+
       m_window.clear( sf::Color::Black );
       m_window.draw( loading_text );
       m_window.display();
@@ -115,9 +131,6 @@ private:
   // Scene stack managing active scenes
   SceneStack m_scene_stack;
 
-  // Splash screen texture
-  sf::Texture m_splash_texture{ "res/textures/splash.png" };
-
   //! @brief Non-owning reference to the navigation event dispatcher
   entt::dispatcher &m_nav_event_dispatcher;
 
@@ -128,6 +141,9 @@ private:
   RegistryTransfer m_reg_xfer;
 
   Sprites::SpriteFactory &m_sprite_factory;
+
+  //! @brief Set by the EXIT_GAME event
+  bool m_exit_requested{ false };
 };
 
 } // namespace ProceduralMaze::Scene
@@ -26,6 +26,7 @@
 #include <Systems/Threats/NpcSystem.hpp>
 #include <Systems/Threats/ShockwaveSystem.hpp>
 #include <Utils/Player.hpp>
+#include <Utils/RngStreams.hpp>
 
 namespace ProceduralMaze::Scene
 {
@@ -38,6 +39,7 @@ void CryptScene::on_init()
   m_persistent_sys.load_state();
 
   m_scene_map_data = std::make_shared<SceneData>( "res/scenes/crypt.json" );
+  Utils::Rnd::RngStreams::begin_level( "res/scenes/crypt.json" );
   SPDLOG_INFO( "get_floor_image: {}", m_scene_map_data->floor_tileset_image().string() );
   SPDLOG_INFO( "levelgen_tilelayer size: {}", m_scene_map_data->levelgen_tilelayer().size() );
 
@@ -51,13 +53,13 @@ void CryptScene::on_init()
 
   auto [map_size_grid, map_size_pixel] = m_scene_map_data->map_size();
 
-  Factory::Shader::add_dark( m_sys.find<Sys::Store::Type::ShaderSystem>(), map_size_pixel );
+  Factory::Shader::add_dark( m_sys.find<Sys::Store::Type::ShaderSystem>() );
 
   // create the empty game area
   auto player_start_position = Sys::PersistSystem::get<Cmp::Persist::PlayerStartPosition>( m_reg );
   auto player_start_area = Cmp::RectBounds::scaled( player_start_position, Constants::kGridSizePxF, 3.f, Cmp::RectBounds::ScaleAxis::XY );
   auto &random_level_sys = m_sys.find<Sys::Store::Type::RandomLevelGenerator>();
-  random_level_sys.reset();
+  random_level_sys.reset( map_size_grid );
   random_level_sys.gen_game_area( *m_scene_map_data );
   m_sys.find<Sys::Store::Type::PassageSystem>().init_scene_data( m_scene_map_data );
 
@@ -70,11 +72,12 @@ void CryptScene::on_init()
   m_sys.find<Sys::Store::Type::CryptSystem>().gen_crypt_initial_interior();
 
   // create a navmesh for pathfinding in the scene
-  m_pathfinding_navmesh = std::make_shared<PathFinding::SpatialHashGrid>();
+  m_pathfinding_navmesh = std::make_shared<PathFinding::SpatialHashGrid>( map_size_grid );
   for ( auto [pos_entt, pos_cmp] : m_reg.view<Cmp::Position>( entt::exclude<Cmp::NpcNoPathFinding> ).each() )
   {
     m_pathfinding_navmesh->insert( pos_entt, pos_cmp );
   }
+  PathFinding::SpatialHashGrid::track( m_reg, m_pathfinding_navmesh );
   m_sys.find<Sys::Store::Type::NpcSystem>().init( m_pathfinding_navmesh );
   m_sys.find<Sys::Store::Type::PassageSystem>().init_nav_mesh( m_pathfinding_navmesh );
   m_sys.find<Sys::Store::Type::CryptSystem>().init( m_pathfinding_navmesh );
@@ -138,6 +141,6 @@ void CryptScene::do_update( sf::Time dt )
 
 entt::registry &CryptScene::registry() { return m_reg; }
 
-sf::Clock CryptScene::s_maze_timer;
+Utils::GameClock CryptScene::s_maze_timer;
 
 } // namespace ProceduralMaze::Scene
\ No newline at end of file
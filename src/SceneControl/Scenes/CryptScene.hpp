@@ -1,7 +1,7 @@
 #ifndef SCENE_CRYPTSCENE_HPP_
 #define SCENE_CRYPTSCENE_HPP_
 
-#include <SFML/System/Clock.hpp>
+#include <Utils/GameClock.hpp>
 #include <SFML/System/Vector2.hpp>
 #include <SceneControl/Events/ProcessCryptSceneInputEvent.hpp>
 #include <SceneControl/Scene.hpp>
@@ -35,7 +35,7 @@ public:
 
   entt::registry &registry() override;
 
-  static sf::Clock &get_maze_timer() { return s_maze_timer; }
+  static Utils::GameClock &get_maze_timer() { return s_maze_timer; }
   static bool is_maze_timer_expired() { return s_maze_timer.getElapsedTime() > s_maze_timer_cooldown ? true : false; }
   static void stop_maze_timer() { s_maze_timer.reset(); }
 
@@ -47,7 +47,7 @@ private:
   Sys::Store &m_sys;
   Sprites::SpriteFactory &m_sprite_factory;
 
-  static sf::Clock s_maze_timer;
+  static Utils::GameClock s_maze_timer;
   constexpr static sf::Time s_maze_timer_cooldown{ sf::seconds( 10.f ) };
 };
 
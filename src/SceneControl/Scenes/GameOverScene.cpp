@@ -1,5 +1,6 @@
 #include <SceneControl/Scenes/GameOverScene.hpp>
 
+#include <Audio/Effects.hpp>
 #include <Audio/SoundBank.hpp>
 #include <SceneControl/Events/ProcessGameoverSceneInputEvent.hpp>
 #include <Systems/PersistSystemImpl.hpp>
@@ -17,7 +18,7 @@ void GameOverScene::on_enter()
   auto &persistent_sys = static_cast<Sys::PersistSystem &>( m_sys.find<Sys::Store::Type::PersistSystem>() );
   persistent_sys.initialize_component_registry();
   persistent_sys.load_state();
-  m_sound_bank.get_effect( "bubbling_lava" ).stop();
+  m_sound_bank.stop( Audio::Effect::kBubblingLava );
 }
 void GameOverScene::on_exit()
 {
@@ -30,7 +31,7 @@ void GameOverScene::on_exit()
 
 void GameOverScene::do_update( [[maybe_unused]] sf::Time dt )
 {
-  m_sound_bank.get_effect( "footsteps" ).stop();
+  m_sound_bank.stop( Audio::Effect::kFootsteps );
 
   auto &render_menu_sys = m_sys.find<Sys::Store::Type::RenderMenuSystem>();
   render_menu_sys.render_defeat_screen();
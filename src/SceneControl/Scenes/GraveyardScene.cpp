@@ -37,6 +37,7 @@
 #include <Systems/PersistSystemImpl.hpp>
 #include <Systems/PlayerSystem.hpp>
 #include <Systems/ProcGen/CellAutomataSystem.hpp>
+#include <Systems/ProcGen/LevelCache.hpp>
 #include <Systems/ProcGen/RandomLevelGenerator.hpp>
 #include <Systems/Render/RenderOverlaySystem.hpp>
 #include <Systems/Render/RenderSystem.hpp>
@@ -50,6 +51,7 @@
 #include <Utils.hpp>
 #include <Utils/Constants.hpp>
 #include <Utils/Player.hpp>
+#include <Utils/RngStreams.hpp>
 
 #include <ZOrderValue.hpp>
 #include <memory>
@@ -73,6 +75,7 @@ void GraveyardScene::on_init()
 
   // create the level contents
   m_scene_map_data = std::make_shared<SceneData>( "res/scenes/graveyard.json" );
+  auto level_seed = Utils::Rnd::RngStreams::begin_level( "res/scenes/graveyard.json" );
   auto [_, player_start_pos_px] = m_scene_map_data->get_player_start_position();
   Sys::PersistSystem::add<Cmp::Persist::PlayerStartPosition>( m_reg, player_start_pos_px );
   auto player_start_position = Sys::PersistSystem::get<Cmp::Persist::PlayerStartPosition>( m_reg );
@@ -91,29 +94,39 @@ void GraveyardScene::on_init()
   SPDLOG_INFO( "m_scene_map_data {},{} {},{}", map_size_grid.x, map_size_grid.y, map_size_pixel.x, map_size_pixel.y );
 
   Factory::Shader::add_water( m_sys.find<Sys::Store::Type::ShaderSystem>(), map_size_pixel );
-  Factory::Shader::add_mist( m_sys.find<Sys::Store::Type::ShaderSystem>(), map_size_pixel );
-  Factory::Shader::add_night_static( m_sys.find<Sys::Store::Type::ShaderSystem>(), map_size_pixel );
+  Factory::Shader::add_mist( m_sys.find<Sys::Store::Type::ShaderSystem>() );
+  Factory::Shader::add_night_static( m_sys.find<Sys::Store::Type::ShaderSystem>() );
 
   auto &random_level_sys = m_sys.find<Sys::Store::Type::RandomLevelGenerator>();
-  random_level_sys.reset();
-  random_level_sys.gen_game_area( *m_scene_map_data );
+  random_level_sys.reset( map_size_grid );
 
-  random_level_sys.gen_graveyard_exterior_multiblocks();
-  Factory::gen_loot_containers( m_reg, m_sprite_factory, map_size_grid );
-  Factory::gen_npc_containers( m_reg, m_sprite_factory, map_size_grid );
-  random_level_sys.gen_random_plants( map_size_grid );
-  random_level_sys.gen_graveyard_exterior_obstacles();
+  // reuse the level from a previous run with the same seed if there is one, otherwise generate and cache it
+  Sys::ProcGen::LevelCache level_cache( m_reg, level_seed, "res/scenes/graveyard.json" );
+  if ( level_cache.load() ) { random_level_sys.rebuild_void_sm(); }
+  else
+  {
+    random_level_sys.gen_game_area( *m_scene_map_data );
 
-  // now use cellular automata on the exterior obstacles
-  auto &cellauto_parser = m_sys.find<Sys::Store::Type::CellAutomataSystem>();
-  cellauto_parser.iterate( 5, Sys::ProcGen::RandomLevelGenerator::SceneType::GRAVEYARD_EXTERIOR, random_level_sys.get_obstacle_sm() );
+    random_level_sys.gen_graveyard_exterior_multiblocks();
+    Factory::gen_loot_containers( m_reg, m_sprite_factory, map_size_grid );
+    Factory::gen_npc_containers( m_reg, m_sprite_factory, map_size_grid );
+    random_level_sys.gen_random_plants( map_size_grid );
+    random_level_sys.gen_graveyard_exterior_obstacles();
+
+    // now use cellular automata on the exterior obstacles
+    auto &cellauto_parser = m_sys.find<Sys::Store::Type::CellAutomataSystem>();
+    cellauto_parser.smooth( Sys::ProcGen::RandomLevelGenerator::SceneType::GRAVEYARD_EXTERIOR, random_level_sys.get_obstacle_sm() );
+
+    level_cache.save();
+  }
 
   // create a navmesh for pathfinding in the scene
-  m_pathfinding_navmesh = std::make_shared<PathFinding::SpatialHashGrid>();
+  m_pathfinding_navmesh = std::make_shared<PathFinding::SpatialHashGrid>( map_size_grid );
   for ( auto [pos_entt, pos_cmp] : m_reg.view<Cmp::Position>( entt::exclude<Cmp::NpcNoPathFinding> ).each() )
   {
     m_pathfinding_navmesh->insert( pos_entt, pos_cmp );
   }
+  PathFinding::SpatialHashGrid::track( m_reg, m_pathfinding_navmesh );
   reinit_navmesh();
 
   // create floor background
@@ -150,12 +163,8 @@ void GraveyardScene::on_enter()
   m_persistent_sys.initialize_component_registry();
   m_persistent_sys.load_state();
 
-  m_sound_bank.get_music( "title_music" ).stop();
-  if ( m_sound_bank.get_music( "game_music" ).getStatus() != sf::Sound::Status::Playing )
-  {
-    m_sound_bank.get_music( "game_music" ).play();
-    m_sound_bank.get_music( "game_music" ).setLooping( true );
-  }
+  m_sound_bank.stop_music( "title_music" );
+  m_sound_bank.play_music( "game_music", true );
 
   // prevent residual lerp movements from previous scene causing havoc in the new one
   Utils::Player::remove_lerp_cmp( m_reg );
@@ -185,8 +194,8 @@ void GraveyardScene::on_exit()
 {
   SPDLOG_INFO( "Exiting {}", get_name() );
   m_reg.clear();
-  m_sound_bank.get_music( "game_music" ).stop();
-  m_sound_bank.get_music( "title_music" ).play();
+  m_sound_bank.stop_music( "game_music" );
+  m_sound_bank.play_music( "title_music", true );
 
   auto &m_player_sys = m_sys.find<Sys::Store::Type::PlayerSystem>();
   m_player_sys.stopFootstepsSound();
@@ -196,7 +205,7 @@ void GraveyardScene::on_exit()
     Factory::FloormapFactory::clear_floormap( floor_cmp );
   }
 
-  m_sound_bank.get_music( "game_music" ).stop();
+  m_sound_bank.stop_music( "game_music" );
 }
 
 void GraveyardScene::do_update( sf::Time dt )
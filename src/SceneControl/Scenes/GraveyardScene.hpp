@@ -8,6 +8,7 @@
 #include <Sprites/TileMap.hpp>
 #include <Systems/BaseSystem.hpp>
 #include <Utils/Utils.hpp>
+#include <Utils/GameClock.hpp>
 
 // clang-format off
 namespace ProceduralMaze::Sys { class Store; }
@@ -44,7 +45,7 @@ private:
   Sys::Store &m_sys;
   Sprites::SpriteFactory &m_sprite_factory;
 
-  sf::Clock m_scene_exit_cooldown{};
+  Utils::GameClock m_scene_exit_cooldown{};
   sf::Time m_scene_exit_cooldown_time{ sf::seconds( 2 ) };
 
   void reinit_navmesh();
@@ -23,6 +23,7 @@
 #include <Systems/Render/RenderOverlaySystem.hpp>
 #include <Systems/SystemStore.hpp>
 #include <Systems/Threats/NpcSystem.hpp>
+#include <Utils/RngStreams.hpp>
 
 namespace ProceduralMaze::Scene
 {
@@ -34,6 +35,7 @@ void HolyWellScene::on_init()
   m_persistent_sys.load_state();
 
   m_scene_map_data = std::make_shared<SceneData>( "res/scenes/well.json" );
+  Utils::Rnd::RngStreams::begin_level( "res/scenes/well.json" );
   SPDLOG_INFO( "wall_tilelayer size: {}", m_scene_map_data->wall_tilelayer().size() );
 
   auto sys_cmp_entt = m_reg.create();
@@ -47,7 +49,7 @@ void HolyWellScene::on_init()
   sf::Vector2f player_start_position = Sys::PersistSystem::get<Cmp::Persist::PlayerStartPosition>( m_reg );
   auto player_start_area = Cmp::RectBounds::scaled( player_start_position, Constants::kGridSizePxF, 1.f, Cmp::RectBounds::ScaleAxis::XY );
   auto &random_level_sys = m_sys.find<Sys::Store::Type::RandomLevelGenerator>();
-  random_level_sys.reset();
+  random_level_sys.reset( m_scene_map_data->map_size().first );
   random_level_sys.gen_game_area( *m_scene_map_data );
 
   Sprites::Containers::TileMap floortiles;
@@ -57,11 +59,12 @@ void HolyWellScene::on_init()
   m_reg.emplace<Cmp::ZOrderValue>( floor_entity, -16.f );
 
   // create a navmesh for pathfinding in the scene
-  m_pathfinding_navmesh = std::make_shared<PathFinding::SpatialHashGrid>();
+  m_pathfinding_navmesh = std::make_shared<PathFinding::SpatialHashGrid>( m_scene_map_data->map_size().first );
   for ( auto [pos_entt, pos_cmp] : m_reg.view<Cmp::Position>( entt::exclude<Cmp::NpcNoPathFinding> ).each() )
   {
     m_pathfinding_navmesh->insert( pos_entt, pos_cmp );
   }
+  PathFinding::SpatialHashGrid::track( m_reg, m_pathfinding_navmesh );
   m_sys.find<Sys::Store::Type::NpcSystem>().init( m_pathfinding_navmesh );
   m_sys.find<Sys::Store::Type::PlayerSystem>().init( m_pathfinding_navmesh );
   m_sys.find<Sys::Store::Type::RenderOverlaySystem>().init( m_pathfinding_navmesh );
@@ -73,7 +76,7 @@ void HolyWellScene::on_init()
 void HolyWellScene::on_enter()
 {
   SPDLOG_INFO( "Entering {}", get_name() );
-  m_sound_bank.get_music( "game_music" ).stop();
+  m_sound_bank.stop_music( "game_music" );
 
   auto &m_persistent_sys = m_sys.find<Sys::Store::Type::PersistSystem>();
   m_persistent_sys.initialize_component_registry();
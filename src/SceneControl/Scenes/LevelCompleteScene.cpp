@@ -4,6 +4,7 @@
 #include <SFML/System/Time.hpp>
 #include <SceneControl/Scenes/LevelCompleteScene.hpp>
 
+#include <Audio/Effects.hpp>
 #include <Audio/SoundBank.hpp>
 #include <SceneControl/Events/ProcessLevelCompleteSceneInputEvent.hpp>
 #include <Systems/PersistSystemImpl.hpp>
@@ -21,8 +22,8 @@ void LevelCompleteScene::on_enter()
   auto &persistent_sys = m_sys.find<Sys::Store::Type::PersistSystem>();
   persistent_sys.initialize_component_registry();
   persistent_sys.load_state();
-  m_sound_bank.get_music( "game_music" ).stop();
-  m_sound_bank.get_music( "title_music" ).play();
+  m_sound_bank.stop_music( "game_music" );
+  m_sound_bank.play_music( "title_music", true );
 }
 
 void LevelCompleteScene::on_exit()
@@ -36,7 +37,7 @@ void LevelCompleteScene::on_exit()
 
 void LevelCompleteScene::do_update( sf::Time dt )
 {
-  m_sound_bank.get_effect( "footsteps" ).stop();
+  m_sound_bank.stop( Audio::Effect::kFootsteps );
 
   auto &wealth = Utils::Player::get_wealth( m_reg );
   auto &cadaver_count = Utils::Player::get_cadaver_count( m_reg );
@@ -49,7 +50,7 @@ void LevelCompleteScene::do_update( sf::Time dt )
     {
       cadaver_count.decrement_count( 1 );
       wealth.wealth += 10;
-      m_sound_bank.get_effect( "get_loot" ).play();
+      m_sound_bank.play( Audio::Effect::kGetLoot );
     }
     m_scorecheck_accumulator = sf::Time::Zero;
   }
@@ -31,6 +31,7 @@
 #include <Systems/Threats/NpcSystem.hpp>
 #include <Utils/Constants.hpp>
 #include <Utils/Player.hpp>
+#include <Utils/RngStreams.hpp>
 
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/System/Vector2.hpp>
@@ -48,6 +49,7 @@ void RuinSceneLowerFloor::on_init()
   m_persistent_sys.load_state();
 
   m_scene_map_data = std::make_shared<SceneData>( "res/scenes/ruinlower.json" );
+  Utils::Rnd::RngStreams::begin_level( "res/scenes/ruinlower.json" );
 
   auto sys_cmp_entt = m_reg.create();
   m_reg.emplace<Cmp::System>( sys_cmp_entt );
@@ -62,7 +64,7 @@ void RuinSceneLowerFloor::on_init()
   sf::Vector2f player_start_position = Sys::PersistSystem::get<Cmp::Persist::PlayerStartPosition>( m_reg );
   auto player_start_area = Cmp::RectBounds::scaled( player_start_position, gridsize, 1.f, Cmp::RectBounds::ScaleAxis::XY );
   auto &random_level_sys = m_sys.find<SystemStoreType::RandomLevelGenerator>();
-  random_level_sys.reset();
+  random_level_sys.reset( map_size_grid );
   random_level_sys.gen_game_area( *m_scene_map_data );
 
   // add access hitbox just above horizontal centerpoint
@@ -87,11 +89,12 @@ void RuinSceneLowerFloor::on_init()
   m_sys.find<Sys::Store::Type::RuinSystem>().reset_player_curse();
 
   // create a navmesh for pathfinding in the scene
-  m_pathfinding_navmesh = std::make_shared<PathFinding::SpatialHashGrid>();
+  m_pathfinding_navmesh = std::make_shared<PathFinding::SpatialHashGrid>( map_size_grid );
   for ( auto [pos_entt, pos_cmp] : m_reg.view<Cmp::Position>( entt::exclude<Cmp::NpcNoPathFinding> ).each() )
   {
     m_pathfinding_navmesh->insert( pos_entt, pos_cmp );
   }
+  PathFinding::SpatialHashGrid::track( m_reg, m_pathfinding_navmesh );
   m_sys.find<Sys::Store::Type::NpcSystem>().init( m_pathfinding_navmesh );
   m_sys.find<Sys::Store::Type::PlayerSystem>().init( m_pathfinding_navmesh );
   m_sys.find<Sys::Store::Type::RenderOverlaySystem>().init( m_pathfinding_navmesh );
@@ -108,17 +111,13 @@ void RuinSceneLowerFloor::on_enter()
   m_persistent_sys.initialize_component_registry();
   m_persistent_sys.load_state();
 
-  m_sound_bank.get_music( "game_music" ).stop();
+  m_sound_bank.stop_music( "game_music" );
 
   auto [inventory_entt, inventory_type] = Utils::Player::get_inventory_type( m_reg );
   if ( inventory_type != "sprite.item.witchesjar" )
   {
-    if ( m_sound_bank.get_music( "ruin_creaking_rope" ).getStatus() != sf::Sound::Status::Playing )
-    {
-      m_sound_bank.get_music( "ruin_creaking_rope" ).play();
-      m_sound_bank.get_music( "ruin_creaking_rope" ).setLooping( true );
-    }
-    if ( m_sound_bank.get_music( "ruin_music" ).getStatus() != sf::Sound::Status::Playing ) { m_sound_bank.get_music( "ruin_music" ).play(); }
+    m_sound_bank.play_music( "ruin_creaking_rope", true );
+    m_sound_bank.play_music( "ruin_music" );
   }
 
   m_sys.find<Sys::Store::Type::RenderGameSystem>().init_world_view();
@@ -160,8 +159,8 @@ void RuinSceneLowerFloor::on_enter()
 void RuinSceneLowerFloor::on_exit()
 {
   SPDLOG_INFO( "Exiting {}", get_name() );
-  m_sound_bank.get_music( "ruin_creaking_rope" ).stop();
-  m_sound_bank.get_music( "ruin_music" ).stop();
+  m_sound_bank.stop_music( "ruin_creaking_rope" );
+  m_sound_bank.stop_music( "ruin_music" );
 
   m_reg.clear();
 
@@ -188,7 +187,7 @@ void RuinSceneLowerFloor::do_update( [[maybe_unused]] sf::Time dt )
   if ( is_player_cursed )
   {
     m_sys.find<Store::Type::RuinSystem>().check_create_witch( m_reg, sf::FloatRect( { 0, 0 }, map_size_pixel ) );
-    // Factory::Shader::add_curse( m_sys.find<Sys::Store::Type::ShaderSystem>(), map_size_pixel );
+    // Factory::Shader::add_curse( m_sys.find<Sys::Store::Type::ShaderSystem>() );
   }
 
   // `check_exit_collision()` may reset the player curse so it must be called after `check_activate_player_curse()`
@@ -31,6 +31,7 @@
 #include <Systems/Threats/NpcSystem.hpp>
 #include <Utils/Constants.hpp>
 #include <Utils/Player.hpp>
+#include <Utils/RngStreams.hpp>
 
 namespace ProceduralMaze::Scene
 {
@@ -45,6 +46,7 @@ void RuinSceneUpperFloor::on_init()
   m_persistent_sys.load_state();
 
   m_scene_map_data = std::make_shared<SceneData>( "res/scenes/ruinupper.json" );
+  Utils::Rnd::RngStreams::begin_level( "res/scenes/ruinupper.json" );
 
   auto sys_cmp_entt = m_reg.create();
   m_reg.emplace<Cmp::System>( sys_cmp_entt );
@@ -59,7 +61,7 @@ void RuinSceneUpperFloor::on_init()
   sf::Vector2f player_start_pos = PersistSystem::get<Cmp::Persist::PlayerStartPosition>( m_reg );
   auto player_start_area = Cmp::RectBounds::scaled( player_start_pos, gridsize, 1.f, Cmp::RectBounds::ScaleAxis::XY );
   auto &random_level_sys = m_sys.find<Store::Type::RandomLevelGenerator>();
-  random_level_sys.reset();
+  random_level_sys.reset( map_size_grid );
   random_level_sys.gen_game_area( *m_scene_map_data );
 
   // add access hitbox just below horizontal centerpoint
@@ -74,11 +76,12 @@ void RuinSceneUpperFloor::on_init()
   m_reg.emplace<Cmp::ZOrderValue>( floor_entity, -16.f );
 
   // create a navmesh for pathfinding in the scene
-  m_pathfinding_navmesh = std::make_shared<PathFinding::SpatialHashGrid>();
+  m_pathfinding_navmesh = std::make_shared<PathFinding::SpatialHashGrid>( map_size_grid );
   for ( auto [pos_entt, pos_cmp] : m_reg.view<Cmp::Position>( entt::exclude<Cmp::NpcNoPathFinding> ).each() )
   {
     m_pathfinding_navmesh->insert( pos_entt, pos_cmp );
   }
+  PathFinding::SpatialHashGrid::track( m_reg, m_pathfinding_navmesh );
   m_sys.find<Sys::Store::Type::NpcSystem>().init( m_pathfinding_navmesh );
   m_sys.find<Sys::Store::Type::PlayerSystem>().init( m_pathfinding_navmesh );
   m_sys.find<Sys::Store::Type::RenderOverlaySystem>().init( m_pathfinding_navmesh );
@@ -91,12 +94,8 @@ void RuinSceneUpperFloor::on_enter()
   auto [inventory_entt, inventory_type] = Utils::Player::get_inventory_type( m_reg );
   if ( inventory_type != "sprite.item.witchesjar" )
   {
-    if ( m_sound_bank.get_music( "ruin_creaking_rope" ).getStatus() != sf::Sound::Status::Playing )
-    {
-      m_sound_bank.get_music( "ruin_creaking_rope" ).play();
-      m_sound_bank.get_music( "ruin_creaking_rope" ).setLooping( true );
-    }
-    if ( m_sound_bank.get_music( "ruin_music" ).getStatus() != sf::Sound::Status::Playing ) { m_sound_bank.get_music( "ruin_music" ).play(); }
+    m_sound_bank.play_music( "ruin_creaking_rope", true );
+    m_sound_bank.play_music( "ruin_music" );
   }
   auto &m_persistent_sys = m_sys.find<Sys::Store::Type::PersistSystem>();
   m_persistent_sys.initialize_component_registry();
@@ -123,8 +122,8 @@ void RuinSceneUpperFloor::on_enter()
 void RuinSceneUpperFloor::on_exit()
 {
   SPDLOG_INFO( "Exiting {}", get_name() );
-  m_sound_bank.get_music( "ruin_creaking_rope" ).stop();
-  m_sound_bank.get_music( "ruin_music" ).stop();
+  m_sound_bank.stop_music( "ruin_creaking_rope" );
+  m_sound_bank.stop_music( "ruin_music" );
   m_reg.clear();
 }
 
@@ -143,7 +142,7 @@ void RuinSceneUpperFloor::do_update( sf::Time dt )
 
   auto [_, map_size_pixel] = m_scene_map_data->map_size();
   // bool player_curse_active = m_sys.find<Store::Type::RuinSystem>().check_activate_player_curse( map_size_pixel );
-  // if ( player_curse_active ) { Factory::Shader::add_curse( m_sys.find<Sys::Store::Type::ShaderSystem>(), map_size_pixel ); }
+  // if ( player_curse_active ) { Factory::Shader::add_curse( m_sys.find<Sys::Store::Type::ShaderSystem>() ); }
 
   m_sys.find<Store::Type::RuinSystem>().update_shadow_hand_pos( map_size_pixel );
   // m_sys.find<Store::Type::RuinSystem>().check_player_shadow_hand_collision( dt );
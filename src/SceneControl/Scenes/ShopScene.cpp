@@ -26,6 +26,7 @@
 #include <Systems/ShopSystem.hpp>
 #include <Systems/SystemStore.hpp>
 #include <Systems/Threats/NpcSystem.hpp>
+#include <Utils/RngStreams.hpp>
 
 namespace ProceduralMaze::Scene
 {
@@ -37,6 +38,7 @@ void ShopScene::on_init()
   m_persistent_sys.load_state();
 
   m_scene_map_data = std::make_shared<SceneData>( "res/scenes/shop.json" );
+  Utils::Rnd::RngStreams::begin_level( "res/scenes/shop.json" );
 
   auto &shop_sys = m_sys.find<Sys::Store::Type::ShopSystem>();
   shop_sys.load_config( "res/json/shop_overlay_config.json" );
@@ -56,7 +58,7 @@ void ShopScene::on_init()
   sf::Vector2f player_start_position = Sys::PersistSystem::get<Cmp::Persist::PlayerStartPosition>( m_reg );
   auto player_start_area = Cmp::RectBounds::scaled( player_start_position, Constants::kGridSizePxF, 1.f, Cmp::RectBounds::ScaleAxis::XY );
   auto &random_level_sys = m_sys.find<Sys::Store::Type::RandomLevelGenerator>();
-  random_level_sys.reset();
+  random_level_sys.reset( m_scene_map_data->map_size().first );
   random_level_sys.gen_game_area( *m_scene_map_data );
 
   m_floormap.create( random_level_sys.get_void_sm(), m_scene_map_data );
@@ -65,11 +67,12 @@ void ShopScene::on_init()
   m_reg.emplace<Cmp::ZOrderValue>( floor_entity, -16.f );
 
   // create a navmesh for pathfinding in the scene
-  m_pathfinding_navmesh = std::make_shared<PathFinding::SpatialHashGrid>();
+  m_pathfinding_navmesh = std::make_shared<PathFinding::SpatialHashGrid>( m_scene_map_data->map_size().first );
   for ( auto [pos_entt, pos_cmp] : m_reg.view<Cmp::Position>( entt::exclude<Cmp::NpcNoPathFinding> ).each() )
   {
     m_pathfinding_navmesh->insert( pos_entt, pos_cmp );
   }
+  PathFinding::SpatialHashGrid::track( m_reg, m_pathfinding_navmesh );
   m_sys.find<Sys::Store::Type::NpcSystem>().init( m_pathfinding_navmesh );
   m_sys.find<Sys::Store::Type::PlayerSystem>().init( m_pathfinding_navmesh );
   m_sys.find<Sys::Store::Type::RenderOverlaySystem>().init( m_pathfinding_navmesh );
@@ -85,7 +88,7 @@ void ShopScene::on_init()
 void ShopScene::on_enter()
 {
   SPDLOG_INFO( "Entering {}", get_name() );
-  m_sound_bank.get_music( "game_music" ).stop();
+  m_sound_bank.stop_music( "game_music" );
 
   auto &m_persistent_sys = m_sys.find<Sys::Store::Type::PersistSystem>();
   m_persistent_sys.initialize_component_registry();
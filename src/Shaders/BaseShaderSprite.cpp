@@ -4,8 +4,10 @@
 namespace ProceduralMaze::Sprites
 {
 
-BaseShaderSprite::BaseShaderSprite( std::filesystem::path vertex_shader_path, std::filesystem::path frag_shader_path, sf::Vector2u texture_size )
-    : m_render_texture( texture_size ),
+BaseShaderSprite::BaseShaderSprite( std::filesystem::path vertex_shader_path, std::filesystem::path frag_shader_path, sf::Vector2u texture_size,
+                                    sf::Color fill )
+    : m_render_texture( RenderTexturePool::acquire( texture_size, fill ) ),
+      m_fill( fill ),
       m_vert_shader_path( std::move( vertex_shader_path ) ),
       m_frag_shader_path( std::move( frag_shader_path ) )
 {
@@ -13,8 +15,6 @@ BaseShaderSprite::BaseShaderSprite( std::filesystem::path vertex_shader_path, st
 
 void BaseShaderSprite::setup()
 {
-  pre_setup_texture();
-  m_render_texture.display();
   load_shader_files();
   post_setup_shader();
 }
@@ -41,12 +41,11 @@ void BaseShaderSprite::load_shader_files()
 
 void BaseShaderSprite::set_position( const sf::Vector2f &position ) { m_sprite.setPosition( position ); }
 void BaseShaderSprite::setPosition( const sf::Vector2f &position ) { set_position( position ); }
-void BaseShaderSprite::set_texture_view( sf::View view_update ) { m_render_texture.setView( view_update ); }
 void BaseShaderSprite::resize_texture( sf::Vector2u new_size )
 {
-  [[maybe_unused]] auto result = m_render_texture.resize( new_size );
-  SPDLOG_INFO( "Resized render texture to {}x{}, result: {}", new_size.x, new_size.y, result ? "Success" : "Failed" );
-  m_sprite.setTexture( m_render_texture.getTexture(), true );
+  m_render_texture = RenderTexturePool::acquire( new_size, m_fill );
+  SPDLOG_INFO( "Resized render texture to {}x{}", new_size.x, new_size.y );
+  m_sprite.setTexture( m_render_texture->getTexture(), true );
   m_sprite.setTextureRect( sf::IntRect( { 0, 0 }, { static_cast<int>( new_size.x ), static_cast<int>( new_size.y ) } ) );
 }
 
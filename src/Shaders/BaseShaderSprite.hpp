@@ -2,6 +2,9 @@
 #define __SPRITES_BASEFRAGMENTSHADER_HPP__
 
 #include <Shaders/IShaderSprite.hpp>
+#include <Shaders/RenderTexturePool.hpp>
+
+#include <memory>
 
 namespace ProceduralMaze::Sprites
 {
@@ -14,7 +17,10 @@ namespace ProceduralMaze::Sprites
  *
  * The class manages a render texture, sprite, and shader, providing a standardized
  * initialization sequence and interface for derived classes to implement custom
- * shader effects.
+ * shader effects. The render texture is a flat `fill` colour that is only read, so it comes
+ * from the RenderTexturePool and is shared with other sprites of the same size and fill.
+ * World effects should size it to the world view (see kViewMarginPx) and keep it centred on
+ * the view each update(), rather than covering the whole map.
  *
  * @note This class is move-only (copy operations are deleted).
  * @note Derived classes must implement the pure virtual functions to define
@@ -24,7 +30,7 @@ namespace ProceduralMaze::Sprites
  * 1. Create derived class implementing pure virtual functions
  * 2. Call setup() to initialize the shader system;
  *    You can do this from the constructor if you wish
- * 3. Use set_position() to position the drawable
+ * 3. Use set_position() or set_center_at_position() to position the drawable
  * 4. Call update() in your render loop for dynamic effects
  * 5. Draw using SFML's standard drawing mechanisms
  *
@@ -34,7 +40,11 @@ namespace ProceduralMaze::Sprites
 class BaseShaderSprite : public IShaderSprite
 {
 public:
-  BaseShaderSprite( std::filesystem::path vertex_shader_path, std::filesystem::path frag_shader_path, sf::Vector2u texture_size );
+  BaseShaderSprite( std::filesystem::path vertex_shader_path, std::filesystem::path frag_shader_path, sf::Vector2u texture_size,
+                    sf::Color fill = sf::Color( 0, 0, 0 ) );
+
+  //! @brief Extra border around a view-sized texture, so sub-pixel camera movement never exposes its edge
+  static constexpr sf::Vector2u kViewMarginPx{ 16u, 16u };
 
   BaseShaderSprite( const BaseShaderSprite & ) = delete;
   BaseShaderSprite &operator=( const BaseShaderSprite & ) = delete;
@@ -48,9 +58,8 @@ public:
    * @brief Initializes and configures the base fragment shader.
    *
    * This method performs the necessary setup operations for the fragment shader:
-   * 1. pre_setup_texture()
-   * 2. m_texture.display()
-   * 3. post_setup_shader()
+   * 1. load the vertex/fragment shader files
+   * 2. post_setup_shader()
    *
    * @throws std::runtime_error if shader compilation or linking fails
    */
@@ -64,12 +73,10 @@ public:
 
   void set_center_at_position( sf::Vector2f pos );
 
-  // Use this to set the view of the internal render texture
-  void set_texture_view( sf::View view_update );
   // internal draw function called by SFML
   void draw( sf::RenderTarget &target, sf::RenderStates states ) const override;
 
-  auto get_texture_size() const { return m_render_texture.getSize(); }
+  auto get_texture_size() const { return m_render_texture->getSize(); }
   void resize_texture( sf::Vector2u new_size ) override;
 
   sf::Time elapsed() { return m_clock.getElapsedTime(); }
@@ -83,16 +90,18 @@ public:
 protected:
   sf::Shader &get_shader() override { return m_shader; }
 
-  // this is the pallette texture that the shader will be applied to
-  sf::RenderTexture m_render_texture;
+  // this is the pallette texture that the shader will be applied to, shared via RenderTexturePool
+  std::shared_ptr<const sf::RenderTexture> m_render_texture;
   // the sprite that uses the texture
-  sf::Sprite m_sprite{ m_render_texture.getTexture() };
+  sf::Sprite m_sprite{ m_render_texture->getTexture() };
   // the vertex/fragment shader to be applied to the sprite
   sf::Shader m_shader;
   // clock for timing shader effects
   sf::Clock m_clock{};
 
 private:
+  // fill colour of `m_render_texture`
+  sf::Color m_fill;
   std::filesystem::path m_vert_shader_path;
   std::filesystem::path m_frag_shader_path;
 
@@ -1,12 +1,9 @@
 
-#include <Components/Position.hpp>
 #include <Constants.hpp>
 #include <Persistent/DisplayResolution.hpp>
 #include <Shaders/NightStaticShader.hpp>
-#include <Shaders/UniformBuilder.hpp>
 #include <Systems/PersistSystem.hpp>
 #include <Systems/Render/RenderSystem.hpp>
-#include <Utils/Player.hpp>
 
 #include <Shaders/DarkModeShader.hpp>
 
@@ -18,14 +15,14 @@ void DarkModeShader::update( entt::registry &reg )
   auto display_res = sf::Vector2f( Sys::PersistSystem::get<Cmp::Persist::DisplayResolution>( reg ) );
   sf::Vector2f aperture_half_size( Constants::kGridSizePxF * 4.f );
 
-  Sprites::UniformBuilder{}
-      .set( "local_resolution", Sys::RenderSystem::get_world_view().getSize() )
-      .set( "display_resolution", display_res )
-      .set( "aperture_half_size", aperture_half_size )
-      .set( "time", elapsed().asSeconds() )
-      .apply( &get_shader() );
+  m_uniforms.local_resolution.set( Sys::RenderSystem::get_world_view().getSize() );
+  m_uniforms.display_resolution.set( display_res );
+  m_uniforms.aperture_half_size.set( aperture_half_size );
+  m_uniforms.time.set( elapsed().asSeconds() );
+  m_uniforms.apply( get_shader() );
 
-  set_center_at_position( Utils::Player::get_position( reg ).position );
+  // the effect is anchored to the screen, so the (view-sized) texture just needs to cover the view
+  set_center_at_position( Sys::RenderSystem::get_world_view().getCenter() );
 }
 
 } // namespace ProceduralMaze::Sprites
\ No newline at end of file
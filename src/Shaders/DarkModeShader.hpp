@@ -4,6 +4,7 @@
 #include <SFML/System/Time.hpp>
 
 #include <Shaders/BaseShaderSprite.hpp>
+#include <Shaders/Uniform.hpp>
 #include <Systems/BaseSystem.hpp>
 
 namespace ProceduralMaze::Sprites
@@ -13,25 +14,31 @@ class DarkModeShader : public BaseShaderSprite
 {
 public:
   DarkModeShader( std::filesystem::path vert_shader_path, std::filesystem::path frag_shader_path, sf::Vector2u texture_size )
-      : BaseShaderSprite( vert_shader_path, frag_shader_path, texture_size )
+      : BaseShaderSprite( vert_shader_path, frag_shader_path, texture_size, sf::Color( 0, 0, 0 ) )
   {
     setup();
   }
 
   ~DarkModeShader() override = default;
 
-  void pre_setup_texture() override
-  {
-    // Clear the render texture with a dark color
-    m_render_texture.clear( sf::Color( 0, 0, 0 ) );
-  }
-
   void post_setup_shader() override
   {
     // nothing special to do here
   }
 
   void update( entt::registry &reg ) override;
+
+private:
+  //! @brief The uniforms set by update(). Only the values that changed since the last frame are pushed to the shader.
+  struct Uniforms
+  {
+    Uniform<sf::Vector2f> local_resolution{ "local_resolution" };
+    Uniform<sf::Vector2f> display_resolution{ "display_resolution" };
+    Uniform<sf::Vector2f> aperture_half_size{ "aperture_half_size" };
+    Uniform<float> time{ "time" };
+
+    void apply( sf::Shader &shader ) { apply_uniforms( shader, local_resolution, display_resolution, aperture_half_size, time ); }
+  } m_uniforms;
 };
 
 } // namespace ProceduralMaze::Sprites
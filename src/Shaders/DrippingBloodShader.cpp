@@ -2,8 +2,8 @@
 #include <Components/Player/PlayerCurse.hpp>
 #include <Components/Position.hpp>
 #include <Persistent/DisplayResolution.hpp>
-#include <Shaders/UniformBuilder.hpp>
 #include <Systems/PersistSystem.hpp>
+#include <Systems/Render/RenderSystem.hpp>
 #include <Utils/Player.hpp>
 
 #include <Shaders/DrippingBloodShader.hpp>
@@ -16,13 +16,13 @@ void DrippingBloodShader::update( entt::registry &reg )
   auto &player_curse = Utils::Player::get_curse( reg );
   auto display_res = sf::Vector2f( Sys::PersistSystem::get<Cmp::Persist::DisplayResolution>( reg ) );
 
-  Sprites::UniformBuilder{}
-      .set( "alpha", player_curse.shader_alpha.add( 0.01f ) )
-      .set( "resolution", display_res )
-      .set( "time", elapsed().asSeconds() )
-      .apply( &get_shader() );
+  m_uniforms.alpha.set( player_curse.shader_alpha.add( 0.01f ) );
+  m_uniforms.resolution.set( display_res );
+  m_uniforms.time.set( elapsed().asSeconds() );
+  m_uniforms.apply( get_shader() );
 
-  set_center_at_position( Utils::Player::get_position( reg ).position );
+  // the effect is anchored to the screen, so the (view-sized) texture just needs to cover the view
+  set_center_at_position( Sys::RenderSystem::get_world_view().getCenter() );
 }
 
 } // namespace ProceduralMaze::Sprites
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <SFML/System/Time.hpp>
 
 #include <Shaders/BaseShaderSprite.hpp>
+#include <Shaders/Uniform.hpp>
 #include <Systems/BaseSystem.hpp>
 
 namespace ProceduralMaze::Sprites
@@ -13,21 +14,26 @@ class DrippingBloodShader : public BaseShaderSprite
 {
 public:
   DrippingBloodShader( std::filesystem::path vert_shader_path, std::filesystem::path frag_shader_path, sf::Vector2u texture_size )
-      : BaseShaderSprite( vert_shader_path, frag_shader_path, texture_size )
+      : BaseShaderSprite( vert_shader_path, frag_shader_path, texture_size, sf::Color( 16, 32, 32 ) )
   {
     setup();
   }
   ~DrippingBloodShader() override = default;
 
-  void pre_setup_texture() override
-  {
-    m_render_texture.clear( sf::Color( 16, 32, 32 ) );
-    // std::ignore = m_texture.resize(texture_size);
-  }
-
-  void post_setup_shader() override { m_shader.setUniform( "resolution", sf::Vector2f{ m_render_texture.getSize() } ); }
+  void post_setup_shader() override { m_shader.setUniform( "resolution", sf::Vector2f{ m_render_texture->getSize() } ); }
 
   void update( entt::registry &reg ) override;
+
+private:
+  //! @brief The uniforms set by update(). Only the values that changed since the last frame are pushed to the shader.
+  struct Uniforms
+  {
+    Uniform<float> alpha{ "alpha" };
+    Uniform<sf::Vector2f> resolution{ "resolution" };
+    Uniform<float> time{ "time" };
+
+    void apply( sf::Shader &shader ) { apply_uniforms( shader, alpha, resolution, time ); }
+  } m_uniforms;
 };
 
 } // namespace ProceduralMaze::Sprites
@@ -4,6 +4,7 @@
 #include <SFML/System/Time.hpp>
 
 #include <Shaders/BaseShaderSprite.hpp>
+#include <Shaders/Uniform.hpp>
 #include <Systems/BaseSystem.hpp>
 
 namespace ProceduralMaze::Sprites
@@ -12,17 +13,33 @@ namespace ProceduralMaze::Sprites
 class FloodWaterShader : public BaseShaderSprite
 {
 public:
-  FloodWaterShader( std::filesystem::path vert_shader_path, std::filesystem::path frag_shader_path, sf::Vector2u texture_size )
-      : BaseShaderSprite( vert_shader_path, frag_shader_path, texture_size )
+  FloodWaterShader( std::filesystem::path vert_shader_path, std::filesystem::path frag_shader_path, sf::Vector2u texture_size,
+                    sf::Vector2f map_size )
+      : BaseShaderSprite( vert_shader_path, frag_shader_path, texture_size, sf::Color( 16, 32, 32 ) ),
+        m_map_size( map_size )
   {
     setup();
   }
   ~FloodWaterShader() override = default;
 
-  void pre_setup_texture() override { m_render_texture.clear( sf::Color( 16, 32, 32 ) ); }
-
-  void post_setup_shader() override { m_shader.setUniform( "resolution", sf::Vector2f{ m_render_texture.getSize() } ); }
+  void post_setup_shader() override { m_shader.setUniform( "resolution", sf::Vector2f{ m_render_texture->getSize() } ); }
   void update( entt::registry &reg ) override;
+
+private:
+  //! @brief World size the water pattern is normalised to
+  sf::Vector2f m_map_size;
+
+  //! @brief The uniforms set by update(). Only the values that changed since the last frame are pushed to the shader.
+  struct Uniforms
+  {
+    Uniform<sf::Vector2f> resolution{ "resolution" };
+    Uniform<sf::Vector2f> viewTopLeft{ "viewTopLeft" };
+    Uniform<sf::Vector2f> viewSize{ "viewSize" };
+    Uniform<sf::Vector2f> mapSize{ "mapSize" };
+    Uniform<float> time{ "time" };
+
+    void apply( sf::Shader &shader ) { apply_uniforms( shader, resolution, viewTopLeft, viewSize, mapSize, time ); }
+  } m_uniforms;
 };
 
 } // namespace ProceduralMaze::Sprites
@@ -10,7 +10,6 @@ class IShaderSprite : public sf::Drawable, public sf::Transformable
 {
 public:
   virtual ~IShaderSprite() = default;
-  virtual void pre_setup_texture() = 0;
   virtual void post_setup_shader() = 0;
   virtual void update( entt::registry &reg ) = 0;
   virtual void set_tag( const std::string &tag ) = 0;
@@ -1,6 +1,5 @@
 #include <Persistent/DisplayResolution.hpp>
 #include <Shaders/MistShader.hpp>
-#include <Shaders/UniformBuilder.hpp>
 #include <Systems/PersistSystem.hpp>
 #include <Systems/Render/RenderSystem.hpp>
 #include <entt/entity/registry.hpp>
@@ -15,15 +14,14 @@ void MistShader::update( entt::registry &reg )
   sf::Vector2f view_size = Sys::RenderSystem::get_world_view().getSize();
   sf::Vector2f view_top_left = { view_center.x - view_size.x / 2.f, view_center.y - view_size.y / 2.f };
 
-  Sprites::UniformBuilder{}
-      .set( "alpha", 0.75f )
-      .set( "resolution", sf::Vector2f{ display_size } )
-      .set( "viewTopLeft", view_top_left )
-      .set( "viewSize", view_size )
-      .set( "time", elapsed().asSeconds() )
-      .apply( &get_shader() );
+  m_uniforms.alpha.set( 0.75f );
+  m_uniforms.resolution.set( sf::Vector2f{ display_size } );
+  m_uniforms.viewTopLeft.set( view_top_left );
+  m_uniforms.viewSize.set( view_size );
+  m_uniforms.time.set( elapsed().asSeconds() );
+  m_uniforms.apply( get_shader() );
 
-  set_position( { -100, -100 } );
+  set_center_at_position( view_center );
 }
 
 } // namespace ProceduralMaze::Sprites
\ No newline at end of file
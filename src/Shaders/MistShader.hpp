@@ -4,6 +4,7 @@
 #include <SFML/System/Time.hpp>
 
 #include <Shaders/BaseShaderSprite.hpp>
+#include <Shaders/Uniform.hpp>
 #include <Systems/BaseSystem.hpp>
 
 namespace ProceduralMaze::Sprites
@@ -13,18 +14,29 @@ class MistShader : public BaseShaderSprite
 {
 public:
   MistShader( std::filesystem::path vert_shader_path, std::filesystem::path frag_shader_path, sf::Vector2u texture_size )
-      : BaseShaderSprite( vert_shader_path, frag_shader_path, texture_size )
+      : BaseShaderSprite( vert_shader_path, frag_shader_path, texture_size, sf::Color( 16, 128, 32 ) )
   {
     setup();
   }
 
   ~MistShader() override = default;
 
-  void pre_setup_texture() override { m_render_texture.clear( sf::Color( 16, 128, 32 ) ); }
-
   void post_setup_shader() override {}
 
   void update( entt::registry &reg ) override;
+
+private:
+  //! @brief The uniforms set by update(). Only the values that changed since the last frame are pushed to the shader.
+  struct Uniforms
+  {
+    Uniform<float> alpha{ "alpha" };
+    Uniform<sf::Vector2f> resolution{ "resolution" };
+    Uniform<sf::Vector2f> viewTopLeft{ "viewTopLeft" };
+    Uniform<sf::Vector2f> viewSize{ "viewSize" };
+    Uniform<float> time{ "time" };
+
+    void apply( sf::Shader &shader ) { apply_uniforms( shader, alpha, resolution, viewTopLeft, viewSize, time ); }
+  } m_uniforms;
 };
 
 } // namespace ProceduralMaze::Sprites
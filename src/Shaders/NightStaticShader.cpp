@@ -1,6 +1,5 @@
 #include <Components/Position.hpp>
 #include <Persistent/DisplayResolution.hpp>
-#include <Shaders/UniformBuilder.hpp>
 #include <Systems/PersistSystem.hpp>
 #include <Systems/Render/RenderSystem.hpp>
 #include <Utils/Player.hpp>
@@ -17,16 +16,14 @@ void NightStaticShader::update( entt::registry &reg )
   sf::Vector2f view_size = Sys::RenderSystem::get_world_view().getSize();
   sf::Vector2f view_top_left = { view_center.x - view_size.x / 2.f, view_center.y - view_size.y / 2.f };
 
-  Sprites::UniformBuilder{}
-      .set( "resolution", sf::Vector2f{ display_size } )
-      .set( "time", elapsed().asSeconds() )
-      .set( "viewTopLeft", view_top_left )
-      .set( "viewSize", view_size )
-      .set( "playerWorldPos", Utils::Player::get_position( reg ).getCenter() )
-      .apply( &get_shader() );
+  m_uniforms.resolution.set( sf::Vector2f{ display_size } );
+  m_uniforms.time.set( elapsed().asSeconds() );
+  m_uniforms.viewTopLeft.set( view_top_left );
+  m_uniforms.viewSize.set( view_size );
+  m_uniforms.playerWorldPos.set( Utils::Player::get_position( reg ).getCenter() );
+  m_uniforms.apply( get_shader() );
 
-  // shader position at the top left of the world
-  set_position( { 0, 0 } );
+  set_center_at_position( view_center );
 }
 
 } // namespace ProceduralMaze::Sprites
\ No newline at end of file
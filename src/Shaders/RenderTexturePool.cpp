@@ -0,0 +1,30 @@
+#include <Shaders/RenderTexturePool.hpp>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+
+namespace ProceduralMaze::Sprites
+{
+
+std::vector<RenderTexturePool::Entry> RenderTexturePool::s_entries{};
+
+std::shared_ptr<const sf::RenderTexture> RenderTexturePool::acquire( sf::Vector2u size, sf::Color fill )
+{
+  std::erase_if( s_entries, []( const Entry &entry ) { return entry.texture.expired(); } );
+
+  for ( const auto &entry : s_entries )
+  {
+    if ( entry.size != size or entry.fill != fill ) continue;
+    if ( auto texture = entry.texture.lock() ) return texture;
+  }
+
+  auto texture = std::make_shared<sf::RenderTexture>( size );
+  texture->clear( fill );
+  texture->display();
+  s_entries.push_back( Entry{ size, fill, texture } );
+  SPDLOG_INFO( "Created {}x{} shader render texture ({} pooled)", size.x, size.y, s_entries.size() );
+  return texture;
+}
+
+} // namespace ProceduralMaze::Sprites
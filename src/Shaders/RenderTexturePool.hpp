@@ -0,0 +1,37 @@
+#ifndef SRC_SHADERS_RENDERTEXTUREPOOL_HPP_
+#define SRC_SHADERS_RENDERTEXTUREPOOL_HPP_
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace ProceduralMaze::Sprites
+{
+
+//! @brief Shared render targets for BaseShaderSprite.
+//! A shader sprite only ever reads its texture (it is filled once with a flat colour), so every sprite asking for the same
+//! size and fill colour can draw from the same GPU target. A target is released when the last sprite holding it lets go.
+class RenderTexturePool
+{
+public:
+  //! @brief Get a render texture of `size`, cleared to `fill`
+  //! @throws sf::Exception if a new render texture cannot be created
+  static std::shared_ptr<const sf::RenderTexture> acquire( sf::Vector2u size, sf::Color fill );
+
+private:
+  struct Entry
+  {
+    sf::Vector2u size;
+    sf::Color fill;
+    std::weak_ptr<const sf::RenderTexture> texture;
+  };
+
+  static std::vector<Entry> s_entries;
+};
+
+} // namespace ProceduralMaze::Sprites
+
+#endif // SRC_SHADERS_RENDERTEXTUREPOOL_HPP_
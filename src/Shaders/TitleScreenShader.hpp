@@ -4,6 +4,7 @@
 #include <SFML/System/Time.hpp>
 
 #include <Shaders/BaseShaderSprite.hpp>
+#include <Shaders/Uniform.hpp>
 #include <Systems/BaseSystem.hpp>
 
 namespace ProceduralMaze::Sprites
@@ -13,20 +14,26 @@ class TitleScreenShader : public BaseShaderSprite
 {
 public:
   TitleScreenShader( std::filesystem::path vert_shader_path, std::filesystem::path frag_shader_path, sf::Vector2u texture_size )
-      : BaseShaderSprite( vert_shader_path, frag_shader_path, texture_size )
+      : BaseShaderSprite( vert_shader_path, frag_shader_path, texture_size, sf::Color( 128, 128, 128 ) )
   {
     setup();
   }
   ~TitleScreenShader() override = default;
 
-  void pre_setup_texture() override
-  {
-    m_render_texture.clear( sf::Color( 128, 128, 128 ) );
-    // std::ignore = m_texture.resize(texture_size);
-  }
-
   void post_setup_shader() override { m_shader.setUniform( "texture", sf::Shader::CurrentTexture ); }
   void update( entt::registry &reg ) override;
+
+private:
+  //! @brief The uniforms set by update(). Only the values that changed since the last frame are pushed to the shader.
+  struct Uniforms
+  {
+    Uniform<float> time{ "time" };
+    Uniform<float> pixel_threshold{ "pixel_threshold" };
+    Uniform<sf::Vector2f> mouse_cursor{ "mouse_cursor" };
+    Uniform<sf::Vector2f> resolution{ "resolution" };
+
+    void apply( sf::Shader &shader ) { apply_uniforms( shader, time, pixel_threshold, mouse_cursor, resolution ); }
+  } m_uniforms;
 };
 
 } // namespace ProceduralMaze::Sprites
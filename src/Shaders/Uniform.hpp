@@ -0,0 +1,78 @@
+#ifndef SRC_SHADERS_UNIFORM_HPP_
+#define SRC_SHADERS_UNIFORM_HPP_
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Shader.hpp>
+
+#include <optional>
+#include <string>
+#include <type_traits>
+
+namespace ProceduralMaze::Sprites
+{
+
+/**
+ * @class Uniform
+ * @brief One typed shader uniform that remembers the last value it pushed.
+ *
+ * Shader sprites keep a fixed struct of these (see DarkModeShader::Uniforms) instead of rebuilding a
+ * chain of string-keyed setters every frame. `set()` only marks the uniform dirty when the value
+ * actually changes, and `apply()` only calls sf::Shader::setUniform() for dirty uniforms, so
+ * constant uniforms are sent to the GPU once after the shader is loaded.
+ *
+ * Special type handling:
+ * - sf::Color: Automatically converts RGBA values from 0-255 range to 0.0-1.0 range
+ * - Other types: Passed directly to sf::Shader::setUniform()
+ *
+ * @example
+ * Uniform<float> time{ "time" };
+ * time.set( elapsed().asSeconds() );
+ * apply_uniforms( shader, time );
+ */
+template <typename T>
+class Uniform
+{
+public:
+  explicit Uniform( std::string name )
+      : m_name( std::move( name ) )
+  {
+  }
+
+  //! @brief Store the value for the next apply(). No-op if it has not changed since the last push.
+  Uniform &set( const T &value )
+  {
+    if ( m_value and *m_value == value ) return *this;
+    m_value = value;
+    m_dirty = true;
+    return *this;
+  }
+
+  //! @brief Push the value to `shader` if it changed since the last push
+  void apply( sf::Shader &shader )
+  {
+    if ( not m_dirty or not m_value ) return;
+    if constexpr ( std::is_same_v<T, sf::Color> )
+    {
+      shader.setUniform( m_name, sf::Glsl::Vec4( m_value->r / 255.0f, m_value->g / 255.0f, m_value->b / 255.0f, m_value->a / 255.0f ) );
+    }
+    else { shader.setUniform( m_name, *m_value ); }
+    m_dirty = false;
+  }
+
+private:
+  //! @brief built once, so pushing the uniform never allocates
+  std::string m_name;
+  std::optional<T> m_value;
+  bool m_dirty{ true };
+};
+
+//! @brief Push every dirty uniform in `uniforms` to `shader`
+template <typename... Ts>
+void apply_uniforms( sf::Shader &shader, Uniform<Ts> &...uniforms )
+{
+  ( uniforms.apply( shader ), ... );
+}
+
+} // namespace ProceduralMaze::Sprites
+
+#endif // SRC_SHADERS_UNIFORM_HPP_
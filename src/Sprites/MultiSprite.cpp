@@ -5,6 +5,8 @@
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+
 namespace ProceduralMaze::Sprites
 {
 
@@ -26,6 +28,7 @@ MultiSprite::MultiSprite( SpriteMetaType type, std::string display_name, const s
     throw std::runtime_error( "Unable to load tile map: " + tilemap_path.string() );
   }
   m_tilemap_texture->setSmooth( false );
+  m_texture_region = sf::IntRect( { 0, 0 }, sf::Vector2i( m_tilemap_texture->getSize() ) );
   SPDLOG_DEBUG( "Loaded tilemap texture: {}", tilemap_path.string() );
   if ( !add_sprite( tilemap_picks ) )
   {
@@ -48,6 +51,7 @@ MultiSprite::MultiSprite( SpriteMetaType type, std::string display_name, const s
   SPDLOG_DEBUG( "Loaded tilemap texture" );
   m_tilemap_texture = std::make_shared<sf::Texture>( std::move( tilemap_texture ) );
   m_tilemap_texture->setSmooth( false );
+  m_texture_region = sf::IntRect( { 0, 0 }, sf::Vector2i( m_tilemap_texture->getSize() ) );
   if ( !add_sprite( tilemap_picks ) )
   {
     SPDLOG_CRITICAL( "Failed to load tilemap" );
@@ -55,6 +59,26 @@ MultiSprite::MultiSprite( SpriteMetaType type, std::string display_name, const s
   }
 }
 
+MultiSprite::MultiSprite( SpriteMetaType type, std::string display_name, const std::vector<float> &zorder_list,
+                          std::shared_ptr<sf::Texture> atlas_page, sf::IntRect atlas_region, const std::vector<uint32_t> &tilemap_picks,
+                          SpriteSize grid_size, unsigned int sprites_per_frame, unsigned int sprites_per_sequence, std::vector<bool> solid_mask )
+    : m_tilemap_texture{ std::move( atlas_page ) },
+      m_texture_region{ atlas_region },
+      m_sprite_type{ type },
+      m_display_name( display_name ),
+      m_zorder_list( zorder_list ),
+      m_grid_size{ grid_size.width, grid_size.height },
+      m_sprites_per_frame{ sprites_per_frame },
+      m_sprites_per_sequence{ sprites_per_sequence },
+      m_solid_mask{ std::move( solid_mask ) }
+{
+  if ( !add_sprite( tilemap_picks ) )
+  {
+    SPDLOG_CRITICAL( "Failed to load tilemap from texture atlas" );
+    throw std::runtime_error( "Failed to load tilemap from texture atlas" );
+  }
+}
+
 bool MultiSprite::add_sprite( const std::vector<uint32_t> &tilemap_picks )
 {
   if ( tilemap_picks.empty() )
@@ -63,6 +87,18 @@ bool MultiSprite::add_sprite( const std::vector<uint32_t> &tilemap_picks )
     return false;
   }
 
+  // the tilemap region in 16x16 base tiles. A sprite must fit inside it, or it samples whatever is next to it in the atlas
+  const int base_tiles_per_row = m_texture_region.size.x / static_cast<int>( Constants::kGridSizePx.x );
+  const int base_tile_rows = m_texture_region.size.y / static_cast<int>( Constants::kGridSizePx.y );
+  const int last_tile_x = base_tiles_per_row - static_cast<int>( m_grid_size.width );
+  const int last_tile_y = base_tile_rows - static_cast<int>( m_grid_size.height );
+  if ( last_tile_x < 0 || last_tile_y < 0 )
+  {
+    SPDLOG_ERROR( "{}: {}x{} tile sprites do not fit in its {}x{} tile tilemap", m_sprite_type, m_grid_size.width, m_grid_size.height,
+                  base_tiles_per_row, base_tile_rows );
+    return false;
+  }
+
   SPDLOG_DEBUG( "{} requested {} tiles", m_sprite_type, tilemap_picks.size() );
   for ( const auto &tile_idx : tilemap_picks )
   {
@@ -70,13 +106,19 @@ bool MultiSprite::add_sprite( const std::vector<uint32_t> &tilemap_picks )
 
     sf::VertexArray current_va( sf::PrimitiveType::Triangles, 6 );
 
-    // Calculate texture coordinates based on 16x16 base tile grid (not sprite grid)
-    const int base_tiles_per_row = m_tilemap_texture->getSize().x / Constants::kGridSizePx.x;
-    const int base_tile_x = tile_idx % base_tiles_per_row;
-    const int base_tile_y = tile_idx / base_tiles_per_row;
-
-    const int tu = base_tile_x * Constants::kGridSizePx.x;
-    const int tv = base_tile_y * Constants::kGridSizePx.y;
+    // Calculate texture coordinates based on 16x16 base tile grid (not sprite grid), relative to the tilemap region
+    int base_tile_x = static_cast<int>( tile_idx % static_cast<uint32_t>( base_tiles_per_row ) );
+    int base_tile_y = static_cast<int>( tile_idx / static_cast<uint32_t>( base_tiles_per_row ) );
+    if ( base_tile_x > last_tile_x || base_tile_y > last_tile_y )
+    {
+      base_tile_x = std::min( base_tile_x, last_tile_x );
+      base_tile_y = std::min( base_tile_y, last_tile_y );
+      SPDLOG_ERROR( "{}: tile index {} is outside its {}x{} tile tilemap, clamped to {}", m_sprite_type, tile_idx, base_tiles_per_row,
+                    base_tile_rows, base_tile_y * base_tiles_per_row + base_tile_x );
+    }
+
+    const int tu = m_texture_region.position.x + base_tile_x * Constants::kGridSizePx.x;
+    const int tv = m_texture_region.position.y + base_tile_y * Constants::kGridSizePx.y;
 
     // draw the two triangles within local space using the sprite dimensions
     current_va[0].position = sf::Vector2f( 0, 0 );
@@ -9,6 +9,7 @@
 #include <cstdint>
 #include <exception>
 #include <filesystem>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -46,6 +47,19 @@ public:
                         const std::vector<uint32_t> &tilemap_picks, SpriteSize grid_size = { 1, 1 }, unsigned int sprites_per_frame = 1,
                         unsigned int sprites_per_sequence = 1, std::vector<bool> solid_mask = {} );
 
+  /**
+   * @brief Constructs a MultiSprite from a tilemap that has been packed into a shared texture atlas page.
+   *
+   * @param atlas_page The atlas texture shared with other MultiSprites
+   * @param atlas_region The area of `atlas_page` occupied by the tilemap. Tile indices are relative to this area.
+   *
+   * @throws std::runtime_error If the tile indices are invalid
+   */
+  explicit MultiSprite( SpriteMetaType type, std::string display_name, const std::vector<float> &zorder_list,
+                        std::shared_ptr<sf::Texture> atlas_page, sf::IntRect atlas_region, const std::vector<uint32_t> &tilemap_picks,
+                        SpriteSize grid_size = { 1, 1 }, unsigned int sprites_per_frame = 1, unsigned int sprites_per_sequence = 1,
+                        std::vector<bool> solid_mask = {} );
+
   MultiSprite( MultiSprite && ) = default;
   MultiSprite &operator=( MultiSprite && ) = default;
   ~MultiSprite() = default;
@@ -90,6 +104,10 @@ public:
 
 private:
   std::shared_ptr<sf::Texture> m_tilemap_texture;
+
+  // area of `m_tilemap_texture` holding the tilemap: the whole texture unless it is an atlas page
+  sf::IntRect m_texture_region{};
+
   bool add_sprite( const std::vector<uint32_t> &tilemap_picks );
 
   SpriteMetaType m_sprite_type;
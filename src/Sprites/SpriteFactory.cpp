@@ -5,19 +5,41 @@
 
 #include <Sprites/MultiSprite.hpp>
 #include <Sprites/SpriteFactory.hpp>
+#include <Sprites/TextureAtlas.hpp>
+#include <Utils/AssetLoader.hpp>
 
 #include <fstream>
+#include <future>
 #include <regex>
 #include <spdlog/spdlog.h>
 #include <string>
 
+namespace ProceduralMaze::Sprites
+{
+namespace
+{
+//! @brief The JSON fields of a single multisprite. The texture is loaded separately so it can be packed into the texture atlas.
+struct MultiSpriteConfig
+{
+  std::string display_name;
+  std::vector<float> zorder_list{};
+  std::filesystem::path texture_path;
+  std::vector<uint32_t> sprite_indices;
+  unsigned int sprites_per_sequence{ 1 };
+  unsigned int sprites_per_frame{ 1 };
+  std::vector<bool> solid_mask{};
+  SpriteSize grid_size;
+};
+} // namespace
+} // namespace ProceduralMaze::Sprites
+
 namespace nlohmann
 {
-//! @brief ADL hook used via nlohmann::basic_json::get (see SceneConfig::load below)
+//! @brief ADL hook used via nlohmann::basic_json::get (see SpriteFactory::init below)
 template <>
-struct adl_serializer<ProceduralMaze::Sprites::MultiSprite>
+struct adl_serializer<ProceduralMaze::Sprites::MultiSpriteConfig>
 {
-  static void from_json( const json &j, ProceduralMaze::Sprites::MultiSprite &ms )
+  static void from_json( const json &j, ProceduralMaze::Sprites::MultiSpriteConfig &ms )
   {
 
     //! @brief lambda helper for error checking on JSON Single field types
@@ -61,39 +83,21 @@ struct adl_serializer<ProceduralMaze::Sprites::MultiSprite>
       }
     };
 
-    std::string display_name;
-    get_field( "displayname", display_name );
-
-    std::vector<float> zorder_list{};
-    get_optional_list( "zorder", zorder_list );
-
-    std::filesystem::path texture_path;
-    get_field( "texture_path", texture_path );
-
-    std::vector<uint32_t> sprite_indices;
-    get_field( "sprite_indices", sprite_indices );
-
-    unsigned int sprites_per_sequence;
-    get_field( "sprites_per_sequence", sprites_per_sequence );
-
-    unsigned int sprites_per_frame;
-    get_field( "sprites_per_frame", sprites_per_frame );
-
-    std::vector<bool> solid_mask{};
-    get_optional_list( "solid_mask", solid_mask );
-
-    ProceduralMaze::Sprites::SpriteSize grid_size;
-    get_xy_field( "grid_size", grid_size );
-
-    ms = ProceduralMaze::Sprites::MultiSprite{ "",        display_name,      zorder_list,          texture_path, sprite_indices,
-                                               grid_size, sprites_per_frame, sprites_per_sequence, solid_mask };
+    get_field( "displayname", ms.display_name );
+    get_optional_list( "zorder", ms.zorder_list );
+    get_field( "texture_path", ms.texture_path );
+    get_field( "sprite_indices", ms.sprite_indices );
+    get_field( "sprites_per_sequence", ms.sprites_per_sequence );
+    get_field( "sprites_per_frame", ms.sprites_per_frame );
+    get_optional_list( "solid_mask", ms.solid_mask );
+    get_xy_field( "grid_size", ms.grid_size );
   }
 };
 } // namespace nlohmann
 
 namespace ProceduralMaze::Sprites
 {
-void SpriteFactory::init()
+void SpriteFactory::init( Utils::AssetLoader &loader )
 {
   std::ifstream file( "res/json/sprite_metadata.json" );
   if ( !file.is_open() )
@@ -107,21 +111,58 @@ void SpriteFactory::init()
 
   if ( not j.contains( "sprites" ) ) throw std::runtime_error( "Missing 'sprites' from JSON scene config file" );
   const auto &sprites = j.at( "sprites" );
+
+  // parse everything first so each tilemap is only loaded once, however many sprites share it.
+  // SpriteMetaType interning is not thread-safe, so the types are created here rather than in the loader jobs.
+  std::vector<std::pair<SpriteMetaType, MultiSpriteConfig>> configs;
+  std::vector<std::pair<std::filesystem::path, std::future<sf::Image>>> images;
+  std::unordered_set<std::string> queued_paths;
   for ( const auto &[ms_type, ms_object] : sprites.items() )
   {
     if ( not ms_object.contains( "multisprite" ) ) throw std::runtime_error( "Missing 'multisprite' from JSON scene config file" );
-    const auto &multisprite = ms_object.at( "multisprite" );
-    MultiSprite new_ms = multisprite.get<MultiSprite>();
-    new_ms.set_sprite_type( ms_type );
+    auto config = ms_object.at( "multisprite" ).get<MultiSpriteConfig>();
+    if ( queued_paths.insert( config.texture_path.generic_string() ).second )
+    {
+      images.emplace_back( config.texture_path, loader.submit( [path = config.texture_path]() { return TextureAtlas::load_image( path ); } ) );
+    }
+    configs.emplace_back( ms_type, std::move( config ) );
+  }
+
+  // collect the decoded images in submission order, so the atlas layout does not depend on which worker finished first
+  TextureAtlas atlas;
+  for ( auto &[path, image] : images )
+    atlas.add( path, image.get() );
+
+  // pack the tilemaps into shared atlas pages so consecutive sprite draws rarely need to rebind a texture
+  atlas.build( not m_headless );
+
+  for ( auto &[ms_type, config] : configs )
+  {
+    const auto &region = atlas.region( config.texture_path );
+    MultiSprite new_ms{ ms_type,          config.display_name,      config.zorder_list,
+                        region.page,      region.rect,              config.sprite_indices,
+                        config.grid_size, config.sprites_per_frame, config.sprites_per_sequence,
+                        std::move( config.solid_mask ) };
     SPDLOG_INFO( "Loaded sprite metadata for type: {}, tiles: {}", new_ms.get_sprite_type(), new_ms.get_sprite_count() );
-    m_sprite_metadata_map[ms_type] = std::move( new_ms );
+    if ( m_sprite_metadata.size() <= ms_type.id() ) m_sprite_metadata.resize( SpriteMetaType::count() );
+    if ( not m_sprite_metadata[ms_type.id()] ) m_sprite_types.push_back( ms_type );
+    m_sprite_metadata[ms_type.id()] = std::move( new_ms );
   }
+  SPDLOG_INFO( "Packed {} sprite types into {} texture atlas page(s)", configs.size(), atlas.page_count() );
 
   create_error_sprite();
 }
 
 void SpriteFactory::create_error_sprite()
 {
+  if ( m_headless )
+  {
+    // same 16x16 tile, on a texture that is never uploaded
+    m_error_metadata = MultiSprite{ "ERROR_SPRITE", "Error Sprite", { 0.0 }, std::make_shared<sf::Texture>(),
+                                    sf::IntRect( { 0, 0 }, { 16, 16 } ), { 0 }, { 1, 1 }, 1, 1, {} };
+    return;
+  }
+
   // Create procedural error texture (bright magenta/black checkerboard)
   sf::Image error_image( { 16, 16 }, sf::Color::Magenta );
 
@@ -147,18 +188,14 @@ std::pair<SpriteMetaType, std::size_t> SpriteFactory::get_random_type_and_textur
 {
   const MultiSprite &selected_data = get_random_spritedata( type_list );
 
-  // Find the type that corresponds to this data
-  for ( const auto &[type, metadata] : m_sprite_metadata_map )
+  // Fallback to error sprite if not found
+  if ( &selected_data == &m_error_metadata )
   {
-    if ( metadata.get_sprite_type() == selected_data.get_sprite_type() )
-    {
-      Cmp::RandomInt random_picker( 0, selected_data.get_sprite_count() - 1 );
-      return { type, random_picker.gen() };
-    }
+    SPDLOG_ERROR( "Could not find matching sprite type in map, returning error sprite" );
+    return { "ERROR_SPRITE", 0 };
   }
-  // Fallback to error sprite if not found
-  SPDLOG_ERROR( "Could not find matching sprite type in map, returning error sprite" );
-  return { "ERROR_SPRITE", 0 };
+  Cmp::RandomInt random_picker( 0, selected_data.get_sprite_count() - 1 );
+  return { selected_data.get_sprite_type(), random_picker.gen() };
 }
 
 SpriteMetaType SpriteFactory::get_random_type( std::vector<SpriteMetaType> type_list )
@@ -177,17 +214,17 @@ std::vector<SpriteMetaType> SpriteFactory::get_all_sprite_types_by_pattern( cons
     // Try to use as regex first
     std::regex pattern_regex( pattern );
 
-    for ( const auto &[type, _] : m_sprite_metadata_map )
+    for ( const auto &type : m_sprite_types )
     {
-      if ( std::regex_search( type, pattern_regex ) ) { types.push_back( type ); }
+      if ( std::regex_search( type.name(), pattern_regex ) ) { types.push_back( type ); }
     }
   } catch ( const std::regex_error &e )
   {
     // If regex fails, fallback to substring matching (current behavior)
     SPDLOG_DEBUG( "Pattern '{}' is not valid regex, using substring matching", pattern );
-    for ( const auto &[type, _] : m_sprite_metadata_map )
+    for ( const auto &type : m_sprite_types )
     {
-      if ( type.find( pattern ) != std::string::npos ) { types.push_back( type ); }
+      if ( type.contains( pattern ) ) { types.push_back( type ); }
     }
   }
 
@@ -196,33 +233,16 @@ std::vector<SpriteMetaType> SpriteFactory::get_all_sprite_types_by_pattern( cons
 
 const Sprites::MultiSprite &SpriteFactory::get_multisprite_by_type( const SpriteMetaType &type ) { return get_spritedata_by_type( type ); }
 
-std::vector<SpriteMetaType> SpriteFactory::get_all_sprite_types()
-{
-  std::vector<SpriteMetaType> types;
-  types.reserve( m_sprite_metadata_map.size() );
-
-  for ( const auto &[type, _] : m_sprite_metadata_map )
-  {
-    types.push_back( type );
-  }
-  return types;
-}
+std::vector<SpriteMetaType> SpriteFactory::get_all_sprite_types() { return m_sprite_types; }
 
 std::unordered_set<SpriteMetaType> SpriteFactory::get_all_sprite_types_set()
 {
-  std::unordered_set<SpriteMetaType> types;
-
-  for ( const auto &pair : m_sprite_metadata_map )
-  {
-    types.insert( pair.first );
-  }
-  return types;
+  return std::unordered_set<SpriteMetaType>( m_sprite_types.begin(), m_sprite_types.end() );
 }
 
 const MultiSprite &SpriteFactory::get_spritedata_by_type( const SpriteMetaType &type )
 {
-  auto it = m_sprite_metadata_map.find( type );
-  if ( it != m_sprite_metadata_map.end() ) { return it->second; }
+  if ( type.id() < m_sprite_metadata.size() && m_sprite_metadata[type.id()] ) { return *m_sprite_metadata[type.id()]; }
   return m_error_metadata;
 }
 
@@ -6,11 +6,16 @@
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/System/Vector2.hpp>
 
+#include <optional>
 #include <string>
-#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+namespace ProceduralMaze::Utils
+{
+class AssetLoader;
+}
+
 namespace ProceduralMaze::Sprites
 {
 
@@ -20,11 +25,17 @@ namespace ProceduralMaze::Sprites
 class SpriteFactory
 {
 public:
-  SpriteFactory() = default;
+  //! @param headless Lay out the sprites without creating any textures, so no OpenGL context is needed (see Engine)
+  explicit SpriteFactory( bool headless = false )
+      : m_headless( headless )
+  {
+  }
 
   //! @brief Initializes the sprite factory
   //! This function loads sprite metadata from a JSON file and initializes the factory.
-  void init();
+  //! The tilemap images are decoded on the `loader` workers. Sprite types are interned and the atlas is uploaded on the calling thread.
+  //! @param loader
+  void init( Utils::AssetLoader &loader );
 
   //! @brief Create a error sprite object
   //! This function creates a special error sprite to prevent engine crashes when handling invalid sprite data.
@@ -74,8 +85,11 @@ private:
   // Internal use function used by get_random_type_and_texture_index()
   const MultiSprite &get_random_spritedata( std::vector<SpriteMetaType> type_list );
 
-  //! @brief Map of sprite types to their corresponding metadata
-  std::unordered_map<SpriteMetaType, MultiSprite> m_sprite_metadata_map;
+  //! @brief Every sprite type loaded from JSON, in load order
+  std::vector<SpriteMetaType> m_sprite_types;
+
+  //! @brief Sprite metadata indexed by SpriteMetaType::id(). Interned types that are not sprites (e.g. groups) are empty.
+  std::vector<std::optional<MultiSprite>> m_sprite_metadata;
 
   //! @brief Error texture for missing sprites
   sf::Texture m_error_texture;
@@ -84,6 +98,8 @@ private:
   //! This contains information about the error texture's properties
   MultiSprite m_error_metadata;
 
+  bool m_headless{ false };
+
 }; // namespace ProceduralMaze::Sprites
 
 } // namespace ProceduralMaze::Sprites
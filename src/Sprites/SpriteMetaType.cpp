@@ -0,0 +1,63 @@
+#include <Sprites/SpriteMetaType.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+namespace ProceduralMaze::Sprites
+{
+
+namespace
+{
+
+//! @brief Storage for every interned name
+struct SpriteTypeTable
+{
+  struct Entry
+  {
+    std::string name;
+    //! @brief IDs of the dotted prefixes of `name`, e.g. "sprite" and "sprite.ghost" for "sprite.ghost.walk"
+    std::vector<SpriteMetaType::Id> groups;
+  };
+
+  //! @brief indexed by ID. A deque so `SpriteMetaType::name()` references survive later interning.
+  std::deque<Entry> entries{ Entry{} };
+  std::unordered_map<std::string_view, SpriteMetaType::Id> ids{ { std::string_view{}, 0 } };
+};
+
+SpriteTypeTable &table()
+{
+  static SpriteTypeTable instance;
+  return instance;
+}
+
+} // namespace
+
+const std::string &SpriteMetaType::name() const { return table().entries[m_id].name; }
+
+bool SpriteMetaType::is_a( SpriteMetaType group ) const
+{
+  if ( group.m_id == m_id ) return true;
+  const auto &groups = table().entries[m_id].groups;
+  return std::ranges::find( groups, group.m_id ) != groups.end();
+}
+
+std::size_t SpriteMetaType::count() { return table().entries.size(); }
+
+SpriteMetaType::Id SpriteMetaType::intern( std::string_view name )
+{
+  auto &tbl = table();
+  if ( auto it = tbl.ids.find( name ); it != tbl.ids.end() ) return it->second;
+
+  std::vector<Id> groups;
+  for ( auto dot = name.find( '.' ); dot != std::string_view::npos; dot = name.find( '.', dot + 1 ) )
+    groups.push_back( intern( name.substr( 0, dot ) ) );
+
+  const auto id = static_cast<Id>( tbl.entries.size() );
+  const auto &entry = tbl.entries.emplace_back( SpriteTypeTable::Entry{ std::string( name ), std::move( groups ) } );
+  tbl.ids.emplace( entry.name, id );
+  return id;
+}
+
+} // namespace ProceduralMaze::Sprites
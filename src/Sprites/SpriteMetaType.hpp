@@ -1,11 +1,89 @@
 #ifndef SRC_SPRITES_SPRITESMETATYPE_HPP_
 #define SRC_SPRITES_SPRITESMETATYPE_HPP_
 
+#include <spdlog/fmt/fmt.h>
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
 namespace ProceduralMaze::Sprites
 {
 
-using SpriteMetaType = std::string;
+//! @brief Interned sprite type name, e.g. "sprite.ghost.walk.east"
+//! Each distinct name is given a compact integer ID the first time it is seen, so components carry an integer instead of a
+//! heap string, and comparing, hashing or looking up a type (see SpriteFactory) never touches the string.
+//! The name is still available for logging, JSON and pattern matching.
+//! @note Interning is not thread-safe: new types must be created on the main thread. Every type in sprite_metadata.json is
+//!       interned by SpriteFactory::init, so per-frame code should keep its types in `static const` locals.
+class SpriteMetaType
+{
+public:
+  using Id = uint32_t;
+
+  //! @brief The empty type "", which always has ID 0
+  SpriteMetaType() = default;
+  SpriteMetaType( std::string_view name )
+      : m_id( intern( name ) )
+  {
+  }
+  SpriteMetaType( const std::string &name )
+      : SpriteMetaType( std::string_view( name ) )
+  {
+  }
+  SpriteMetaType( const char *name )
+      : SpriteMetaType( std::string_view( name ) )
+  {
+  }
+
+  Id id() const { return m_id; }
+  bool empty() const { return m_id == 0; }
+
+  //! @brief The interned name. The reference stays valid for the lifetime of the program.
+  const std::string &name() const;
+  operator const std::string &() const { return name(); }
+
+  //! @brief Is this type `group` or nested below it in the dotted naming scheme?
+  //! e.g. "sprite.ghost.walk.east" is_a "sprite.ghost", but "sprite.ghostly" is not. This is an integer scan, so prefer it
+  //! over `contains()` in per-frame code.
+  bool is_a( SpriteMetaType group ) const;
+
+  //! @brief Substring search on the name
+  bool contains( std::string_view str ) const { return name().contains( str ); }
+
+  bool operator==( const SpriteMetaType &rhs ) const = default;
+
+  //! @brief Ordered by name, so ordered containers still iterate alphabetically
+  std::strong_ordering operator<=>( const SpriteMetaType &rhs ) const { return name() <=> rhs.name(); }
+
+  //! @brief One past the largest ID handed out so far
+  static std::size_t count();
+
+private:
+  static Id intern( std::string_view name );
+
+  Id m_id{ 0 };
+};
 
 } // namespace ProceduralMaze::Sprites
 
-#endif // SRC_SPRITES_SPRITESMETATYPE_HPP_
\ No newline at end of file
+template <>
+struct std::hash<ProceduralMaze::Sprites::SpriteMetaType>
+{
+  std::size_t operator()( const ProceduralMaze::Sprites::SpriteMetaType &type ) const noexcept { return type.id(); }
+};
+
+template <>
+struct fmt::formatter<ProceduralMaze::Sprites::SpriteMetaType> : fmt::formatter<std::string_view>
+{
+  template <typename FormatContext>
+  auto format( const ProceduralMaze::Sprites::SpriteMetaType &type, FormatContext &ctx ) const
+  {
+    return fmt::formatter<std::string_view>::format( type.name(), ctx );
+  }
+};
+
+#endif // SRC_SPRITES_SPRITESMETATYPE_HPP_
@@ -0,0 +1,36 @@
+#ifndef SRC_SPRITES_SPRITETYPES_HPP_
+#define SRC_SPRITES_SPRITETYPES_HPP_
+
+#include <Sprites/SpriteMetaType.hpp>
+
+//! @brief Pre-interned sprite types that are compared or assigned every frame, so the hot loops never hash a string.
+//! Group types (e.g. kGhost) are matched with SpriteMetaType::is_a().
+namespace ProceduralMaze::Sprites::Type
+{
+
+inline const SpriteMetaType kSkeleton{ "sprite.skeleton" };
+inline const SpriteMetaType kSkeletonWalkEast{ "sprite.skeleton.walk.east" };
+inline const SpriteMetaType kSkeletonWalkWest{ "sprite.skeleton.walk.west" };
+inline const SpriteMetaType kSkeletonWalkNorth{ "sprite.skeleton.walk.north" };
+inline const SpriteMetaType kSkeletonWalkSouth{ "sprite.skeleton.walk.south" };
+
+inline const SpriteMetaType kGhost{ "sprite.ghost" };
+inline const SpriteMetaType kGhostWalkEast{ "sprite.ghost.walk.east" };
+inline const SpriteMetaType kGhostWalkWest{ "sprite.ghost.walk.west" };
+inline const SpriteMetaType kGhostWalkNorth{ "sprite.ghost.walk.north" };
+inline const SpriteMetaType kGhostWalkSouth{ "sprite.ghost.walk.south" };
+
+inline const SpriteMetaType kWitch{ "sprite.witch" };
+inline const SpriteMetaType kPriest{ "sprite.priest" };
+
+inline const SpriteMetaType kPlayerWalkEast{ "sprite.player.walk.east" };
+inline const SpriteMetaType kPlayerWalkWest{ "sprite.player.walk.west" };
+inline const SpriteMetaType kPlayerWalkNorth{ "sprite.player.walk.north" };
+inline const SpriteMetaType kPlayerWalkSouth{ "sprite.player.walk.south" };
+inline const SpriteMetaType kPlayerFootsteps{ "sprite.player.footsteps" };
+
+inline const SpriteMetaType kCryptWallInt{ "sprite.crypt.wall.int" };
+
+} // namespace ProceduralMaze::Sprites::Type
+
+#endif // SRC_SPRITES_SPRITETYPES_HPP_
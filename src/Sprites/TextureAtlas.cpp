@@ -0,0 +1,128 @@
+#include <Sprites/TextureAtlas.hpp>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace ProceduralMaze::Sprites
+{
+
+void TextureAtlas::add( const std::filesystem::path &path )
+{
+  auto key = path.generic_string();
+  if ( m_images.contains( key ) || m_regions.contains( key ) ) return;
+  m_images.emplace( std::move( key ), load_image( path ) );
+}
+
+void TextureAtlas::add( const std::filesystem::path &path, sf::Image image )
+{
+  auto key = path.generic_string();
+  if ( m_images.contains( key ) || m_regions.contains( key ) ) return;
+  m_images.emplace( std::move( key ), std::move( image ) );
+}
+
+sf::Image TextureAtlas::load_image( const std::filesystem::path &path )
+{
+  sf::Image image;
+  if ( !image.loadFromFile( path ) )
+  {
+    SPDLOG_ERROR( "Unable to load tile map {}", path.generic_string() );
+    throw std::runtime_error( "Unable to load tile map: " + path.generic_string() );
+  }
+  return image;
+}
+
+void TextureAtlas::build( bool upload )
+{
+  const unsigned int page_size = upload ? std::min( sf::Texture::getMaximumSize(), kMaxPageSize ) : kMaxPageSize;
+
+  // tallest first keeps the shelves tight
+  std::vector<std::string> order;
+  order.reserve( m_images.size() );
+  for ( const auto &[key, _] : m_images )
+    order.push_back( key );
+  std::ranges::sort( order,
+                     [&]( const std::string &lhs, const std::string &rhs )
+                     {
+                       const auto lhs_size = m_images.at( lhs ).getSize();
+                       const auto rhs_size = m_images.at( rhs ).getSize();
+                       if ( lhs_size.y != rhs_size.y ) return lhs_size.y > rhs_size.y;
+                       if ( lhs_size.x != rhs_size.x ) return lhs_size.x > rhs_size.x;
+                       return lhs < rhs;
+                     } );
+
+  //! @brief placements for the page currently being filled
+  struct Placement
+  {
+    std::string key;
+    sf::Vector2u offset;
+  };
+  std::vector<Placement> placements;
+  sf::Vector2u cursor{ 0, 0 };
+  sf::Vector2u extent{ 0, 0 };
+  unsigned int shelf_height = 0;
+
+  auto flush_page = [&]()
+  {
+    if ( placements.empty() ) return;
+    auto page = std::make_shared<sf::Texture>();
+    for ( const auto &placement : placements )
+    {
+      const auto &image = m_images.at( placement.key );
+      m_regions[placement.key] = Region{ page, sf::IntRect( sf::Vector2i( placement.offset ), sf::Vector2i( image.getSize() ) ) };
+    }
+    if ( upload )
+    {
+      sf::Image page_image( extent, sf::Color::Transparent );
+      for ( const auto &placement : placements )
+      {
+        if ( !page_image.copy( m_images.at( placement.key ), placement.offset ) )
+        {
+          throw std::runtime_error( "Unable to pack tile map: " + placement.key );
+        }
+      }
+      if ( !page->loadFromImage( page_image ) )
+      {
+        SPDLOG_CRITICAL( "Unable to create {}x{} texture atlas page", extent.x, extent.y );
+        throw std::runtime_error( "Unable to create texture atlas page" );
+      }
+      page->setSmooth( false );
+    }
+    SPDLOG_INFO( "Texture atlas page {}: {}x{}px, {} tilemaps", m_pages.size(), extent.x, extent.y, placements.size() );
+    m_pages.push_back( std::move( page ) );
+
+    placements.clear();
+    cursor = { 0, 0 };
+    extent = { 0, 0 };
+    shelf_height = 0;
+  };
+
+  for ( const auto &key : order )
+  {
+    const auto size = m_images.at( key ).getSize();
+    if ( size.x > page_size || size.y > page_size )
+    {
+      SPDLOG_CRITICAL( "Tile map {} ({}x{}px) exceeds the maximum atlas page size {}", key, size.x, size.y, page_size );
+      throw std::runtime_error( "Tile map exceeds maximum atlas page size: " + key );
+    }
+
+    // start a new shelf when the current one is full, and a new page when the shelves run out
+    if ( cursor.x + size.x > page_size )
+    {
+      cursor = { 0, cursor.y + shelf_height + kPadding };
+      shelf_height = 0;
+    }
+    if ( cursor.y + size.y > page_size ) flush_page();
+
+    placements.push_back( { key, cursor } );
+    extent = { std::max( extent.x, cursor.x + size.x ), std::max( extent.y, cursor.y + size.y ) };
+    shelf_height = std::max( shelf_height, size.y );
+    cursor.x += size.x + kPadding;
+  }
+  flush_page();
+
+  m_images.clear();
+}
+
+} // namespace ProceduralMaze::Sprites
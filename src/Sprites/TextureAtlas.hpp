@@ -0,0 +1,73 @@
+#ifndef SRC_SPRITES_TEXTUREATLAS_HPP_
+#define SRC_SPRITES_TEXTUREATLAS_HPP_
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <filesystem>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace ProceduralMaze::Sprites
+{
+
+//! @brief Packs a set of tilemap images into as few atlas textures ("pages") as possible, so sprites sharing a page
+//! can be drawn without rebinding textures.
+//! @note Usage: `add()` every image, then `build()` once. Uses simple shelf packing, tallest images first.
+class TextureAtlas
+{
+public:
+  //! @brief Where an image ended up in the atlas
+  struct Region
+  {
+    std::shared_ptr<sf::Texture> page;
+    sf::IntRect rect;
+  };
+
+  //! @brief Load the image at `path` for packing. Adding the same path twice is a no-op.
+  //! @param path
+  //! @throws std::runtime_error If the image fails to load
+  void add( const std::filesystem::path &path );
+
+  //! @brief Add an image that has already been loaded, e.g. by a Utils::AssetLoader job. Adding the same path twice is a no-op.
+  //! @param path The key for `region()`
+  //! @param image
+  void add( const std::filesystem::path &path, sf::Image image );
+
+  //! @brief Load the image at `path`. Safe to call from any thread, it does not touch the GPU.
+  //! @param path
+  //! @throws std::runtime_error If the image fails to load
+  static sf::Image load_image( const std::filesystem::path &path );
+
+  //! @brief Pack every added image into atlas pages and upload them to the GPU. Images are released afterwards.
+  //! @param upload With false (headless runs) the regions are laid out the same but the pages are left as empty textures,
+  //! so no OpenGL context is needed
+  //! @throws std::runtime_error If an image is larger than the maximum page size or a page fails to upload
+  void build( bool upload = true );
+
+  //! @brief Get the atlas region for `path`. Only valid after `build()`.
+  //! @param path
+  //! @throws std::out_of_range If `path` was never added
+  const Region &region( const std::filesystem::path &path ) const { return m_regions.at( path.generic_string() ); }
+
+  std::size_t page_count() const { return m_pages.size(); }
+
+private:
+  //! @brief transparent gap between packed images
+  static constexpr unsigned int kPadding = 1;
+
+  //! @brief upper limit for the page size, clamped to what the GPU supports
+  static constexpr unsigned int kMaxPageSize = 4096;
+
+  //! @brief images waiting to be packed, keyed by generic path string
+  std::unordered_map<std::string, sf::Image> m_images;
+
+  std::vector<std::shared_ptr<sf::Texture>> m_pages;
+  std::unordered_map<std::string, Region> m_regions;
+};
+
+} // namespace ProceduralMaze::Sprites
+
+#endif // SRC_SPRITES_TEXTUREATLAS_HPP_
@@ -5,11 +5,15 @@
 #include <Sprites/TileMap.hpp>
 
 #include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <Systems/Render/RenderSystem.hpp>
 #include <Utils.hpp>
+#include <Utils/Optimizations.hpp>
 #include <entt/entity/registry.hpp>
 #include <nlohmann/json.hpp>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <stdexcept>
 
 namespace ProceduralMaze::Sprites::Containers
@@ -17,8 +21,8 @@ namespace ProceduralMaze::Sprites::Containers
 
 void TileMap::draw( sf::RenderTarget &target, sf::RenderStates states ) const
 {
-  SPDLOG_DEBUG( "TileMap::draw - instance: {}, vertices: {}", (void *)this, m_vertices.getVertexCount() );
-  if ( m_vertices.getVertexCount() == 0 )
+  SPDLOG_DEBUG( "TileMap::draw - instance: {}, chunks: {}", (void *)this, m_chunks.size() );
+  if ( m_chunks.empty() )
   {
     SPDLOG_WARN( "Attempting to draw empty tilemap" );
     return;
@@ -30,8 +34,29 @@ void TileMap::draw( sf::RenderTarget &target, sf::RenderStates states ) const
   // apply the tileset texture
   states.texture = &m_tileset;
 
-  // draw the vertex array
-  target.draw( m_vertices, states );
+  // only draw the chunks that overlap the view, in local space
+  const sf::FloatRect view_bounds = states.transform.getInverse().transformRect( Utils::calculate_view_bounds( target.getView() ) );
+  for ( const auto &chunk : m_chunks )
+  {
+    if ( not Utils::is_visible_in_view( view_bounds, chunk.bounds ) ) continue;
+
+    if ( not sf::VertexBuffer::isAvailable() )
+    {
+      target.draw( chunk.vertices.data(), chunk.vertices.size(), sf::PrimitiveType::Triangles, states );
+      continue;
+    }
+    if ( not chunk.uploaded )
+    {
+      if ( not chunk.buffer.create( chunk.vertices.size() ) || not chunk.buffer.update( chunk.vertices.data() ) )
+      {
+        SPDLOG_ERROR( "Unable to upload tilemap chunk vertex buffer" );
+        target.draw( chunk.vertices.data(), chunk.vertices.size(), sf::PrimitiveType::Triangles, states );
+        continue;
+      }
+      chunk.uploaded = true;
+    }
+    target.draw( chunk.buffer, states );
+  }
 }
 
 void TileMap::create( const PathFinding::SpatialHashGrid &void_sm, const Scene::SceneMapSharedPtr &sc )
@@ -39,6 +64,7 @@ void TileMap::create( const PathFinding::SpatialHashGrid &void_sm, const Scene::
   if ( not sc ) throw std::runtime_error( "Scene::SceneConfigSharedPtr is not initialised" );
 
   // load the tilemap from the scene configuration object
+  sf::Vector2u texture_size;
   try
   {
     if ( !std::filesystem::exists( sc->floor_tileset_image() ) )
@@ -46,10 +72,25 @@ void TileMap::create( const PathFinding::SpatialHashGrid &void_sm, const Scene::
       SPDLOG_CRITICAL( "Texture file does not exist: {}", sc->floor_tileset_image().string() );
       throw std::runtime_error( "Texture file not found" );
     }
-    if ( !m_tileset.loadFromFile( sc->floor_tileset_image() ) )
+    if ( Sys::RenderSystem::is_headless() )
+    {
+      // nothing is drawn, the tileset is only needed for its size, so decode it without creating a texture
+      sf::Image tileset_image;
+      if ( !tileset_image.loadFromFile( sc->floor_tileset_image() ) )
+      {
+        SPDLOG_CRITICAL( "Unable to load tileset image file: {}", sc->floor_tileset_image().string() );
+        throw std::runtime_error( "Failed to load image" );
+      }
+      texture_size = tileset_image.getSize();
+    }
+    else
     {
-      SPDLOG_CRITICAL( "Unable to load tileset texture file: {}", sc->floor_tileset_image().string() );
-      throw std::runtime_error( "Failed to load texture" );
+      if ( !m_tileset.loadFromFile( sc->floor_tileset_image() ) )
+      {
+        SPDLOG_CRITICAL( "Unable to load tileset texture file: {}", sc->floor_tileset_image().string() );
+        throw std::runtime_error( "Failed to load texture" );
+      }
+      texture_size = m_tileset.getSize();
     }
 
   } catch ( const std::exception &e )
@@ -59,16 +100,28 @@ void TileMap::create( const PathFinding::SpatialHashGrid &void_sm, const Scene::
   }
 
   // Validate texture is loaded before creating vertices
-  if ( m_tileset.getSize().x == 0 || m_tileset.getSize().y == 0 )
+  if ( texture_size.x == 0 || texture_size.y == 0 )
   {
     SPDLOG_ERROR( "Tileset texture not loaded or invalid" );
     throw;
   }
   const auto tile_size = Constants::kGridSizePx;
-  const sf::Vector2u texture_size = m_tileset.getSize();
   const unsigned int tiles_per_row = texture_size.x / tile_size.x;
+  const int last_tile = std::max( static_cast<int>( tiles_per_row * ( texture_size.y / tile_size.y ) ) - 1, 0 );
 
-  Cmp::RandomInt floortile_picker{ 0, static_cast<int>( sc->floor_tileset_pool().size() - 1 ) };
+  // an index outside the tileset would sample outside the texture. Clamp rather than drop it, so the picker below
+  // draws the same random numbers whatever the scene data holds
+  auto floor_tiles = sc->floor_tileset_pool();
+  for ( auto &tile_number : floor_tiles )
+  {
+    if ( tile_number >= 0 && tile_number <= last_tile ) continue;
+    const int clamped = std::clamp( tile_number, 0, last_tile );
+    SPDLOG_ERROR( "Floor tile index {} is outside the {} tiles of {}, clamped to {}", tile_number, last_tile + 1,
+                  sc->floor_tileset_image().string(), clamped );
+    tile_number = clamped;
+  }
+
+  Cmp::RandomInt floortile_picker{ 0, static_cast<int>( sc->floor_tileset_pool().size() - 1 ), Utils::Rnd::Stream::PROCGEN };
   // let json fix seed if specified as non-zero
   // if ( sc->get_random_seed() != 0 )
   // {
@@ -76,52 +129,97 @@ void TileMap::create( const PathFinding::SpatialHashGrid &void_sm, const Scene::
   //   SPDLOG_DEBUG( "Using random seed: {}", sc->random_seed );
   // }
 
-  // resize the vertex array for squares made of two triangles
-  m_vertices.setPrimitiveType( sf::PrimitiveType::Triangles );
-
   auto [map_size_grid, map_size_pixel] = sc->map_size();
 
+  // allocate every chunk up front; tiles start out empty (degenerate)
+  m_tiles_per_row = tiles_per_row;
+  m_chunk_count = { ( map_size_grid.x + kChunkSize - 1 ) / kChunkSize, ( map_size_grid.y + kChunkSize - 1 ) / kChunkSize };
+  m_chunks.clear();
+  m_chunks.resize( static_cast<std::size_t>( m_chunk_count.x ) * m_chunk_count.y );
+  const sf::Vector2f chunk_size_px{ static_cast<float>( kChunkSize * tile_size.x ), static_cast<float>( kChunkSize * tile_size.y ) };
+  for ( unsigned int cy = 0; cy < m_chunk_count.y; cy++ )
+  {
+    for ( unsigned int cx = 0; cx < m_chunk_count.x; cx++ )
+    {
+      auto &chunk = m_chunks[cy * m_chunk_count.x + cx];
+      chunk.bounds = sf::FloatRect( { cx * chunk_size_px.x, cy * chunk_size_px.y }, chunk_size_px );
+      chunk.vertices.assign( kVerticesPerChunk, sf::Vertex{ .position = chunk.bounds.position, .color = sf::Color::White } );
+    }
+  }
+
   SPDLOG_INFO( "Generating tilemap for {}x{}", map_size_grid.x, map_size_grid.y );
+  std::size_t tile_count = 0;
   for ( unsigned int w = 0; w < map_size_grid.x; w++ )
   {
     for ( unsigned int h = 0; h < map_size_grid.y; h++ )
     {
       auto pick = floortile_picker.gen();
       SPDLOG_DEBUG( "Chosen tile idx {}", pick );
-      const unsigned int tile_number = sc->floor_tileset_pool()[pick];
+      const unsigned int tile_number = floor_tiles[pick];
 
       // check if we have anything in the void spatial map for this position
       Cmp::Position lookup_position( { w * Constants::kGridSizePxF.x, h * Constants::kGridSizePxF.y }, Constants::kGridSizePxF );
 
-      auto results = void_sm.at( lookup_position );
-      if ( not results.empty() ) continue;
-
-      // find its position in the tileset texture
-      const unsigned int tu = tile_number % tiles_per_row;
-      const unsigned int tv = tile_number / tiles_per_row;
-
-      // Cache position calculations
-      const auto left = static_cast<float>( w * tile_size.x );
-      const auto top = static_cast<float>( h * tile_size.y );
-      const auto right = static_cast<float>( ( w + 1 ) * tile_size.x );
-      const auto bottom = static_cast<float>( ( h + 1 ) * tile_size.y );
-
-      const auto tex_left = static_cast<float>( tu * tile_size.x );
-      const auto tex_top = static_cast<float>( tv * tile_size.y );
-      const auto tex_right = static_cast<float>( ( tu + 1 ) * tile_size.x );
-      const auto tex_bottom = static_cast<float>( ( tv + 1 ) * tile_size.y );
-
-      // define the 6 corners of the two triangles (counter-clockwise)
-      m_vertices.append( { .position = { left, top }, .color = sf::Color::White, .texCoords = { tex_left, tex_top } } );
-      m_vertices.append( { .position = { right, top }, .color = sf::Color::White, .texCoords = { tex_right, tex_top } } );
-      m_vertices.append( { .position = { left, bottom }, .color = sf::Color::White, .texCoords = { tex_left, tex_bottom } } );
-      m_vertices.append( { .position = { left, bottom }, .color = sf::Color::White, .texCoords = { tex_left, tex_bottom } } );
-      m_vertices.append( { .position = { right, top }, .color = sf::Color::White, .texCoords = { tex_right, tex_top } } );
-      m_vertices.append( { .position = { right, bottom }, .color = sf::Color::White, .texCoords = { tex_right, tex_bottom } } );
+      bool is_void = false;
+      void_sm.for_each_at( lookup_position,
+                           [&]( entt::entity )
+                           {
+                             is_void = true;
+                             return false;
+                           } );
+      if ( is_void ) continue;
+
+      set_tile( w, h, tile_number );
+      tile_count++;
     }
   }
 
-  SPDLOG_INFO( "Created tilemap: {} vertices", m_vertices.getVertexCount() );
+  SPDLOG_INFO( "Created tilemap: {} tiles in {}x{} chunks", tile_count, m_chunk_count.x, m_chunk_count.y );
+}
+
+void TileMap::set_tile( unsigned int x, unsigned int y, std::optional<unsigned int> tile_number )
+{
+  const sf::Vector2u chunk_pos{ x / kChunkSize, y / kChunkSize };
+  if ( chunk_pos.x >= m_chunk_count.x || chunk_pos.y >= m_chunk_count.y ) return;
+  auto &chunk = m_chunks[chunk_pos.y * m_chunk_count.x + chunk_pos.x];
+  const std::size_t offset = ( ( y % kChunkSize ) * kChunkSize + ( x % kChunkSize ) ) * kVerticesPerTile;
+  sf::Vertex *quad = &chunk.vertices[offset];
+
+  if ( not tile_number )
+  {
+    for ( std::size_t i = 0; i < kVerticesPerTile; ++i )
+      quad[i] = sf::Vertex{ .position = chunk.bounds.position, .color = sf::Color::White };
+  }
+  else
+  {
+    const auto tile_size = Constants::kGridSizePx;
+
+    // find its position in the tileset texture
+    const unsigned int tu = *tile_number % m_tiles_per_row;
+    const unsigned int tv = *tile_number / m_tiles_per_row;
+
+    // Cache position calculations
+    const auto left = static_cast<float>( x * tile_size.x );
+    const auto top = static_cast<float>( y * tile_size.y );
+    const auto right = static_cast<float>( ( x + 1 ) * tile_size.x );
+    const auto bottom = static_cast<float>( ( y + 1 ) * tile_size.y );
+
+    const auto tex_left = static_cast<float>( tu * tile_size.x );
+    const auto tex_top = static_cast<float>( tv * tile_size.y );
+    const auto tex_right = static_cast<float>( ( tu + 1 ) * tile_size.x );
+    const auto tex_bottom = static_cast<float>( ( tv + 1 ) * tile_size.y );
+
+    // define the 6 corners of the two triangles (counter-clockwise)
+    quad[0] = { .position = { left, top }, .color = sf::Color::White, .texCoords = { tex_left, tex_top } };
+    quad[1] = { .position = { right, top }, .color = sf::Color::White, .texCoords = { tex_right, tex_top } };
+    quad[2] = { .position = { left, bottom }, .color = sf::Color::White, .texCoords = { tex_left, tex_bottom } };
+    quad[3] = { .position = { left, bottom }, .color = sf::Color::White, .texCoords = { tex_left, tex_bottom } };
+    quad[4] = { .position = { right, top }, .color = sf::Color::White, .texCoords = { tex_right, tex_top } };
+    quad[5] = { .position = { right, bottom }, .color = sf::Color::White, .texCoords = { tex_right, tex_bottom } };
+  }
+
+  // patch just this tile in the GPU copy; chunks that were never drawn upload everything on first draw
+  if ( chunk.uploaded && not chunk.buffer.update( quad, kVerticesPerTile, static_cast<unsigned int>( offset ) ) ) { chunk.uploaded = false; }
 }
 
 void TileMap::remove( sf::Vector2f pos )
@@ -129,47 +227,12 @@ void TileMap::remove( sf::Vector2f pos )
   // Snap to grid to ensure position matches tilemap vertex positions
   pos = Utils::snap_to_grid( pos );
 
-  // determine the vertices to remove
-  const auto left = static_cast<float>( pos.x );
-  const auto top = static_cast<float>( pos.y );
-  const auto right = static_cast<float>( pos.x + Constants::kGridSizePxF.x );
-  const auto bottom = static_cast<float>( pos.y + Constants::kGridSizePxF.y );
-
-  // clang-format off
-  const std::array<sf::Vector2f, 4> tile_corners = {
-    sf::Vector2f{ left, top },
-    sf::Vector2f{ right, top },
-    sf::Vector2f{ left, bottom },
-    sf::Vector2f{ right, bottom }
-  };
-  // clang-format on
-
-  auto is_tile_vertex = [&]( const sf::Vertex &v )
-  {
-    for ( const auto &corner : tile_corners )
-    {
-      if ( v.position == corner ) return true;
-    }
-    return false;
-  };
+  if ( pos.x < 0.f || pos.y < 0.f ) return;
 
-  // Tiles are stored as groups of 6 vertices; skip any group where the first vertex matches the tile
-  sf::VertexArray new_vertices( sf::PrimitiveType::Triangles );
-  const auto count = m_vertices.getVertexCount();
-  for ( size_t i = 0; i + 5 < count; i += 6 )
-  {
-    if ( is_tile_vertex( m_vertices[i] ) && is_tile_vertex( m_vertices[i + 1] ) && is_tile_vertex( m_vertices[i + 2] ) )
-    {
-      SPDLOG_DEBUG( "sinkhole collided with tile at {},{}", pos.x, pos.y );
-      continue; // skip this tile's 6 vertices
-    }
-    for ( size_t j = i; j < i + 6; ++j )
-    {
-      new_vertices.append( m_vertices[j] );
-    }
-  }
-  // Move the vertices that dont collide into the new `m_vertices`
-  m_vertices = std::move( new_vertices );
+  const sf::Vector2u grid_pos{ static_cast<unsigned int>( pos.x / Constants::kGridSizePxF.x ),
+                               static_cast<unsigned int>( pos.y / Constants::kGridSizePxF.y ) };
+  SPDLOG_DEBUG( "sinkhole collided with tile at {},{}", pos.x, pos.y );
+  set_tile( grid_pos.x, grid_pos.y, std::nullopt );
 }
 
 } // namespace ProceduralMaze::Sprites::Containers
\ No newline at end of file
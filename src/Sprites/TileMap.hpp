@@ -6,6 +6,9 @@
 #include <SceneControl/SceneData.hpp>
 #include <entt/entity/fwd.hpp>
 
+#include <optional>
+#include <vector>
+
 namespace ProceduralMaze::PathFinding
 {
 class SpatialHashGrid;
@@ -14,28 +17,61 @@ class SpatialHashGrid;
 namespace ProceduralMaze::Sprites::Containers
 {
 
+//! @brief The floor of a scene, split into square chunks of tiles that each have their own (static) vertex buffer.
+//! Every tile owns a fixed run of 6 vertices in its chunk, so changing a tile only rewrites those vertices,
+//! and `draw()` only submits the chunks that overlap the target's view.
 class TileMap : public sf::Drawable, public sf::Transformable
 {
 public:
   TileMap() = default;
 
-  // Draw the sf::VertexArray to the render target (with optional state for shader)
+  // Draw the visible chunks to the render target (with optional state for shader)
   void draw( sf::RenderTarget &target, sf::RenderStates states ) const override;
 
-  void clear() { m_vertices.clear(); }
+  void clear()
+  {
+    m_chunks.clear();
+    m_chunk_count = { 0, 0 };
+  }
   sf::Vector2u world_grid_offset{ 0, 0 };
 
-  // Create the tile map using a single large sf::VertexArray
+  // Create the tile map chunks
   void create( const PathFinding::SpatialHashGrid &void_sm, const Scene::SceneMapSharedPtr &scene_map );
 
+  //! @brief Remove the tile at `pos`. Only the vertices of that tile are updated.
   void remove( sf::Vector2f pos );
 
+  //! @brief Width/height of a chunk, in tiles
+  static constexpr unsigned int kChunkSize = 16;
+
 private:
-  sf::VertexArray m_vertices;
+  static constexpr std::size_t kVerticesPerTile = 6;
+  static constexpr std::size_t kVerticesPerChunk = kChunkSize * kChunkSize * kVerticesPerTile;
+
+  struct Chunk
+  {
+    //! @brief Local bounds of the chunk, for view culling
+    sf::FloatRect bounds;
+
+    //! @brief `kVerticesPerTile` per tile, row-major. Missing tiles are degenerate (all vertices at the same point).
+    std::vector<sf::Vertex> vertices;
+
+    //! @brief GPU copy of `vertices`, uploaded on first draw
+    mutable sf::VertexBuffer buffer{ sf::PrimitiveType::Triangles, sf::VertexBuffer::Usage::Static };
+    mutable bool uploaded{ false };
+  };
+
+  //! @brief Write the 6 vertices of the tile at grid position (`x`, `y`), or make it degenerate when `tile_number` is empty
+  void set_tile( unsigned int x, unsigned int y, std::optional<unsigned int> tile_number );
+
+  std::vector<Chunk> m_chunks;
+  sf::Vector2u m_chunk_count{ 0, 0 };
+  unsigned int m_tiles_per_row{ 1 };
+
   sf::Texture m_tileset;
   sf::Clock m_clock{};
 };
 
 } // namespace ProceduralMaze::Sprites::Containers
 
-#endif // __SPRITES_TILEMAP_HPP__
\ No newline at end of file
+#endif // __SPRITES_TILEMAP_HPP__
@@ -11,6 +11,7 @@
 #include <Factory/PlayerFactory.hpp>
 #include <Systems/AltarSystem.hpp>
 
+#include <Audio/Effects.hpp>
 #include <Audio/SoundBank.hpp>
 #include <Components/AbsoluteAlpha.hpp>
 #include <Components/Altar/AltarMultiBlock.hpp>
@@ -93,7 +94,7 @@ void AltarSystem::check_player_altar_activation( entt::entity altar_entity, Cmp:
     // get the center (topleft coord), then adjust to center the altar_sacrifice_anim, then adjust for altar_sacrifice_anim height
     Cmp::Position new_pos( altar_cmp.getCenter() - sf::Vector2{ 8.f, 4.f } - sf::Vector2{ 0.f, altar_sacrifice_anim_height },
                            Constants::kGridSizePxF );
-    m_sound_bank.get_effect( "shrine_lighting" ).play();
+    m_sound_bank.play( Audio::Effect::kShrineLighting );
     Factory::create_altar_sacrifice_anim( reg(), new_pos, sprite_type );
 
     m_altar_activation_clock.restart();
@@ -199,7 +200,7 @@ void AltarSystem::check_player_altar_activation( entt::entity altar_entity, Cmp:
       if ( sacrifice_type.contains( "sprite.item.relic" ) )
       {
         key_entt = Factory::create_world_item( reg(), Utils::Player::get_position( reg() ), "item.exitkey" );
-        if ( key_entt != entt::null ) { m_sound_bank.get_effect( "drop_loot" ).play(); }
+        if ( key_entt != entt::null ) { m_sound_bank.play( Audio::Effect::kDropLoot ); }
         // signal UI to flash
         auto flash_entt = reg().create();
         reg().emplace_or_replace<Cmp::FlashUIInventory>( flash_entt );
@@ -218,7 +219,7 @@ void AltarSystem::check_player_altar_activation( entt::entity altar_entity, Cmp:
       if ( sacrifice_type.contains( "sprite.item.exitkey" ) )
       {
         key_entt = Factory::create_world_item( reg(), Utils::Player::get_position( reg() ), "item.cryptkey" );
-        if ( key_entt != entt::null ) { m_sound_bank.get_effect( "drop_loot" ).play(); }
+        if ( key_entt != entt::null ) { m_sound_bank.play( Audio::Effect::kDropLoot ); }
         // signal UI to flash
         auto flash_entt = reg().create();
         reg().emplace_or_replace<Cmp::FlashUIInventory>( flash_entt );
@@ -4,6 +4,7 @@
 #include <Components/Altar/AltarMultiBlock.hpp>
 #include <Events/PlayerActionEvent.hpp>
 #include <Systems/BaseSystem.hpp>
+#include <Utils/GameClock.hpp>
 
 namespace ProceduralMaze::Sys
 {
@@ -26,7 +27,7 @@ private:
   void check_player_altar_activation( entt::entity altar_entity, Cmp::AltarMultiBlock &altar_cmp );
   bool activate_altar_special_power();
 
-  sf::Clock m_altar_activation_clock;
+  Utils::GameClock m_altar_activation_clock;
   const sf::Time kActivationCooldownSeconds{ sf::seconds( 3.f ) };
 };
 
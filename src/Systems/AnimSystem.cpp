@@ -25,8 +25,10 @@
 #include <Components/Wormhole/WormholeMultiBlock.hpp>
 #include <Components/Wormhole/WormholeSingularity.hpp>
 #include <Components/ZOrderValue.hpp>
+#include <Debug/Profiler.hpp>
 #include <Persistent/NpcWitchAnimFramerate.hpp>
 #include <Sprites/SpriteFactory.hpp>
+#include <Sprites/SpriteTypes.hpp>
 #include <Systems/AnimSystem.hpp>
 #include <Systems/PersistSystem.hpp>
 #include <Systems/PersistSystemImpl.hpp>
@@ -41,6 +43,7 @@ namespace ProceduralMaze::Sys
 
 void AnimSystem::update( sf::Time dt )
 {
+  PROFILE_ZONE( "AnimSystem::update" );
 
   auto anim_view = reg().view<Cmp::SpriteAnimation, Cmp::Position>( entt::exclude<Cmp::NPC> );
   for ( auto [anim_entt, anim_cmp, pos_cmp] : anim_view.each() )
@@ -107,15 +110,15 @@ void AnimSystem::update( sf::Time dt )
     {
 
       sf::Time frame_rate = sf::Time::Zero;
-      if ( anim_cmp.m_sprite_type.contains( "sprite.skeleton" ) )
+      if ( anim_cmp.m_sprite_type.is_a( Sprites::Type::kSkeleton ) )
       {
         frame_rate = sf::seconds( Sys::PersistSystem::get<Cmp::Persist::NpcSkeleAnimFramerate>( reg() ).get_value() );
       }
-      else if ( anim_cmp.m_sprite_type.contains( "sprite.ghost" ) )
+      else if ( anim_cmp.m_sprite_type.is_a( Sprites::Type::kGhost ) )
       {
         frame_rate = sf::seconds( Sys::PersistSystem::get<Cmp::Persist::NpcGhostAnimFramerate>( reg() ).get_value() );
       }
-      else if ( anim_cmp.m_sprite_type.contains( "sprite.witch" ) )
+      else if ( anim_cmp.m_sprite_type.is_a( Sprites::Type::kWitch ) )
       {
         frame_rate = sf::seconds( Sys::PersistSystem::get<Cmp::Persist::NpcWitchAnimFramerate>( reg() ).get_value() );
       }
@@ -1,10 +1,12 @@
 #include <Constants.hpp>
+#include <Debug/Profiler.hpp>
 #include <Events/DropInventoryEvent.hpp>
 #include <Factory/MultiblockFactory.hpp>
 #include <Player/PlayerNoPath.hpp>
 #include <VoidPosition.hpp>
 #define SPDLOG_ACTIVE_LEVEL SPDLOG_LEVEL_INFO
 
+#include <Audio/Effects.hpp>
 #include <Audio/SoundBank.hpp>
 #include <Components/Altar/AltarMultiBlock.hpp>
 #include <Components/Crypt/CryptChest.hpp>
@@ -89,6 +91,7 @@ void CryptSystem::setup()
 
 void CryptSystem::update()
 {
+  PROFILE_ZONE( "CryptSystem::update" );
 
   check_exit_collision();
 
@@ -230,7 +233,7 @@ void CryptSystem::unlock_crypt_door()
     Factory::destroy_inventory( reg(), "sprite.item.cryptkey" );
 
     // player_key_count->decrement_count( 1 );
-    m_sound_bank.get_effect( "crypt_open" ).play();
+    m_sound_bank.play( Audio::Effect::kCryptOpen );
     cryptdoor_cmp.set_is_open( true );
     reg().remove<Cmp::PlayerNoPath>( door_entity );
 
@@ -275,7 +278,7 @@ void CryptSystem::check_objective_activation( Events::PlayerActionEvent::GameAct
                                                       Factory::ExcludePack<Cmp::PlayerCharacter, Cmp::CryptObjectiveSegment>{} );
         if ( obst_entity != entt::null )
         {
-          m_sound_bank.get_effect( "drop_loot" ).play();
+          m_sound_bank.play( Audio::Effect::kDropLoot );
           objective_cmp.increment_activation_count();
           SPDLOG_INFO( "Player activated crypt objective." );
 
@@ -310,7 +313,7 @@ void CryptSystem::check_lever_activation()
       unsigned int enabled_lever_sprite_idx = 1;
       reg().emplace_or_replace<Cmp::SpriteAnimation>( lever_entt, 0, 0, true, lever_sprite_type, enabled_lever_sprite_idx );
 
-      m_sound_bank.get_effect( "crypt_lever_open" ).play();
+      m_sound_bank.play( Audio::Effect::kCryptLeverOpen );
       SPDLOG_DEBUG( "Lever enabled at {},{} - Count:{}", lever_pos_cmp.position.x, lever_pos_cmp.position.y, m_enabled_levers );
 
       // check if we have activated enough levers to access the maze objective
@@ -344,7 +347,7 @@ void CryptSystem::check_chest_activation( Events::PlayerActionEvent::GameActions
 
       chest_cmp.open = true;
       chest_anim_cmp.m_animation_active = true;
-      m_sound_bank.get_effect( "crypt_chest_open" ).play();
+      m_sound_bank.play( Audio::Effect::kCryptChestOpen );
 
       // clang-format off
       auto loot_entt = Factory::create_loot_drop( 
@@ -357,7 +360,7 @@ void CryptSystem::check_chest_activation( Events::PlayerActionEvent::GameActions
         64.f);
       // clang-format on
 
-      if ( loot_entt != entt::null ) m_sound_bank.get_effect( "drop_loot" ).play();
+      if ( loot_entt != entt::null ) m_sound_bank.play( Audio::Effect::kDropLoot );
     }
   }
 }
@@ -416,7 +419,7 @@ void CryptSystem::shuffle_rooms_passages()
 
   add_lever_to_open_rooms();
 
-  m_sound_bank.get_effect( "crypt_room_shuffle" ).play();
+  m_sound_bank.play( Audio::Effect::kCryptRoomShuffle );
   Scene::CryptScene::get_maze_timer().restart();
 }
 
@@ -652,7 +655,7 @@ void CryptSystem::unlock_objective_passage()
   SPDLOG_DEBUG( "~~~~~~~~~~~ OPENING FINAL PASSAGE ~~~~~~~~~~~~~~~" );
   get_systems_event_queue().trigger( Events::PassageEvent( Events::PassageEvent::Type::CONNECT_OCCUPIED_TO_ENDROOM, get_crypt_room_end().first ) );
   get_systems_event_queue().trigger( Events::PassageEvent( Events::PassageEvent::Type::OPEN_PASSAGES ) );
-  m_sound_bank.get_effect( "crypt_room_shuffle" ).play();
+  m_sound_bank.play( Audio::Effect::kCryptRoomShuffle );
 
   // switch on the lights so we can see the objective in all its glory!
   for ( auto [entt, sys_cmp] : reg().view<Cmp::System>().each() )
@@ -728,16 +731,16 @@ void CryptSystem::fill_closed_rooms()
   }
 }
 
-void CryptSystem::open_selected_rooms( std::set<entt::entity> selected_rooms )
+void CryptSystem::open_selected_rooms( const std::vector<entt::entity> &selected_rooms )
 {
   std::vector<std::pair<entt::entity, Cmp::CryptRoomClosed>> rooms_to_open;
-  auto closed_room_view = reg().view<Cmp::CryptRoomClosed>();
-  for ( auto [closed_room_entt, closed_room_cmp] : closed_room_view.each() )
+  for ( auto selected_room_entt : selected_rooms )
   {
-    if ( selected_rooms.find( closed_room_entt ) == selected_rooms.end() ) continue;
+    auto *closed_room_cmp = reg().try_get<Cmp::CryptRoomClosed>( selected_room_entt );
+    if ( not closed_room_cmp ) continue;
 
     // save the CryptRoomClosed entities we want to change to CryptRoomOpen
-    rooms_to_open.push_back( { closed_room_entt, closed_room_cmp } );
+    rooms_to_open.push_back( { selected_room_entt, *closed_room_cmp } );
   }
 
   // open the room safely outside of view loop
@@ -754,12 +757,8 @@ void CryptSystem::open_selected_rooms( std::set<entt::entity> selected_rooms )
 
 void CryptSystem::open_all_rooms()
 {
-  std::set<entt::entity> all_rooms;
-  for ( auto [closed_room_entt, closed_room_cmp] : reg().view<Cmp::CryptRoomClosed>().each() )
-  {
-    all_rooms.insert( closed_room_entt );
-  }
-  open_selected_rooms( all_rooms );
+  auto closed_room_view = reg().view<Cmp::CryptRoomClosed>();
+  open_selected_rooms( std::vector<entt::entity>( closed_room_view.begin(), closed_room_view.end() ) );
 }
 
 void CryptSystem::empty_open_rooms()
@@ -891,13 +890,12 @@ void CryptSystem::check_lava_pit_activation_by_proximity()
   // finally play/stop sound if any/all lava pits activated/deactivated
   if ( num_lava_pits_intersect > 0 )
   {
-    auto sfx_status = m_sound_bank.get_effect( "bubbling_lava" ).getStatus();
-    if ( sfx_status != sf::Sound::Status::Playing ) m_sound_bank.get_effect( "bubbling_lava" ).play();
+    m_sound_bank.play_once( Audio::Effect::kBubblingLava, Audio::SoundBank::Priority::LOW );
   }
   else
   {
     //
-    m_sound_bank.get_effect( "bubbling_lava" ).stop();
+    m_sound_bank.stop( Audio::Effect::kBubblingLava );
   }
 }
 
@@ -934,8 +932,7 @@ void CryptSystem::check_spike_trap_activation_by_proximity()
       spike_trap_anim_cmp.m_animation_active = true;
       spike_trap_cmp.m_cooldown_timer.reset();
 
-      auto sfx_status = m_sound_bank.get_effect( "spike_trap" ).getStatus();
-      if ( sfx_status != sf::Sound::Status::Playing ) { m_sound_bank.get_effect( "spike_trap" ).play(); }
+      m_sound_bank.play_once( Audio::Effect::kSpikeTrap );
     }
     else if ( not player_hitbox_disable.findIntersection( spike_trap_hitbox ) )
     {
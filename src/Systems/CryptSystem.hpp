@@ -9,8 +9,9 @@
 
 #include <SpatialHashGrid.hpp>
 #include <Systems/BaseSystem.hpp>
+#include <Utils/GameClock.hpp>
 
-#include <set>
+#include <vector>
 
 namespace ProceduralMaze::Sys
 {
@@ -109,9 +110,9 @@ private:
   void fill_closed_rooms();
 
   //! @brief Change selected Cmp::CryptRoomClosed to Cmp::CryptRoomOpen.
-  //! @param selected_rooms Set of entity ids to open
+  //! @param selected_rooms Entity ids to open; ids that are not closed rooms are skipped
   //! @note Removes Cmp::Obstacle
-  void open_selected_rooms( std::set<entt::entity> selected_rooms );
+  void open_selected_rooms( const std::vector<entt::entity> &selected_rooms );
 
   //! @brief Open all rooms
   void open_all_rooms();
@@ -177,7 +178,7 @@ private:
   entt::dispatcher &m_scenemanager_event_dispatcher;
 
   //! @brief Prevents rapid external entrance door unlocking
-  sf::Clock m_door_cooldown_timer;
+  Utils::GameClock m_door_cooldown_timer;
   float m_door_cooldown_time{ 1.0f }; // 1 second cooldown
 
   //! @brief Number of enabled levers
@@ -186,7 +187,7 @@ private:
   //! @brief Indicates if the maze was unlocked this cycle
   bool m_maze_unlocked{ false };
 
-  sf::Clock m_lava_effect_cooldown_timer;
+  Utils::GameClock m_lava_effect_cooldown_timer;
   sf::Time m_lava_effect_cooldown_threshold{ sf::seconds( 1.f ) };
 
   PathFinding::SpatialHashGridWeakPtr m_pathfinding_navmesh;
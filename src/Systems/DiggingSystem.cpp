@@ -1,9 +1,11 @@
 
+#include <Debug/Profiler.hpp>
 #include <Events/DropInventoryEvent.hpp>
 #include <Player/PlayerNoPath.hpp>
 #include <Systems/Stores/ItemStore.hpp>
 #define SPDLOG_ACTIVE_LEVEL SPDLOG_LEVEL_INFO
 
+#include <Audio/Effects.hpp>
 #include <Audio/SoundBank.hpp>
 #include <Components/AbsoluteAlpha.hpp>
 #include <Components/DestroyedObstacle.hpp>
@@ -57,6 +59,7 @@ DiggingSystem::DiggingSystem( entt::registry &reg, sf::RenderWindow &window, Spr
 
 void DiggingSystem::update( sf::Time dt )
 {
+  PROFILE_ZONE( "DiggingSystem::update" );
 
   // abort if still in cooldown
   auto digging_cooldown_amount = Sys::PersistSystem::get<Cmp::Persist::DiggingCooldownThreshold>( reg() ).get_value();
@@ -142,7 +145,7 @@ void DiggingSystem::check_player_smash_pot()
       {
         loot_anim_cmp.m_animation_active = true;
 
-        if ( m_sound_bank.get_effect( "hit_pot" ).getStatus() == sf::Sound::Status::Stopped ) m_sound_bank.get_effect( "hit_pot" ).play();
+        m_sound_bank.play_once( Audio::Effect::kHitPot );
       }
       else
       {
@@ -151,7 +154,7 @@ void DiggingSystem::check_player_smash_pot()
         SPDLOG_INFO( "Pot revealed {}", selected_type );
         Factory::create_world_item( reg(), loot_pos_cmp, selected_type );
 
-        m_sound_bank.get_effect( "break_pot" ).play();
+        m_sound_bank.play( Audio::Effect::kBreakPot );
         auto inventory_wear_view = reg().view<Cmp::PlayerInventorySlot, Cmp::InventoryWearLevel>();
         for ( auto [weapons_entity, inventory_slot, wear_level] : inventory_wear_view.each() )
         {
@@ -229,7 +232,7 @@ void DiggingSystem::check_player_dig_obstacle_collision()
       if ( alpha_cmp.getAlpha() == 0 )
       {
         // select the final smash sound
-        m_sound_bank.get_effect( "pickaxe_final" ).play();
+        m_sound_bank.play( Audio::Effect::kPickaxeFinal );
 
         // replace the obstacle with a detonated component
         Factory::remove_obstacle( reg(), obst_entity );
@@ -245,7 +248,7 @@ void DiggingSystem::check_player_dig_obstacle_collision()
       {
         // select all pickaxe sounds except the final smash sound
         Cmp::RandomInt random_picker( 1, 6 );
-        m_sound_bank.get_effect( "pickaxe" + std::to_string( random_picker.gen() ) ).play();
+        m_sound_bank.play( Audio::Effect::kPickaxe[random_picker.gen() - 1] );
       }
     }
   }
@@ -326,7 +329,7 @@ void DiggingSystem::check_player_dig_plant_collision()
       if ( alpha_cmp.getAlpha() == 0 )
       {
         // select the final smash sound
-        m_sound_bank.get_effect( "chopping_final" ).play();
+        m_sound_bank.play( Audio::Effect::kChoppingFinal );
         auto inventory_wear_view = reg().view<Cmp::PlayerInventorySlot>();
         for ( auto [inventory_entt, inventory_slot] : inventory_wear_view.each() )
         {
@@ -348,7 +351,7 @@ void DiggingSystem::check_player_dig_plant_collision()
       else
       {
         // play digging sound and animation
-        m_sound_bank.get_effect( "digging_earth" ).play();
+        m_sound_bank.play( Audio::Effect::kDiggingEarth );
       }
     }
   }
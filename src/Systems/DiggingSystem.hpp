@@ -9,7 +9,7 @@
 #include <SFML/Audio/AudioResource.hpp>
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
-#include <SFML/System/Clock.hpp>
+#include <Utils/GameClock.hpp>
 #include <filesystem>
 
 namespace ProceduralMaze::PathFinding
@@ -63,7 +63,7 @@ private:
   sf::Time m_plantcheck_accumulator;
 
   // Cooldown clock to manage digging intervals
-  sf::Clock m_dig_cooldown_clock;
+  Utils::GameClock m_dig_cooldown_clock;
 
   //! @brief Structure to hold pickaxe sound information
   //! Used to manage multiple pickaxe sound effects
@@ -1,6 +1,7 @@
 #include <Player/PlayerNoPath.hpp>
 #define SPDLOG_ACTIVE_LEVEL SPDLOG_LEVEL_INFO
 
+#include <Audio/Effects.hpp>
 #include <Audio/SoundBank.hpp>
 #include <Components/Exit.hpp>
 #include <Components/Inventory/InventoryItem.hpp>
@@ -108,7 +109,7 @@ void ExitSystem::check_player_can_unlock_exit()
         reg().emplace_or_replace<Cmp::SpriteAnimation>( entity, 0, 0, true, "WALL", 1 );
         reg().emplace_or_replace<Cmp::ZOrderValue>( entity, pos_cmp.position.y - 16.f );
         reg().remove<Cmp::PlayerNoPath>( entity );
-        if ( m_sound_bank.get_effect( "secret" ).getStatus() == sf::Sound::Status::Stopped ) m_sound_bank.get_effect( "secret" ).play();
+        m_sound_bank.play_once( Audio::Effect::kSecret );
         Factory::destroy_inventory( reg(), "sprite.item.exitkey" );
       }
     }
@@ -12,8 +12,10 @@
 #include <Components/Player/PlayerCharacter.hpp>
 #include <Components/SpriteAnimation.hpp>
 #include <Components/ZOrderValue.hpp>
+#include <Debug/Profiler.hpp>
 #include <SFML/System/Time.hpp>
 #include <Sprites/MultiSprite.hpp>
+#include <Sprites/SpriteTypes.hpp>
 #include <Systems/PersistSystem.hpp>
 #include <Systems/PersistSystemImpl.hpp>
 #include <Utils/Constants.hpp>
@@ -67,50 +69,50 @@ void FootstepSystem::add_footstep( const Cmp::Position &pos_cmp, const Cmp::Dire
     // We use absolute rotation component to rotate diagonal footsteps from the "right" sprite
     if ( direction == sf::Vector2f( 1.f, 0.f ) )
     { // moving right
-      reg().emplace<Cmp::SpriteAnimation>( entity, 0, 0, true, "sprite.player.footsteps", 0 );
+      reg().emplace<Cmp::SpriteAnimation>( entity, 0, 0, true, Sprites::Type::kPlayerFootsteps, 0 );
       reg().emplace<Cmp::Position>( entity, sf::Vector2f{ pos_cmp.position.x, pos_cmp.position.y }, pos_cmp.size );
       // getReg().emplace<Cmp::AbsoluteOffset>( entity, 0.f, -3.f );
     }
     else if ( direction == sf::Vector2f( -1.f, 0.f ) )
     { // moving left
-      reg().emplace<Cmp::SpriteAnimation>( entity, 0, 0, true, "sprite.player.footsteps", 1 );
+      reg().emplace<Cmp::SpriteAnimation>( entity, 0, 0, true, Sprites::Type::kPlayerFootsteps, 1 );
       reg().emplace<Cmp::Position>( entity, sf::Vector2f{ pos_cmp.position.x, pos_cmp.position.y }, pos_cmp.size );
       // getReg().emplace<Cmp::AbsoluteOffset>( entity, 0.f, -3.f );
     }
     else if ( direction == sf::Vector2f( 0.f, 1.f ) )
     { // moving down
-      reg().emplace<Cmp::SpriteAnimation>( entity, 0, 0, true, "sprite.player.footsteps", 2 );
+      reg().emplace<Cmp::SpriteAnimation>( entity, 0, 0, true, Sprites::Type::kPlayerFootsteps, 2 );
       reg().emplace<Cmp::Position>( entity, sf::Vector2f{ pos_cmp.position.x, pos_cmp.position.y }, pos_cmp.size );
     }
     else if ( direction == sf::Vector2f( 0.f, -1.f ) )
     { // moving up
-      reg().emplace<Cmp::SpriteAnimation>( entity, 0, 0, true, "sprite.player.footsteps", 3 );
+      reg().emplace<Cmp::SpriteAnimation>( entity, 0, 0, true, Sprites::Type::kPlayerFootsteps, 3 );
       reg().emplace<Cmp::Position>( entity, sf::Vector2f{ pos_cmp.position.x, pos_cmp.position.y }, pos_cmp.size );
     }
     else if ( direction == sf::Vector2f( 1.f, 1.f ) )
     { // moving down/right
-      reg().emplace<Cmp::SpriteAnimation>( entity, 0, 0, true, "sprite.player.footsteps", 0 );
+      reg().emplace<Cmp::SpriteAnimation>( entity, 0, 0, true, Sprites::Type::kPlayerFootsteps, 0 );
       reg().emplace<Cmp::Position>( entity, sf::Vector2f{ pos_cmp.position.x, pos_cmp.position.y }, pos_cmp.size );
       reg().emplace<Cmp::AbsoluteRotation>( entity, 45.f );
       reg().emplace<Cmp::AbsoluteOffset>( entity, Constants::kGridSizePx.x / 2.f, Constants::kGridSizePx.y / 2.f );
     }
     else if ( direction == sf::Vector2f( -1.f, 1.f ) )
     { // moving down/left
-      reg().emplace<Cmp::SpriteAnimation>( entity, 0, 0, true, "sprite.player.footsteps", 2 );
+      reg().emplace<Cmp::SpriteAnimation>( entity, 0, 0, true, Sprites::Type::kPlayerFootsteps, 2 );
       reg().emplace<Cmp::Position>( entity, sf::Vector2f{ pos_cmp.position.x, pos_cmp.position.y }, pos_cmp.size );
       reg().emplace<Cmp::AbsoluteRotation>( entity, 45.f );
       reg().emplace<Cmp::AbsoluteOffset>( entity, Constants::kGridSizePx.x / 2.f, Constants::kGridSizePx.y / 2.f );
     }
     else if ( direction == sf::Vector2f( -1.f, -1.f ) )
     { // moving up/left
-      reg().emplace<Cmp::SpriteAnimation>( entity, 0, 0, true, "sprite.player.footsteps", 1 );
+      reg().emplace<Cmp::SpriteAnimation>( entity, 0, 0, true, Sprites::Type::kPlayerFootsteps, 1 );
       reg().emplace<Cmp::Position>( entity, sf::Vector2f{ pos_cmp.position.x, pos_cmp.position.y }, pos_cmp.size );
       reg().emplace<Cmp::AbsoluteRotation>( entity, 45.f );
       reg().emplace<Cmp::AbsoluteOffset>( entity, Constants::kGridSizePx.x / 2.f, Constants::kGridSizePx.y / 2.f );
     }
     else if ( direction == sf::Vector2f( 1.f, -1.f ) )
     { // moving up/right
-      reg().emplace<Cmp::SpriteAnimation>( entity, 0, 0, true, "sprite.player.footsteps", 3 );
+      reg().emplace<Cmp::SpriteAnimation>( entity, 0, 0, true, Sprites::Type::kPlayerFootsteps, 3 );
       reg().emplace<Cmp::Position>( entity, sf::Vector2f{ pos_cmp.position.x, pos_cmp.position.y }, pos_cmp.size );
       reg().emplace<Cmp::AbsoluteRotation>( entity, 45.f );
       reg().emplace<Cmp::AbsoluteOffset>( entity, Constants::kGridSizePx.x / 2.f, Constants::kGridSizePx.y / 2.f );
@@ -123,6 +125,7 @@ void FootstepSystem::add_footstep( const Cmp::Position &pos_cmp, const Cmp::Dire
 
 void FootstepSystem::update()
 {
+  PROFILE_ZONE( "FootstepSystem::update" );
 
   // add new footstep for player
   auto player_view = reg().view<Cmp::PlayerCharacter, Cmp::Position, Cmp::Direction>();
@@ -2,7 +2,7 @@
 #define SRC_SYSTEMS_FOOTSTEPSYSTEM_HPP__
 
 #include <Components/FootStepTimer.hpp>
-#include <SFML/System/Clock.hpp>
+#include <Utils/GameClock.hpp>
 #include <SFML/System/Vector2.hpp>
 
 #include <Components/Direction.hpp>
@@ -36,7 +36,7 @@ public:
 
 private:
   const unsigned int kFootstepFadeFactor{ 1 };
-  sf::Clock update_clock{};
+  Utils::GameClock update_clock{};
 };
 
 } // namespace ProceduralMaze::Sys
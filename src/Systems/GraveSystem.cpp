@@ -3,6 +3,7 @@
 #include <Systems/Stores/ItemStore.hpp>
 #include <typeindex>
 #define SPDLOG_ACTIVE_LEVEL SPDLOG_LEVEL_INFO
+#include <Audio/Effects.hpp>
 #include <Audio/SoundBank.hpp>
 #include <Components/AbsoluteAlpha.hpp>
 #include <Components/Grave/GraveMultiBlock.hpp>
@@ -104,18 +105,19 @@ void GraveSystem::check_player_grave_collision()
       if ( grave_cmp.hp > 0 )
       {
         // play bashing animation
-        m_sound_bank.get_effect( "hit_grave" ).play();
+        m_sound_bank.play( Audio::Effect::kHitGrave );
       }
       else
       {
 
-        if ( std::string::size_type n = grave_anim_cmp.m_sprite_type.find( ".closed" ); n != std::string::npos )
+        const std::string &grave_type = grave_anim_cmp.m_sprite_type.name();
+        if ( std::string::size_type n = grave_type.find( ".closed" ); n != std::string::npos )
         {
-          grave_anim_cmp.m_sprite_type = grave_anim_cmp.m_sprite_type.substr( 0, n ) + ".opened";
+          grave_anim_cmp.m_sprite_type = grave_type.substr( 0, n ) + ".opened";
           SPDLOG_DEBUG( "Grave Cmp::SpriteAnimation changed to opened type: {}", grave_anim_cmp.m_sprite_type );
 
           // select the final smash sound
-          m_sound_bank.get_effect( "pickaxe_final" ).play();
+          m_sound_bank.play( Audio::Effect::kPickaxeFinal );
         }
 
         auto grave_activation_rng = Cmp::RandomInt( 1, 4 );
@@ -125,7 +127,7 @@ void GraveSystem::check_player_grave_collision()
           case 1: {
             SPDLOG_DEBUG( "Grave activated NPC trap." );
             Factory::create_npc( reg(), grave_entity, "npc.ghost" );
-            m_sound_bank.get_effect( "spawn_ghost" ).play();
+            m_sound_bank.play( Audio::Effect::kSpawnGhost );
             break;
           }
           case 2: {
@@ -145,7 +147,7 @@ void GraveSystem::check_player_grave_collision()
             auto item = Sys::ItemStore::instance().get_item( relic_selection_list.at( selected_relic ) );
             Utils::Player::get_player_stats( reg() ).apply_modifiers( item.actions.at( std::type_index( typeid( Cmp::ExhumeAction ) ) ).action );
 
-            if ( relic_entt != entt::null ) { m_sound_bank.get_effect( "drop_loot" ).play(); }
+            if ( relic_entt != entt::null ) { m_sound_bank.play( Audio::Effect::kDropLoot ); }
             break;
           }
           case 4: {
@@ -163,7 +165,7 @@ void GraveSystem::check_player_grave_collision()
             auto item = Sys::ItemStore::instance().get_item( jewelry_selection_list.at( selected_jewelry ) );
             Utils::Player::get_player_stats( reg() ).apply_modifiers( item.actions.at( std::type_index( typeid( Cmp::ExhumeAction ) ) ).action );
 
-            if ( jewelry_entt != entt::null ) { m_sound_bank.get_effect( "drop_loot" ).play(); }
+            if ( jewelry_entt != entt::null ) { m_sound_bank.play( Audio::Effect::kDropLoot ); }
             break;
           }
         }
@@ -4,6 +4,7 @@
 #include <Components/Grave/GraveMultiBlock.hpp>
 #include <Events/PlayerActionEvent.hpp>
 #include <Systems/BaseSystem.hpp>
+#include <Utils/GameClock.hpp>
 
 namespace ProceduralMaze::Cmp
 {
@@ -27,7 +28,7 @@ public:
   void check_player_grave_collision();
 
   // Cooldown clock to manage digging intervals
-  sf::Clock m_dig_cooldown_clock;
+  Utils::GameClock m_dig_cooldown_clock;
 };
 
 } // namespace ProceduralMaze::Sys
@@ -1,5 +1,6 @@
 #define SPDLOG_ACTIVE_LEVEL SPDLOG_LEVEL_INFO
 
+#include <Audio/Effects.hpp>
 #include <Audio/SoundBank.hpp>
 #include <Components/Exit.hpp>
 #include <Components/HolyWell/HolyWellEntrance.hpp>
@@ -106,7 +107,7 @@ void HolyWellSystem::check_inventory_deposit()
     if ( not player_hitbox.findIntersection( well_mb_cmp ) ) continue;
     Factory::destroy_inventory( reg(), inventory_type );
     wealth.wealth += 2;
-    m_sound_bank.get_effect( "get_key" ).play();
+    m_sound_bank.play( Audio::Effect::kGetKey );
 
     // signal UI to flash
     auto flash_entt = reg().create();
@@ -1,4 +1,5 @@
 
+#include <Debug/Profiler.hpp>
 #include <Optimizations.hpp>
 #include <Systems/BaseSystem.hpp>
 #include <Systems/ParticleSystem.hpp>
@@ -29,6 +30,7 @@ std::vector<entt::entity> ParticleSystem::add_to_registry( ParticleSpriteOwner o
 
 void ParticleSystem::update( sf::Time dt )
 {
+  PROFILE_ZONE( "ParticleSystem::update" );
   for ( auto [entt, owner] : reg().view<ParticleSpriteOwner>().each() )
   {
     if ( not owner.sprite->is_active() ) continue;
@@ -12,21 +12,21 @@
 namespace ProceduralMaze::Sys
 {
 
-// 1. Emission Stage:   - IParticle::emit()
+// 1. Emission Stage:   - ParticleSpriteBase::emit()
 // 2. Simulation Stage  - IParticleSprite::simulate()
 // 3. Rendering Stage   - via RenderGameSystem using Cmp::ZorderValue
 
-// IParticle                            contract: emit(), vertex, velocity, lifetime
 // IParticleSprite                      contract: simulate(), set_emitter(), draw()
-//   └── ParticleSpriteBase<IParticle>  template: owns vector<T>, implements draw()
+//   └── ParticleSpriteBase             owns the ParticlePool (position, velocity, lifetime, colour... lanes), implements draw()
+//         └── Flame, Smoke, ...        implement emit() and simulate() as passes over the lanes
 
 // ParticleSpriteOwner                  entt component: tag + unique_ptr<IParticleSprite>
 
 // ParticleSystem                       add(), update(), find() — knows nothing about concrete types
 // RenderGameSystem                     iterates ParticleSpriteOwner, calls draw() — knows nothing about concrete types
 
-//! @brief  This wraps ParticleSpriteBase<IParticle> so it can be emplaced/retrieved with the Entt registry as a single type.
-//!         ParticleSystem::find can retrieve ParticleSpriteBase<IParticle> via the specified `tag`
+//! @brief  This wraps IParticleSprite so it can be emplaced/retrieved with the Entt registry as a single type.
+//!         ParticleSystem::find can retrieve IParticleSprite via the specified `tag`
 struct ParticleSpriteOwner
 {
   std::unique_ptr<Cmp::Particle::IParticleSprite> sprite;
@@ -55,13 +55,13 @@ public:
     ( add_one( sprites ), ... );
   }
 
-  //! @brief Calls IParticle::update() function within all added ParticleSpriteBase<T>
+  //! @brief Calls IParticleSprite::simulate() function within all added IParticleSprite
   //! @param dt
   void update( sf::Time dt );
 
   void check_collsion( const sf::FloatRect &target );
 
-  //! @brief Find a ParticleSpriteOwner by tag and return a pointer to ParticleSpriteBase<IParticle>, or nullptr if not found
+  //! @brief Find a ParticleSpriteOwner by tag and return a pointer to IParticleSprite, or nullptr if not found
   [[nodiscard]] static Cmp::Particle::IParticleSprite *find( entt::registry &reg, const std::string &tag );
 
   //! @brief event handlers for pausing system clocks
@@ -1,10 +1,12 @@
 #include <Constants.hpp>
+#include <Debug/Profiler.hpp>
 #include <Events/DropInventoryEvent.hpp>
 #include <Factory/NpcFactory.hpp>
 #include <Factory/PlantFactory.hpp>
 #include <Inventory/Explosive.hpp>
 #include <Inventory/InventoryWearLevel.hpp>
 #include <Inventory/ScryingBall.hpp>
+#include <Sprites/SpriteTypes.hpp>
 #include <Stats/BaseAction.hpp>
 #include <Stats/CarryAction.hpp>
 #include <Stats/CollisionAction.hpp>
@@ -13,6 +15,7 @@
 #include <Stats/ProjectileAction.hpp>
 #define SPDLOG_ACTIVE_LEVEL SPDLOG_LEVEL_INFO
 
+#include <Audio/Effects.hpp>
 #include <Audio/SoundBank.hpp>
 #include <Components/AbsoluteAlpha.hpp>
 #include <Components/AbsoluteRotation.hpp>
@@ -79,6 +82,7 @@ PlayerSystem::PlayerSystem( entt::registry &reg, sf::RenderWindow &window, Sprit
 
 void PlayerSystem::update( sf::Time dt, FootStepSfx footstep_sfx )
 {
+  PROFILE_ZONE( "PlayerSystem::update" );
 
   // cache the player position so we can update the spatial grid afterwards.
   auto old_player_pos = Utils::Player::get_position( reg() );
@@ -233,18 +237,18 @@ void PlayerSystem::update_player_animation()
   else
   {
     anim_cmp.m_animation_active = true;
-    if ( direction_cmp.x == 1 ) { anim_cmp.m_sprite_type = "sprite.player.walk.east"; }
-    else if ( direction_cmp.x == -1 ) { anim_cmp.m_sprite_type = "sprite.player.walk.west"; }
-    else if ( direction_cmp.y == -1 ) { anim_cmp.m_sprite_type = "sprite.player.walk.north"; }
-    else if ( direction_cmp.y == 1 ) { anim_cmp.m_sprite_type = "sprite.player.walk.south"; }
+    if ( direction_cmp.x == 1 ) { anim_cmp.m_sprite_type = Sprites::Type::kPlayerWalkEast; }
+    else if ( direction_cmp.x == -1 ) { anim_cmp.m_sprite_type = Sprites::Type::kPlayerWalkWest; }
+    else if ( direction_cmp.y == -1 ) { anim_cmp.m_sprite_type = Sprites::Type::kPlayerWalkNorth; }
+    else if ( direction_cmp.y == 1 ) { anim_cmp.m_sprite_type = Sprites::Type::kPlayerWalkSouth; }
   }
 }
 
 void PlayerSystem::update_player_zorder()
 {
-  Cmp::ZOrderValue &zorder_cmp = Utils::Player::get_zorder( reg() );
   const Cmp::Position player_pos = Utils::Player::get_position( reg() );
-  zorder_cmp.setZOrder( player_pos.position.y );
+  reg().patch<Cmp::ZOrderValue>( Utils::Player::get_entity( reg() ),
+                                 [&]( auto &zorder_cmp ) { zorder_cmp.setZOrder( player_pos.position.y ); } );
 }
 
 void PlayerSystem::on_player_mortality_event( ProceduralMaze::Events::PlayerMortalityEvent ev )
@@ -269,28 +273,28 @@ void PlayerSystem::on_player_mortality_event( ProceduralMaze::Events::PlayerMort
       SPDLOG_INFO( "Player is falling" );
       const auto &sprite = m_sprite_factory.get_multisprite_by_type( "sprite.death.anim.bloodsplat" );
       Factory::create_player_death_anim( reg(), ev.m_death_pos, sprite );
-      m_sound_bank.get_effect( "player_blood_splat" ).play();
+      m_sound_bank.play( Audio::Effect::kPlayerBloodSplat, Audio::SoundBank::Priority::HIGH );
       common_death_throes();
       break;
     }
     case Cmp::PlayerMortality::State::DECAYING: {
       const auto &sprite = m_sprite_factory.get_multisprite_by_type( "sprite.death.anim.bloodsplat" );
       Factory::create_player_death_anim( reg(), ev.m_death_pos, sprite );
-      m_sound_bank.get_effect( "player_blood_splat" ).play();
+      m_sound_bank.play( Audio::Effect::kPlayerBloodSplat, Audio::SoundBank::Priority::HIGH );
       common_death_throes();
       break;
     }
     case Cmp::PlayerMortality::State::HAUNTED: {
       const auto &sprite = m_sprite_factory.get_multisprite_by_type( "sprite.death.anim.bloodsplat" );
       Factory::create_player_death_anim( reg(), ev.m_death_pos, sprite );
-      m_sound_bank.get_effect( "player_blood_splat" ).play();
+      m_sound_bank.play( Audio::Effect::kPlayerBloodSplat, Audio::SoundBank::Priority::HIGH );
       common_death_throes();
       break;
     }
     case Cmp::PlayerMortality::State::EXPLODING: {
       const auto &sprite = m_sprite_factory.get_multisprite_by_type( "sprite.death.anim.bloodsplat" );
       Factory::create_player_death_anim( reg(), ev.m_death_pos, sprite );
-      m_sound_bank.get_effect( "player_blood_splat" ).play();
+      m_sound_bank.play( Audio::Effect::kPlayerBloodSplat, Audio::SoundBank::Priority::HIGH );
       common_death_throes();
       break;
     }
@@ -300,35 +304,35 @@ void PlayerSystem::on_player_mortality_event( ProceduralMaze::Events::PlayerMort
     case Cmp::PlayerMortality::State::SQUISHED: {
       const auto &sprite = m_sprite_factory.get_multisprite_by_type( "sprite.death.anim.bloodsplat" );
       Factory::create_player_death_anim( reg(), ev.m_death_pos, sprite );
-      m_sound_bank.get_effect( "player_blood_splat" ).play();
+      m_sound_bank.play( Audio::Effect::kPlayerBloodSplat, Audio::SoundBank::Priority::HIGH );
       common_death_throes();
       break;
     }
     case Cmp::PlayerMortality::State::SUICIDE: {
       const auto &sprite = m_sprite_factory.get_multisprite_by_type( "sprite.death.anim.bloodsplat" );
       Factory::create_player_death_anim( reg(), ev.m_death_pos, sprite );
-      m_sound_bank.get_effect( "player_blood_splat" ).play();
+      m_sound_bank.play( Audio::Effect::kPlayerBloodSplat, Audio::SoundBank::Priority::HIGH );
       common_death_throes();
       break;
     }
     case Cmp::PlayerMortality::State::IGNITED: {
       const auto &sprite = m_sprite_factory.get_multisprite_by_type( "sprite.death.anim.flames" );
       Factory::create_player_death_anim( reg(), ev.m_death_pos, sprite );
-      m_sound_bank.get_effect( "shrine_lighting" ).play();
+      m_sound_bank.play( Audio::Effect::kShrineLighting );
       common_death_throes();
       break;
     }
     case Cmp::PlayerMortality::State::SKEWERED: {
       const auto &sprite = m_sprite_factory.get_multisprite_by_type( "sprite.death.anim.bloodsplat" );
       Factory::create_player_death_anim( reg(), ev.m_death_pos, sprite );
-      m_sound_bank.get_effect( "player_blood_splat" ).play();
+      m_sound_bank.play( Audio::Effect::kPlayerBloodSplat, Audio::SoundBank::Priority::HIGH );
       common_death_throes();
       break;
     }
     case Cmp::PlayerMortality::State::SHOCKED: {
       const auto &sprite = m_sprite_factory.get_multisprite_by_type( "sprite.death.anim.bloodsplat" );
       Factory::create_player_death_anim( reg(), ev.m_death_pos, sprite );
-      m_sound_bank.get_effect( "player_blood_splat" ).play();
+      m_sound_bank.play( Audio::Effect::kPlayerBloodSplat, Audio::SoundBank::Priority::HIGH );
       common_death_throes();
       break;
     }
@@ -338,7 +342,7 @@ void PlayerSystem::on_player_mortality_event( ProceduralMaze::Events::PlayerMort
     case Cmp::PlayerMortality::State::SHADOWCURSED:
       const auto &sprite = m_sprite_factory.get_multisprite_by_type( "sprite.death.anim.bloodsplat" );
       Factory::create_player_death_anim( reg(), ev.m_death_pos, sprite );
-      m_sound_bank.get_effect( "player_blood_splat" ).play();
+      m_sound_bank.play( Audio::Effect::kPlayerBloodSplat, Audio::SoundBank::Priority::HIGH );
       common_death_throes();
       break;
   }
@@ -362,8 +366,8 @@ void PlayerSystem::on_player_action_event( ProceduralMaze::Events::PlayerActionE
       auto dropped_entt = drop_inventory_slot_into_world( player_pos.position, inventory_entt );
       if ( dropped_entt != entt::null )
       {
-        if ( existing_player_inventory_type.contains( "plant" ) ) { m_sound_bank.get_effect( "digging_earth" ).play(); }
-        else { m_sound_bank.get_effect( "drop_relic" ).play(); }
+        if ( existing_player_inventory_type.contains( "plant" ) ) { m_sound_bank.play( Audio::Effect::kDiggingEarth ); }
+        else { m_sound_bank.play( Audio::Effect::kDropRelic ); }
       }
     }
 
@@ -376,7 +380,7 @@ void PlayerSystem::on_player_action_event( ProceduralMaze::Events::PlayerActionE
       if ( inventory_view.size() > 0 ) { break; }                                  // don't pickup another if we already have one
 
       // ok pick it up
-      if ( Factory::pickup_world_item( reg(), carryitem_entt ) != entt::null ) { m_sound_bank.get_effect( "get_loot" ).play(); }
+      if ( Factory::pickup_world_item( reg(), carryitem_entt ) != entt::null ) { m_sound_bank.play( Audio::Effect::kGetLoot ); }
     }
     m_inventory_cooldown_timer.restart();
     SPDLOG_DEBUG( "inventory_view: {} ", inventory_view.size() );
@@ -493,7 +497,7 @@ entt::entity PlayerSystem::drop_inventory_slot_into_world( sf::Vector2f pos, ent
 void PlayerSystem::on_drop_inventory_event( ProceduralMaze::Events::DropInventoryEvent ev )
 {
   auto dropped_entt = drop_inventory_slot_into_world( ev.drop_pos, ev.inventory_slot_entt );
-  if ( dropped_entt != entt::null ) { m_sound_bank.get_effect( "drop_relic" ).play(); }
+  if ( dropped_entt != entt::null ) { m_sound_bank.play( Audio::Effect::kDropRelic ); }
 }
 
 void PlayerSystem::playFootstepsSound( FootStepSfx type )
@@ -504,16 +508,12 @@ void PlayerSystem::playFootstepsSound( FootStepSfx type )
       break;
     case FootStepSfx::GRAVEL: {
       // Restarting prematurely creates a stutter effect, so check first
-      auto &footsteps = m_sound_bank.get_effect( "footsteps" );
-      if ( footsteps.getStatus() == sf::Sound::Status::Playing ) return;
-      footsteps.play();
+      m_sound_bank.play_once( Audio::Effect::kFootsteps, Audio::SoundBank::Priority::LOW );
       break;
     }
     case FootStepSfx::FLOORBOARDS: {
       // // Restarting prematurely creates a stutter effect, so check first
-      // auto &footsteps = m_sound_bank.get_effect( "footsteps" );
-      // if ( footsteps.getStatus() == sf::Sound::Status::Playing ) return;
-      // footsteps.play();
+      // m_sound_bank.play_once( Audio::Effect::kFootsteps, Audio::SoundBank::Priority::LOW );
       break;
     }
   }
@@ -522,7 +522,7 @@ void PlayerSystem::playFootstepsSound( FootStepSfx type )
 void PlayerSystem::stopFootstepsSound()
 {
   // add more footstep sfx here when needed
-  m_sound_bank.get_effect( "footsteps" ).stop();
+  m_sound_bank.stop( Audio::Effect::kFootsteps );
 }
 
 void PlayerSystem::disable_damage_cooldown()
@@ -563,7 +563,7 @@ void PlayerSystem::check_player_axe_npc_kill()
   SPDLOG_DEBUG( "position_view size: {}", position_view.size_hint() );
   for ( auto [npc_entity, npc_pos_cmp, npc_cmp, anim_cmp] : position_view.each() )
   {
-    if ( anim_cmp.m_sprite_type.contains( "sprite.ghost" ) ) continue;
+    if ( anim_cmp.m_sprite_type.is_a( Sprites::Type::kGhost ) ) continue;
     auto mouse_position_bounds = Utils::get_mouse_bounds_in_gameview( m_window, RenderSystem::get_world_view() );
     if ( mouse_position_bounds.findIntersection( npc_pos_cmp ) )
     {
@@ -593,15 +593,15 @@ void PlayerSystem::check_player_axe_npc_kill()
       Utils::Player::reduce_inventory_wear_level( reg(), reduction_amount );
 
       // select the final smash sound
-      m_sound_bank.get_effect( "axe_whip" ).play();
-      m_sound_bank.get_effect( "skele_death" ).play();
+      m_sound_bank.play( Audio::Effect::kAxeWhip );
+      m_sound_bank.play( Audio::Effect::kSkeleDeath );
 
       auto [inventory_entt, inventory_slot_type] = Utils::Player::get_inventory_type( reg() );
       if ( inventory_slot_type == "sprite.item.axe" )
       {
         // drop loot - 1 in 3 chance
         auto [sprite_type, sprite_index] = m_sprite_factory.get_random_type_and_texture_index(
-            std::vector<std::string>{ "sprite.graveyard.loot.health", "sprite.graveyard.loot.blast", "sprite.graveyard.loot.repair" } );
+            std::vector<Sprites::SpriteMetaType>{ "sprite.graveyard.loot.health", "sprite.graveyard.loot.blast", "sprite.graveyard.loot.repair" } );
 
         Cmp::RandomInt do_drop( 0, 2 );
         if ( do_drop.gen() == 0 )
@@ -616,7 +616,7 @@ void PlayerSystem::check_player_axe_npc_kill()
           {
             auto player_pos = Utils::Player::get_position( reg() );
             SPDLOG_INFO( "Player position was at {},{} when loot was dropped", player_pos.position.x, player_pos.position.y );
-            m_sound_bank.get_effect( "drop_loot" ).play();
+            m_sound_bank.play( Audio::Effect::kDropLoot );
           }
         }
 
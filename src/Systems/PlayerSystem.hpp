@@ -6,6 +6,7 @@
 #include <Events/PlayerMortalityEvent.hpp>
 #include <Sprites/MultiSprite.hpp>
 #include <Systems/BaseSystem.hpp>
+#include <Utils/GameClock.hpp>
 
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
@@ -109,9 +110,9 @@ private:
 
   sf::Clock m_debug_info_timer;
 
-  sf::Clock m_post_death_timer;
+  Utils::GameClock m_post_death_timer;
 
-  sf::Clock m_inventory_cooldown_timer;
+  Utils::GameClock m_inventory_cooldown_timer;
 
   PathFinding::SpatialHashGridWeakPtr m_pathfinding_navmesh;
 };
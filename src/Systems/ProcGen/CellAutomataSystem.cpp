@@ -1,69 +1,155 @@
-
 #include <Components/Npc/NpcNoPathFinding.hpp>
 #include <Components/Obstacle.hpp>
+#include <Components/PlantObstacle.hpp>
+#include <Components/Random.hpp>
 #include <Components/ReservedPosition.hpp>
 #include <Components/Wall.hpp>
 #include <Components/ZOrderValue.hpp>
+#include <Constants.hpp>
 #include <Factory/ObstacleFactory.hpp>
 #include <Systems/ProcGen/CellAutomataSystem.hpp>
 #include <spdlog/spdlog.h>
 
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
 namespace ProceduralMaze::Sys::ProcGen
 {
 
-void CellAutomataSystem::iterate( unsigned int iterations, RandomLevelGenerator::SceneType scene_type,
-                                  PathFinding::SpatialHashGrid &levelgen_spatialgrid )
+namespace
+{
+
+//! @brief One bit per map cell, packed into 64-bit rows with a one cell border on every side, so the 3x3 block around any
+//! map cell can be read without bounds checks.
+class BitGrid
+{
+public:
+  BitGrid( int width, int height )
+      : m_words_per_row( ( static_cast<std::size_t>( width ) + 2 + 63 ) / 64 ),
+        m_words( m_words_per_row * ( static_cast<std::size_t>( height ) + 2 ), 0 )
+  {
+  }
+
+  bool test( int x, int y ) const { return ( row( y )[word( x )] >> shift( x ) ) & 1u; }
+
+  void assign( int x, int y, bool value )
+  {
+    auto &bits = m_words[static_cast<std::size_t>( y + 1 ) * m_words_per_row + word( x )];
+    const uint64_t mask = uint64_t{ 1 } << shift( x );
+    bits = value ? ( bits | mask ) : ( bits & ~mask );
+  }
+
+  //! @brief Number of set cells in the 3x3 block centred on x/y, including x/y itself
+  int block_count( int x, int y ) const
+  {
+    return std::popcount( window( row( y - 1 ), x ) ) + std::popcount( window( row( y ), x ) ) + std::popcount( window( row( y + 1 ), x ) );
+  }
+
+private:
+  std::size_t m_words_per_row;
+  std::vector<uint64_t> m_words;
+
+  // map cell x is stored at bit x + 1 of its row, map row y at row y + 1
+  static std::size_t word( int x ) { return static_cast<std::size_t>( x + 1 ) / 64; }
+  static unsigned shift( int x ) { return static_cast<unsigned>( x + 1 ) % 64; }
+  const uint64_t *row( int y ) const { return m_words.data() + static_cast<std::size_t>( y + 1 ) * m_words_per_row; }
+
+  //! @brief Cells x-1, x and x+1 of `row` in the low three bits
+  static uint64_t window( const uint64_t *row, int x )
+  {
+    // x-1 is stored at bit x
+    const auto first = static_cast<std::size_t>( x );
+    const auto offset = static_cast<unsigned>( first % 64 );
+    uint64_t bits = row[first / 64] >> offset;
+    if ( offset > 61 ) bits |= row[first / 64 + 1] << ( 64 - offset );
+    return bits & 0b111u;
+  }
+};
+
+} // namespace
+
+void CellAutomataSystem::smooth( RandomLevelGenerator::SceneType scene_type, const PathFinding::SpatialHashGrid &levelgen_spatialgrid )
 {
-  const Sprites::MultiSprite &ms = m_sprite_factory.get_multisprite_by_type( "sprite.graveyard.wall.int" );
+  [[maybe_unused]] sf::Clock timer;
 
-  sf::Clock iteration_timer;
-  for ( unsigned int i = 0; i < iterations; i++ )
+  // gather the automaton cells: one per grid cell holding a (non-reserved) Position
+  struct CellEntity
+  {
+    entt::entity entt;
+    int x;
+    int y;
+  };
+  std::vector<CellEntity> cell_entities;
+  int width = 0;
+  int height = 0;
+  for ( auto [pos_entt, pos_cmp] : reg().view<Cmp::Position>( entt::exclude<Cmp::ReservedPosition> ).each() )
   {
+    auto [x, y] = PathFinding::SpatialHashGrid::cell( pos_cmp );
+    if ( x < 0 || y < 0 ) continue;
+    cell_entities.push_back( { pos_entt, x, y } );
+    width = std::max( width, x + 1 );
+    height = std::max( height, y + 1 );
+  }
+  if ( cell_entities.empty() ) return;
 
-    SPDLOG_DEBUG( "NAVMESH: {}", levelgen_spatialgrid.size() );
-    for ( auto [pos_entt, pos_cmp] : reg().view<Cmp::Position>( entt::exclude<Cmp::ReservedPosition> ).each() )
+  // cells under a plant can never hold an obstacle, see Factory::create_obstacle()
+  BitGrid blocked( width, height );
+  for ( auto [plant_entt, plant_cmp, plant_pos_cmp] : reg().view<Cmp::PlantObstacle, Cmp::Position>().each() )
+  {
+    const auto left = static_cast<int>( std::floor( plant_pos_cmp.position.x / Constants::kGridSizePxF.x ) );
+    const auto top = static_cast<int>( std::floor( plant_pos_cmp.position.y / Constants::kGridSizePxF.y ) );
+    const auto right = static_cast<int>( std::ceil( ( plant_pos_cmp.position.x + plant_pos_cmp.size.x ) / Constants::kGridSizePxF.x ) );
+    const auto bottom = static_cast<int>( std::ceil( ( plant_pos_cmp.position.y + plant_pos_cmp.size.y ) / Constants::kGridSizePxF.y ) );
+    for ( int y = std::max( top, 0 ); y < std::min( bottom, height ); ++y )
+    {
+      for ( int x = std::max( left, 0 ); x < std::min( right, width ); ++x )
+        blocked.assign( x, y, true );
+    }
+  }
+
+  // seed from the level generator's obstacles, visiting each cell once
+  BitGrid is_cell( width, height );
+  BitGrid seed( width, height );
+  for ( const auto &cell_entity : cell_entities )
+  {
+    if ( is_cell.test( cell_entity.x, cell_entity.y ) ) continue;
+    is_cell.assign( cell_entity.x, cell_entity.y, true );
+
+    if ( blocked.test( cell_entity.x, cell_entity.y ) ) continue;
+    const sf::Vector2f pos( cell_entity.x * Constants::kGridSizePxF.x, cell_entity.y * Constants::kGridSizePxF.y );
+    bool occupied = false;
+    levelgen_spatialgrid.for_each_at( Cmp::Position( pos, Constants::kGridSizePxF ),
+                                      [&occupied]( entt::entity )
+                                      {
+                                        occupied = true;
+                                        return false;
+                                      } );
+    seed.assign( cell_entity.x, cell_entity.y, occupied );
+  }
+
+  // Only these scenes gain obstacles, the others are only cleared
+  const bool adds_obstacles = scene_type == RandomLevelGenerator::SceneType::GRAVEYARD_EXTERIOR ||
+                              scene_type == RandomLevelGenerator::SceneType::CRYPT_INTERIOR;
+
+  // apply the rule to the seed grid and write the result straight back to the registry
+  const char *obstacle_type = scene_type == RandomLevelGenerator::SceneType::CRYPT_INTERIOR ? "sprite.crypt.wall.int" : "sprite.graveyard.wall.int";
+  const Sprites::MultiSprite &ms = m_sprite_factory.get_multisprite_by_type( obstacle_type );
+  Cmp::RandomInt texture_picker( 0, static_cast<int>( ms.get_sprite_count() ) - 1, Utils::Rnd::Stream::CELL_AUTOMATA );
+  for ( const auto &cell_entity : cell_entities )
+  {
+    const int neighbour_count = seed.block_count( cell_entity.x, cell_entity.y );
+    if ( neighbour_count > 2 and neighbour_count < 5 ) { Factory::remove_obstacle( reg(), cell_entity.entt ); }
+    else if ( adds_obstacles and not blocked.test( cell_entity.x, cell_entity.y ) )
     {
-      if ( reg().any_of<Cmp::ReservedPosition>( pos_entt ) ) continue;
-      std::vector<entt::entity> neighbour_list = levelgen_spatialgrid.neighbours( pos_cmp );
-      SPDLOG_DEBUG( "#{} at {},{} has {} nieghbours", static_cast<uint32_t>( pos_entt ), pos_cmp.x(), pos_cmp.y(), neighbour_list.size() );
-
-      if ( neighbour_list.size() <= 2 )
-      {
-        if ( scene_type == RandomLevelGenerator::SceneType::GRAVEYARD_EXTERIOR )
-        {
-          auto [_, idx] = m_sprite_factory.get_random_type_and_texture_index( { "sprite.graveyard.wall.int" } );
-          Factory::create_obstacle( reg(), pos_entt, pos_cmp, ms, idx );
-        }
-        else if ( scene_type == RandomLevelGenerator::SceneType::CRYPT_INTERIOR )
-        {
-          auto [_, idx] = m_sprite_factory.get_random_type_and_texture_index( { "sprite.crypt.wall.int" } );
-          Factory::create_obstacle( reg(), pos_entt, pos_cmp, ms, idx );
-        }
-      }
-      else if ( neighbour_list.size() > 2 and neighbour_list.size() < 5 )
-      {
-        //
-        Factory::remove_obstacle( reg(), pos_entt );
-      }
-      else
-      {
-
-        if ( scene_type == RandomLevelGenerator::SceneType::GRAVEYARD_EXTERIOR )
-        {
-          auto [_, idx] = m_sprite_factory.get_random_type_and_texture_index( { "sprite.graveyard.wall.int" } );
-          Factory::create_obstacle( reg(), pos_entt, pos_cmp, ms, idx );
-        }
-        else if ( scene_type == RandomLevelGenerator::SceneType::CRYPT_INTERIOR )
-        {
-          auto [_, idx] = m_sprite_factory.get_random_type_and_texture_index( { "sprite.crypt.wall.int" } );
-          Factory::create_obstacle( reg(), pos_entt, pos_cmp, ms, idx );
-        }
-      }
+      Factory::create_obstacle( reg(), cell_entity.entt, reg().get<Cmp::Position>( cell_entity.entt ), ms,
+                                static_cast<std::size_t>( texture_picker.gen() ) );
     }
-    SPDLOG_INFO( "Iteration #{} took {}ms", i, iteration_timer.restart().asMilliseconds() );
   }
 
-  SPDLOG_DEBUG( "Total Iterations: {}", iterations );
+  SPDLOG_DEBUG( "Cellular automata: smoothed {} cells in {}us", cell_entities.size(), timer.getElapsedTime().asMicroseconds() );
 }
 
-} // namespace ProceduralMaze::Sys::ProcGen
\ No newline at end of file
+} // namespace ProceduralMaze::Sys::ProcGen
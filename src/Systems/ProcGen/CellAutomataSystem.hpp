@@ -35,7 +35,13 @@ public:
   //! @brief event handlers for resuming system clocks
   void on_resume() override {}
 
-  void iterate( unsigned int iterations, RandomLevelGenerator::SceneType scene_type, PathFinding::SpatialHashGrid &levelgen_spatialgrid );
+  //! @brief Smooth the obstacle layout with one pass of a cellular automaton.
+  //! Every Position cell (except reserved ones) is one automaton cell, seeded from the obstacles in `levelgen_spatialgrid`.
+  //! A cell whose 3x3 block holds 3 or 4 obstacles is cleared; in GRAVEYARD_EXTERIOR and CRYPT_INTERIOR any other cell
+  //! becomes an obstacle. The neighbours are counted on a bit grid and the registry is updated once.
+  //! @param scene_type Selects the obstacle sprites and whether obstacles are added
+  //! @param levelgen_spatialgrid The initial obstacles. Not modified.
+  void smooth( RandomLevelGenerator::SceneType scene_type, const PathFinding::SpatialHashGrid &levelgen_spatialgrid );
 };
 
 } // namespace ProceduralMaze::Sys::ProcGen
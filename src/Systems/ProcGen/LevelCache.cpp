@@ -0,0 +1,490 @@
+#include <Components/AbsoluteAlpha.hpp>
+#include <Components/Altar/AltarMultiBlock.hpp>
+#include <Components/Altar/AltarSegment.hpp>
+#include <Components/Armable.hpp>
+#include <Components/Crypt/CryptEntrance.hpp>
+#include <Components/Crypt/CryptMultiBlock.hpp>
+#include <Components/Crypt/CryptSegment.hpp>
+#include <Components/DestroyedObstacle.hpp>
+#include <Components/Exit.hpp>
+#include <Components/Grave/GraveMultiBlock.hpp>
+#include <Components/Grave/GraveSegment.hpp>
+#include <Components/HolyWell/HolyWellEntrance.hpp>
+#include <Components/HolyWell/HolyWellMultiBlock.hpp>
+#include <Components/HolyWell/HolyWellSegment.hpp>
+#include <Components/Inventory/Explosive.hpp>
+#include <Components/Inventory/InventoryItem.hpp>
+#include <Components/Inventory/InventoryWearLevel.hpp>
+#include <Components/Inventory/ScryingBall.hpp>
+#include <Components/LootContainer.hpp>
+#include <Components/Npc/NpcContainer.hpp>
+#include <Components/Npc/NpcNoPathFinding.hpp>
+#include <Components/Obstacle.hpp>
+#include <Components/Persistent/GraveNumMultiplier.hpp>
+#include <Components/Persistent/MaxNumAltars.hpp>
+#include <Components/Persistent/MaxNumCrypts.hpp>
+#include <Components/PlantObstacle.hpp>
+#include <Components/Player/PlayerNoPath.hpp>
+#include <Components/Position.hpp>
+#include <Components/ReservedPosition.hpp>
+#include <Components/Ruin/RuinBuildingMultiBlock.hpp>
+#include <Components/Ruin/RuinEntrance.hpp>
+#include <Components/Ruin/RuinSegment.hpp>
+#include <Components/SpawnArea.hpp>
+#include <Components/SpriteAnimation.hpp>
+#include <Components/VoidPosition.hpp>
+#include <Components/Wall.hpp>
+#include <Components/ZOrderValue.hpp>
+#include <Systems/PersistSystem.hpp>
+#include <Systems/PersistSystemImpl.hpp>
+#include <Systems/ProcGen/LevelCache.hpp>
+#include <Systems/Stores/ItemStore.hpp>
+#include <Utils/RngStreams.hpp>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ProceduralMaze::Sys::ProcGen
+{
+
+namespace
+{
+
+// File layout, all integers in native byte order (the cache never leaves the machine that wrote it):
+//
+//  Header   magic, format version, schema, level seed, settings, source write time, config write times, source path,
+//           payload size, payload checksum
+//  Payload  RNG stream snapshot, level entity count, then for each codec in `kCodecs` order:
+//           component count, owner entity indices, component values
+//
+// Entities are stored as indices into the level's entities, so they can be recreated with whatever IDs are free.
+
+constexpr std::uint32_t kMagic = 0x434c4d50; // "PMLC"
+
+//! @brief FNV-1a
+constexpr std::uint64_t hash( std::string_view bytes, std::uint64_t value = 0xcbf29ce484222325ULL )
+{
+  for ( char c : bytes )
+  {
+    value ^= static_cast<unsigned char>( c );
+    value *= 0x100000001b3ULL;
+  }
+  return value;
+}
+
+class Writer
+{
+public:
+  template <typename T>
+    requires std::is_trivially_copyable_v<T>
+  void put( const T &value )
+  {
+    m_bytes.append( reinterpret_cast<const char *>( &value ), sizeof( T ) );
+  }
+
+  void put( std::string_view text )
+  {
+    put( static_cast<std::uint32_t>( text.size() ) );
+    m_bytes.append( text );
+  }
+
+  const std::string &bytes() const { return m_bytes; }
+
+private:
+  std::string m_bytes;
+};
+
+class Reader
+{
+public:
+  explicit Reader( std::string_view bytes )
+      : m_bytes( bytes )
+  {
+  }
+
+  template <typename T>
+    requires std::is_trivially_copyable_v<T>
+  T get()
+  {
+    std::array<char, sizeof( T )> raw;
+    std::memcpy( raw.data(), take( sizeof( T ) ).data(), sizeof( T ) );
+    return std::bit_cast<T>( raw );
+  }
+
+  std::string_view get_string() { return take( get<std::uint32_t>() ); }
+
+  std::string_view take( std::size_t count )
+  {
+    if ( count > m_bytes.size() - m_pos ) throw std::runtime_error( "LevelCache: truncated snapshot" );
+    auto bytes = m_bytes.substr( m_pos, count );
+    m_pos += count;
+    return bytes;
+  }
+
+  std::string_view rest() const { return m_bytes.substr( m_pos ); }
+
+private:
+  std::string_view m_bytes;
+  std::size_t m_pos{ 0 };
+};
+
+//! @brief Reads and writes one component value. Trivially copyable components are stored as they are in memory,
+//! anything holding interned sprite types or heap data needs a specialisation.
+template <typename T>
+struct ValueCodec
+{
+  static_assert( std::is_trivially_copyable_v<T>, "LevelCache: component needs a ValueCodec specialisation" );
+  static void write( Writer &out, const T &value ) { out.put( value ); }
+  static T read( Reader &in ) { return in.get<T>(); }
+};
+
+//! @brief SpriteMetaType IDs are handed out in the order types are first seen, so store the name instead
+template <>
+struct ValueCodec<Cmp::SpriteAnimation>
+{
+  static void write( Writer &out, const Cmp::SpriteAnimation &anim )
+  {
+    out.put( anim.m_current_frame );
+    out.put( anim.m_base_frame );
+    out.put( anim.m_elapsed_time.asMicroseconds() );
+    out.put( anim.m_animation_active );
+    out.put( std::string_view( anim.m_sprite_type.name() ) );
+    out.put( anim.getFrameIndexOffset() );
+    out.put( anim.get_framerate() );
+    out.put( anim.m_anim_type );
+  }
+
+  static Cmp::SpriteAnimation read( Reader &in )
+  {
+    auto current_frame = in.get<unsigned int>();
+    auto base_frame = in.get<unsigned int>();
+    auto elapsed_time = sf::microseconds( in.get<std::int64_t>() );
+    auto animation_active = in.get<bool>();
+    Sprites::SpriteMetaType sprite_type( in.get_string() );
+    auto frame_index_offset = in.get<unsigned int>();
+    auto framerate = in.get<float>();
+    auto anim_type = in.get<Cmp::AnimType>();
+
+    Cmp::SpriteAnimation anim( current_frame, base_frame, animation_active, sprite_type, frame_index_offset, framerate, anim_type );
+    anim.m_elapsed_time = elapsed_time;
+    return anim;
+  }
+};
+
+//! @brief Items with actions come from the ItemStore, so only their key is stored and the actions are looked up again
+template <>
+struct ValueCodec<Cmp::InventoryItem>
+{
+  static void write( Writer &out, const Cmp::InventoryItem &item )
+  {
+    out.put( std::string_view( item.sprite_type.name() ) );
+    out.put( item.actions.empty() ? std::string{} : ItemStore::instance().find_key( item.sprite_type ) );
+  }
+
+  static Cmp::InventoryItem read( Reader &in )
+  {
+    Sprites::SpriteMetaType sprite_type( in.get_string() );
+    auto item_key = in.get_string();
+    if ( item_key.empty() ) return Cmp::InventoryItem( sprite_type );
+    return ItemStore::instance().get_item( std::string( item_key ) );
+  }
+};
+
+using EntityIndex = std::unordered_map<entt::entity, std::uint32_t>;
+
+//! @brief Reads and writes every level entity's `T` component
+struct Codec
+{
+  std::string_view name;
+  std::size_t size;
+  entt::id_type type;
+  void ( *save )( Writer &out, entt::registry &reg, const EntityIndex &index );
+  void ( *load )( Reader &in, entt::registry &reg, const std::vector<entt::entity> &entities );
+};
+
+template <typename T>
+void save_pool( Writer &out, entt::registry &reg, const EntityIndex &index )
+{
+  // keep the pool's packed order, so views visit the restored level in the same order as the generated one
+  const auto &pool = reg.storage<T>();
+  std::vector<entt::entity> owners;
+  for ( std::size_t i = 0; i < pool.size(); ++i )
+  {
+    if ( index.contains( pool.data()[i] ) ) owners.push_back( pool.data()[i] );
+  }
+
+  out.put( static_cast<std::uint32_t>( owners.size() ) );
+  for ( auto entt : owners )
+    out.put( index.at( entt ) );
+  if constexpr ( not std::is_empty_v<T> )
+  {
+    for ( auto entt : owners )
+      ValueCodec<T>::write( out, pool.get( entt ) );
+  }
+}
+
+template <typename T>
+void load_pool( Reader &in, entt::registry &reg, const std::vector<entt::entity> &entities )
+{
+  std::vector<entt::entity> owners( in.get<std::uint32_t>() );
+  for ( auto &owner : owners )
+    owner = entities.at( in.get<std::uint32_t>() );
+
+  if constexpr ( std::is_empty_v<T> ) { reg.insert<T>( owners.begin(), owners.end() ); }
+  else
+  {
+    std::vector<T> values;
+    values.reserve( owners.size() );
+    for ( std::size_t i = 0; i < owners.size(); ++i )
+      values.push_back( ValueCodec<T>::read( in ) );
+    reg.insert<T>( owners.begin(), owners.end(), values.begin() );
+  }
+}
+
+template <typename T>
+constexpr Codec codec( std::string_view name )
+{
+  return Codec{ name, sizeof( T ), entt::type_hash<T>::value(), &save_pool<T>, &load_pool<T> };
+}
+
+//! @brief Every component the graveyard generators create. Appending one here changes the schema, which invalidates
+//! existing snapshots by itself; changing an existing component's members needs a `kFormatVersion` bump.
+const std::array kCodecs{
+    codec<Cmp::Position>( "Position" ),
+    codec<Cmp::VoidPosition>( "VoidPosition" ),
+    codec<Cmp::Wall>( "Wall" ),
+    codec<Cmp::SpawnArea>( "SpawnArea" ),
+    codec<Cmp::ReservedPosition>( "ReservedPosition" ),
+    codec<Cmp::NpcNoPathFinding>( "NpcNoPathFinding" ),
+    codec<Cmp::PlayerNoPath>( "PlayerNoPath" ),
+    codec<Cmp::Exit>( "Exit" ),
+    codec<Cmp::Obstacle>( "Obstacle" ),
+    codec<Cmp::DestroyedObstacle>( "DestroyedObstacle" ),
+    codec<Cmp::AbsoluteAlpha>( "AbsoluteAlpha" ),
+    codec<Cmp::Armable>( "Armable" ),
+    codec<Cmp::SpriteAnimation>( "SpriteAnimation" ),
+    codec<Cmp::ZOrderValue>( "ZOrderValue" ),
+    codec<Cmp::PlantObstacle>( "PlantObstacle" ),
+    codec<Cmp::InventoryItem>( "InventoryItem" ),
+    codec<Cmp::InventoryWearLevel>( "InventoryWearLevel" ),
+    codec<Cmp::SeeingStone>( "SeeingStone" ),
+    codec<Cmp::Explosive>( "Explosive" ),
+    codec<Cmp::LootContainer>( "LootContainer" ),
+    codec<Cmp::NpcContainer>( "NpcContainer" ),
+    codec<Cmp::GraveMultiBlock>( "GraveMultiBlock" ),
+    codec<Cmp::GraveSegment>( "GraveSegment" ),
+    codec<Cmp::AltarMultiBlock>( "AltarMultiBlock" ),
+    codec<Cmp::AltarSegment>( "AltarSegment" ),
+    codec<Cmp::CryptMultiBlock>( "CryptMultiBlock" ),
+    codec<Cmp::CryptSegment>( "CryptSegment" ),
+    codec<Cmp::CryptEntrance>( "CryptEntrance" ),
+    codec<Cmp::HolyWellMultiBlock>( "HolyWellMultiBlock" ),
+    codec<Cmp::HolyWellSegment>( "HolyWellSegment" ),
+    codec<Cmp::HollyWellEntrance>( "HollyWellEntrance" ),
+    codec<Cmp::RuinBuildingMultiBlock>( "RuinBuildingMultiBlock" ),
+    codec<Cmp::RuinSegment>( "RuinSegment" ),
+    codec<Cmp::RuinEntrance>( "RuinEntrance" ),
+};
+
+std::uint64_t schema()
+{
+  auto value = hash( "" );
+  for ( const auto &codec : kCodecs )
+  {
+    value = hash( codec.name, value );
+    value = hash( std::to_string( codec.size ), value );
+  }
+  return value;
+}
+
+std::int64_t write_time( const std::filesystem::path &path )
+{
+  std::error_code ec;
+  auto time = std::filesystem::last_write_time( path, ec );
+  return ec ? 0 : static_cast<std::int64_t>( time.time_since_epoch().count() );
+}
+
+//! @brief Fingerprint of the JSON configs a snapshot depends on besides its source: the ItemStore items its InventoryItem
+//! components are looked up in, and the sprite metadata the generators picked sprite types and tiles from
+std::uint64_t config_write_times()
+{
+  auto value = hash( "" );
+  for ( const auto *path : { "res/json/items.json", "res/json/sprite_metadata.json" } )
+    value = hash( std::to_string( write_time( path ) ), value );
+  return value;
+}
+
+} // namespace
+
+LevelCache::LevelCache( entt::registry &reg, std::uint64_t level_seed, std::filesystem::path source )
+    : m_reg( reg ),
+      m_level_seed( level_seed ),
+      m_source( std::move( source ) ),
+      m_enabled( Utils::Rnd::RngStreams::is_explicit_seed() )
+{
+  if ( not m_enabled ) return;
+
+  auto settings = std::to_string( PersistSystem::get<Cmp::Persist::GraveNumMultiplier>( m_reg ).get_value() ) + ',' +
+                  std::to_string( PersistSystem::get<Cmp::Persist::MaxNumAltars>( m_reg ).get_value() ) + ',' +
+                  std::to_string( PersistSystem::get<Cmp::Persist::MaxNumCrypts>( m_reg ).get_value() );
+  m_settings = hash( settings );
+
+  for ( auto [entt] : m_reg.storage<entt::entity>().each() )
+    m_existing.insert( entt );
+
+  m_path = directory() / fmt::format( "{:016x}-{:016x}.level", m_level_seed, m_settings );
+}
+
+bool LevelCache::load()
+{
+  if ( not m_enabled ) return false;
+
+  std::ifstream file( m_path, std::ios::binary | std::ios::ate );
+  if ( not file ) return false;
+
+  std::string bytes( static_cast<std::size_t>( file.tellg() ), '\0' );
+  file.seekg( 0 );
+  if ( not file.read( bytes.data(), static_cast<std::streamsize>( bytes.size() ) ) )
+  {
+    SPDLOG_WARN( "Could not read level cache {}", m_path.string() );
+    return false;
+  }
+
+  // a snapshot that fails part way through must leave the registry and the RNG streams as they were, so the level can
+  // still be generated
+  const auto rng_state = Utils::Rnd::RngStreams::snapshot();
+  std::vector<entt::entity> entities;
+  Reader in( bytes );
+  try
+  {
+    if ( in.get<std::uint32_t>() != kMagic || in.get<std::uint32_t>() != kFormatVersion || in.get<std::uint64_t>() != schema() ||
+         in.get<std::uint64_t>() != m_level_seed || in.get<std::uint64_t>() != m_settings ||
+         in.get<std::int64_t>() != write_time( m_source ) || in.get<std::uint64_t>() != config_write_times() ||
+         in.get_string() != m_source.generic_string() )
+    {
+      SPDLOG_INFO( "Level cache {} is stale, regenerating", m_path.string() );
+      return false;
+    }
+    auto payload_size = in.get<std::uint64_t>();
+    auto checksum = in.get<std::uint64_t>();
+    if ( payload_size != in.rest().size() || checksum != hash( in.rest() ) ) throw std::runtime_error( "checksum mismatch" );
+
+    // the checksum matched, so the payload is what save() wrote, but its items and sprite types must still resolve
+    if ( not Utils::Rnd::RngStreams::restore( in.get_string() ) ) throw std::runtime_error( "bad RNG stream snapshot" );
+    entities.resize( in.get<std::uint32_t>() );
+    m_reg.create( entities.begin(), entities.end() );
+    for ( const auto &codec : kCodecs )
+      codec.load( in, m_reg, entities );
+  }
+  catch ( const std::exception &e )
+  {
+    SPDLOG_WARN( "Level cache {} is unusable ({}), regenerating", m_path.string(), e.what() );
+    m_reg.destroy( entities.begin(), entities.end() );
+    std::ignore = Utils::Rnd::RngStreams::restore( rng_state );
+    return false;
+  }
+
+  // mark it as recently used, so prune() keeps it
+  std::error_code ec;
+  std::filesystem::last_write_time( m_path, std::filesystem::file_time_type::clock::now(), ec );
+
+  SPDLOG_INFO( "Loaded {} entities for {} from level cache {}", entities.size(), m_source.string(), m_path.string() );
+  return true;
+}
+
+void LevelCache::save() const
+{
+  if ( not m_enabled ) return;
+
+  EntityIndex index;
+  for ( auto [entt] : m_reg.storage<entt::entity>().each() )
+  {
+    if ( not m_existing.contains( entt ) ) index.emplace( entt, static_cast<std::uint32_t>( index.size() ) );
+  }
+
+  // a component without a codec would silently go missing from the restored level, so refuse to cache it
+  for ( auto [id, pool] : m_reg.storage() )
+  {
+    if ( id == entt::type_hash<entt::entity>::value() ) continue;
+    if ( std::ranges::any_of( kCodecs, [id]( const Codec &codec ) { return codec.type == id; } ) ) continue;
+    for ( auto entt : pool )
+    {
+      if ( not index.contains( entt ) ) continue;
+      SPDLOG_WARN( "Not caching {}: {} has no LevelCache codec", m_source.string(), pool.type().name() );
+      return;
+    }
+  }
+
+  Writer payload;
+  payload.put( Utils::Rnd::RngStreams::snapshot() );
+  payload.put( static_cast<std::uint32_t>( index.size() ) );
+  for ( const auto &codec : kCodecs )
+    codec.save( payload, m_reg, index );
+
+  Writer header;
+  header.put( kMagic );
+  header.put( kFormatVersion );
+  header.put( schema() );
+  header.put( m_level_seed );
+  header.put( m_settings );
+  header.put( write_time( m_source ) );
+  header.put( config_write_times() );
+  header.put( std::string_view( m_source.generic_string() ) );
+  header.put( static_cast<std::uint64_t>( payload.bytes().size() ) );
+  header.put( hash( payload.bytes() ) );
+
+  std::error_code ec;
+  std::filesystem::create_directories( m_path.parent_path(), ec );
+  std::ofstream file( m_path, std::ios::binary | std::ios::trunc );
+  file.write( header.bytes().data(), static_cast<std::streamsize>( header.bytes().size() ) );
+  file.write( payload.bytes().data(), static_cast<std::streamsize>( payload.bytes().size() ) );
+  if ( not file )
+  {
+    SPDLOG_WARN( "Could not write level cache {}", m_path.string() );
+    file.close();
+    std::filesystem::remove( m_path, ec );
+    return;
+  }
+  file.close();
+  SPDLOG_INFO( "Cached {} entities for {} in {} ({} bytes)", index.size(), m_source.string(), m_path.string(),
+               header.bytes().size() + payload.bytes().size() );
+  prune();
+}
+
+void LevelCache::prune()
+{
+  std::error_code ec;
+  std::vector<std::pair<std::filesystem::file_time_type, std::filesystem::path>> snapshots;
+  for ( const auto &entry : std::filesystem::directory_iterator( directory(), ec ) )
+  {
+    if ( entry.path().extension() == ".level" ) snapshots.emplace_back( entry.last_write_time( ec ), entry.path() );
+  }
+  if ( snapshots.size() <= kMaxSnapshots ) return;
+
+  // newest first, then delete everything past the limit
+  std::ranges::sort( snapshots, std::greater{} );
+  for ( const auto &[time, path] : snapshots | std::views::drop( kMaxSnapshots ) )
+  {
+    SPDLOG_DEBUG( "Evicting level cache {}", path.string() );
+    std::filesystem::remove( path, ec );
+  }
+}
+
+std::filesystem::path LevelCache::directory() { return std::filesystem::temp_directory_path() / "ProceduralMaze" / "levels"; }
+
+} // namespace ProceduralMaze::Sys::ProcGen
@@ -0,0 +1,71 @@
+#ifndef SRC_SYSTEMS_PROCGEN_LEVELCACHE_HPP_
+#define SRC_SYSTEMS_PROCGEN_LEVELCACHE_HPP_
+
+#include <entt/entity/registry.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <unordered_set>
+
+namespace ProceduralMaze::Sys::ProcGen
+{
+
+//! @brief Compact binary snapshot of a generated level, so generating a level the game has generated before becomes one
+//! sequential file read and a bulk insert per component type.
+//!
+//! The snapshot holds every entity created between construction and `save()` with its components, and the state of the
+//! RNG streams at `save()`, so whatever the scene generates after the cached steps draws the same numbers either way.
+//! Only runs with an explicit seed (`--seed`) use the cache: a random game seed never repeats, so its levels could never be
+//! loaded again. At most `kMaxSnapshots` files are kept, the least recently used are deleted first.
+//! Files are keyed by the level seed (see `Utils::Rnd::RngStreams::begin_level()`), the SceneData source and the
+//! persistent settings that change the generated level, and are ignored if the source, the item or the sprite config has
+//! changed since.
+//! Only components with a codec in LevelCache.cpp can be cached: `save()` skips any level that owns another component.
+//! @note Bump `kFormatVersion` when the file layout changes or a cached component gains, loses or reorders members.
+class LevelCache
+{
+public:
+  static constexpr std::uint32_t kFormatVersion = 2;
+  static constexpr std::size_t kMaxSnapshots = 16;
+
+  //! @brief Start caching a level. Entities already in `reg` (i.e. the player) are never part of the snapshot.
+  //! @param reg the scene registry
+  //! @param level_seed the value returned by `Utils::Rnd::RngStreams::begin_level()` for this level
+  //! @param source the SceneData source file
+  LevelCache( entt::registry &reg, std::uint64_t level_seed, std::filesystem::path source );
+
+  //! @brief Recreate the cached level in the registry and restore the RNG streams
+  //! @return false if there is no usable snapshot (always, without an explicit seed), and the level must be generated and
+  //! then passed to `save()`. The registry and RNG streams are left untouched in that case.
+  bool load();
+
+  //! @brief Snapshot every entity created since construction, then `prune()`. Does nothing without an explicit seed.
+  void save() const;
+
+  //! @brief Delete all but the `kMaxSnapshots` most recently written or loaded snapshots
+  static void prune();
+
+  //! @brief Directory the snapshots are written to
+  static std::filesystem::path directory();
+
+private:
+  entt::registry &m_reg;
+  std::uint64_t m_level_seed;
+  std::filesystem::path m_source;
+
+  //! @brief see Utils::Rnd::RngStreams::is_explicit_seed()
+  bool m_enabled;
+
+  //! @brief fingerprint of the persistent settings the level generators read
+  std::uint64_t m_settings;
+
+  //! @brief entities that existed before generation started
+  std::unordered_set<entt::entity> m_existing;
+
+  std::filesystem::path m_path;
+};
+
+} // namespace ProceduralMaze::Sys::ProcGen
+
+#endif // SRC_SYSTEMS_PROCGEN_LEVELCACHE_HPP_
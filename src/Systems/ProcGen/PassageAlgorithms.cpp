@@ -86,7 +86,7 @@ std::vector<Cmp::CryptPassageBlock> PassageAlogirthms::create_drunken_walk( entt
 
   //! @brief Drunken walk roulette picker for direction
   //! @note undefined odds are used to select a random direction
-  Cmp::RandomInt direction_picker{ 0, 99 };
+  Cmp::RandomInt direction_picker{ 0, 99, Utils::Rnd::Stream::PASSAGES };
   //! @brief Drunken walk roulette odds for moving towards target: 60%
   static const float kRouletteTargetBiasOdds = 0.6f;
   //! @brief Drunken walk roulette odds for continuing in the same direction
@@ -162,7 +162,7 @@ std::vector<Cmp::CryptPassageBlock> PassageAlogirthms::create_drunken_walk( entt
         }
         else
         {
-          auto random_dir_idx = Cmp::RandomInt( 0, kDirectionChoices.size() - 1 );
+          auto random_dir_idx = Cmp::RandomInt( 0, kDirectionChoices.size() - 1, Utils::Rnd::Stream::PASSAGES );
           chosen_direction = kDirectionChoices[random_dir_idx.gen()];
         }
       }
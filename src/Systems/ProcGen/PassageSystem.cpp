@@ -15,6 +15,7 @@
 #include <Components/RectBounds.hpp>
 #include <Components/System.hpp>
 #include <Components/Wall.hpp>
+#include <Debug/Profiler.hpp>
 #include <Events/PlayerMortalityEvent.hpp>
 #include <Factory/CryptFactory.hpp>
 #include <Factory/ObstacleFactory.hpp>
@@ -37,6 +38,7 @@ namespace ProceduralMaze::Sys
 
 void PassageSystem::update( [[maybe_unused]] sf::Time dt )
 {
+  PROFILE_ZONE( "PassageSystem::update" );
   if ( m_connect_all_rooms ) { create_cached_passages(); }
 }
 
@@ -94,7 +96,7 @@ void PassageSystem::open_passages()
 
 void PassageSystem::add_spike_traps()
 {
-  auto passage_picker = Cmp::RandomInt( 0, m_passage_algos.get_current_passage_id() );
+  auto passage_picker = Cmp::RandomInt( 0, m_passage_algos.get_current_passage_id(), Utils::Rnd::Stream::PASSAGES );
   // static int max_num_spike_traps = 3;
   std::set<int> passage_ids_used;
 
@@ -39,6 +39,7 @@
 #include <Components/RectBounds.hpp>
 #include <Components/ReservedPosition.hpp>
 #include <Components/SpawnArea.hpp>
+#include <Components/VoidPosition.hpp>
 #include <Components/Wall.hpp>
 
 #include <Sprites/MultiSprite.hpp>
@@ -50,6 +51,7 @@
 #include <Utils/Utils.hpp>
 #include <memory>
 
+#include <PathFinding/OccupancyGrid.hpp>
 #include <PathFinding/SpatialHashGrid.hpp>
 #include <ranges>
 #include <spdlog/spdlog.h>
@@ -68,6 +70,12 @@ RandomLevelGenerator::RandomLevelGenerator( entt::registry &reg, sf::RenderWindo
 PathFinding::SpatialHashGrid &RandomLevelGenerator::get_obstacle_sm() { return *m_obstacle_sm; }
 PathFinding::SpatialHashGrid &RandomLevelGenerator::get_void_sm() { return *m_void_sm; }
 
+void RandomLevelGenerator::rebuild_void_sm()
+{
+  for ( auto [entt, void_pos_cmp] : reg().view<Cmp::VoidPosition>().each() )
+    m_void_sm->insert( entt, void_pos_cmp );
+}
+
 void RandomLevelGenerator::gen_game_area( const Scene::SceneData &scene_map )
 {
   auto [map_size_grid, map_size_pixel] = scene_map.map_size();
@@ -169,10 +177,11 @@ void RandomLevelGenerator::gen_game_area( const Scene::SceneData &scene_map )
 void RandomLevelGenerator::gen_graveyard_exterior_obstacles()
 {
   auto position_view = reg().view<Cmp::Position>( entt::exclude<Cmp::PlayerCharacter, Cmp::ReservedPosition> );
+  Cmp::RandomInt obstacle_picker( 0, 1, Utils::Rnd::Stream::PROCGEN );
   for ( auto [entity, pos_cmp] : position_view.each() )
   {
 
-    if ( Cmp::RandomInt{ 0, 1 }.gen() == 1 )
+    if ( obstacle_picker.gen() == 1 )
     {
       const Sprites::MultiSprite &ms = m_sprite_factory.get_multisprite_by_type( "sprite.graveyard.wall.int" );
       auto [_, rand_obst_tex_idx] = m_sprite_factory.get_random_type_and_texture_index( { "sprite.graveyard.wall.int" } );
@@ -274,98 +283,34 @@ void RandomLevelGenerator::do_gen_graveyard_exterior_multiblock( const Sprites::
 
 std::pair<entt::entity, Cmp::Position> RandomLevelGenerator::find_spawn_location( const Sprites::MultiSprite &ms, unsigned long seed )
 {
-  constexpr int kMaxAttempts = 1000;
-  int attempts = 0;
-  unsigned long current_seed = seed;
-
-  while ( attempts < kMaxAttempts )
-  {
-    auto [random_entity, random_pos] = Utils::Rnd::get_random_position(
-        reg(), Utils::Rnd::IncludePack<>{}, Utils::Rnd::ExcludePack<Cmp::Wall, Cmp::ReservedPosition, Cmp::PlayerCharacter>{}, current_seed );
-
-    auto lo_sprite_size = m_sprite_factory.get_sprite_size_by_type( ms.get_sprite_type() );
-    auto new_lo_hitbox = Cmp::RectBounds::scaled( random_pos.position, lo_sprite_size, 1.f );
-
-    // Check collisions with walls, graves, shrines
-    auto is_valid = [&]() -> bool
-    {
-      // return false for wall collisions
-      for ( auto [entity, wall_cmp, wall_pos_cmp] : reg().view<Cmp::Wall, Cmp::Position>().each() )
-      {
-        if ( wall_pos_cmp.findIntersection( new_lo_hitbox.getBounds() ) ) return false;
-      }
-
-      // Return false for grave collisions
-      for ( auto [entity, grave_cmp, grave_pos_cmp] : reg().view<Cmp::GraveSegment, Cmp::Position>().each() )
-      {
-        if ( grave_pos_cmp.findIntersection( new_lo_hitbox.getBounds() ) ) return false;
-      }
-
-      // Return false for altar collisions
-      for ( auto [entity, altar_cmp, altar_pos_cmp] : reg().view<Cmp::AltarSegment, Cmp::Position>().each() )
-      {
-        if ( altar_pos_cmp.findIntersection( new_lo_hitbox.getBounds() ) ) return false;
-      }
-
-      // Return false for crypt collisions
-      for ( auto [entity, crypt_cmp, crypt_pos_cmp] : reg().view<Cmp::CryptSegment, Cmp::Position>().each() )
-      {
-        if ( crypt_pos_cmp.findIntersection( new_lo_hitbox.getBounds() ) ) return false;
-      }
-
-      for ( auto [entity, holywell_cmp, holywell_pos_cmp] : reg().view<Cmp::HolyWellSegment, Cmp::Position>().each() )
-      {
-        if ( holywell_pos_cmp.findIntersection( new_lo_hitbox.getBounds() ) ) return false;
-      }
+  // void cells hold no Cmp::Position, so they must block too or large obstacles could land outside the playable area
+  using SpawnOccupancy =
+      PathFinding::BlockerOccupancy<Cmp::Wall, Cmp::GraveSegment, Cmp::AltarSegment, Cmp::CryptSegment, Cmp::HolyWellSegment, Cmp::RuinSegment,
+                                    Cmp::CryptObjectiveSegment, Cmp::ReservedPosition, Cmp::SpawnArea, Cmp::VoidPosition>;
 
-      for ( auto [entity, ruin_cmp, ruin_pos_cmp] : reg().view<Cmp::RuinSegment, Cmp::Position>().each() )
-      {
-        if ( ruin_pos_cmp.findIntersection( new_lo_hitbox.getBounds() ) ) return false;
-      }
-
-      for ( auto [entity, crypt_obj_cmp, crypt_obj_pos_cmp] : reg().view<Cmp::CryptObjectiveSegment, Cmp::Position>().each() )
-      {
-        if ( crypt_obj_pos_cmp.findIntersection( new_lo_hitbox.getBounds() ) ) return false;
-      }
-
-      // Return false for reserved position collisions
-      for ( auto [entity, reserved_cmp, reserved_pos_cmp] : reg().view<Cmp::ReservedPosition, Cmp::Position>().each() )
-      {
-        if ( reserved_pos_cmp.findIntersection( new_lo_hitbox.getBounds() ) ) return false;
-      }
-
-      // Return false for spawn area collisions
-      for ( auto [entity, spawn_cmp, spawn_pos_cmp] : reg().view<Cmp::SpawnArea, Cmp::Position>().each() )
-      {
-        if ( spawn_pos_cmp.findIntersection( new_lo_hitbox.getBounds() ) ) return false;
-      }
+  auto lo_sprite_size = m_sprite_factory.get_sprite_size_by_type( ms.get_sprite_type() );
+  std::vector<sf::Vector2i> candidates = SpawnOccupancy::get( reg() ).free_cells( PathFinding::OccupancyGrid::footprint( lo_sprite_size ) );
 
-      // Return false for playable character collisions
-      for ( auto [entity, player_cmp, player_pos_cmp] : reg().view<Cmp::PlayerCharacter, Cmp::Position>().each() )
-      {
-        if ( player_pos_cmp.findIntersection( new_lo_hitbox.getBounds() ) ) return false;
-      }
-
-      return true;
-    };
-
-    if ( is_valid() )
-    {
-      if ( current_seed != seed && seed > 0 )
-      {
-        SPDLOG_WARN( "Large Obstacle spawn: original seed {} was invalid, used seed {} instead (attempt {})", seed, current_seed, attempts + 1 );
-      }
-      auto new_entt = reg().create();
-      return { new_entt, reg().emplace_or_replace<Cmp::Position>( new_entt, random_pos.position, random_pos.size ) };
-    }
+  // the player moves without raising signals, so it is checked here instead of being tracked by the occupancy grid
+  for ( auto [entity, player_cmp, player_pos_cmp] : reg().view<Cmp::PlayerCharacter, Cmp::Position>().each() )
+  {
+    std::erase_if( candidates, [&]( sf::Vector2i cell )
+                   { return player_pos_cmp.findIntersection( { PathFinding::OccupancyGrid::cell_position( cell ), lo_sprite_size } ).has_value(); } );
+  }
 
-    attempts++;
-    // Increment seed for next attempt (works for both seeded and non-seeded cases)
-    if ( seed > 0 ) { current_seed++; }
+  if ( candidates.empty() )
+  {
+    SPDLOG_ERROR( "Failed to find valid large obstacle spawn location for {} (seed: {})", ms.get_sprite_type(), seed );
+    return { entt::null, Cmp::Position{ { 0.f, 0.f }, { 0.f, 0.f } } };
   }
 
-  SPDLOG_ERROR( "Failed to find valid large obstacle spawn location after {} attempts (original seed: {})", kMaxAttempts, seed );
-  return { entt::null, Cmp::Position{ { 0.f, 0.f }, { 0.f, 0.f } } };
+  Cmp::RandomInt seed_picker( 0, static_cast<int>( candidates.size() - 1 ), Utils::Rnd::Stream::PROCGEN );
+  if ( seed != 0 ) { seed_picker.seed( seed ); }
+  const auto cell = candidates[static_cast<std::size_t>( seed_picker.gen() )];
+
+  auto new_entt = reg().create();
+  return { new_entt,
+           reg().emplace_or_replace<Cmp::Position>( new_entt, PathFinding::OccupancyGrid::cell_position( cell ), Constants::kGridSizePxF ) };
 }
 
 std::vector<entt::entity> RandomLevelGenerator::gen_random_plants( sf::Vector2u map_grid_size )
@@ -377,7 +322,7 @@ std::vector<entt::entity> RandomLevelGenerator::gen_random_plants( sf::Vector2u
   for ( std::size_t i = 0; i < num_plants; ++i )
   {
     auto [random_entity, random_pos] = Utils::Rnd::get_random_position(
-        reg(), {}, Utils::Rnd::ExcludePack<Cmp::PlayerCharacter, Cmp::ReservedPosition, Cmp::Obstacle>{}, 0 );
+        reg(), {}, Utils::Rnd::ExcludePack<Cmp::PlayerCharacter, Cmp::ReservedPosition, Cmp::Obstacle>{}, 0, Utils::Rnd::Stream::PROCGEN );
 
     // select a random number within the range of possible flora CarryItems
     auto [rand_plant_type, rnd_plant_idx] = m_sprite_factory.get_random_type_and_texture_index(
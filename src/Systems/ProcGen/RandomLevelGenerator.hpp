@@ -88,12 +88,17 @@ public:
   std::vector<entt::entity> gen_random_plants( sf::Vector2u map_grid_size );
 
   //! @brief Call this to make sure the level data is reset before regenerating a new scene
-  void reset()
+  //! @param map_grid_size Scene dimensions in cells, used to give the level spatial grids dense storage
+  void reset( sf::Vector2u map_grid_size = { 0, 0 } )
   {
-    m_obstacle_sm = std::make_unique<PathFinding::SpatialHashGrid>();
-    m_void_sm = std::make_unique<PathFinding::SpatialHashGrid>();
+    m_obstacle_sm = std::make_unique<PathFinding::SpatialHashGrid>( map_grid_size );
+    m_void_sm = std::make_unique<PathFinding::SpatialHashGrid>( map_grid_size );
   }
 
+  //! @brief Repopulate the void grid from the registry's Cmp::VoidPosition entities, for a level restored from a
+  //! LevelCache instead of generated by `gen_game_area()`. Call `reset()` first.
+  void rebuild_void_sm();
+
   //! @brief event handlers for pausing system clocks
   void on_pause() override {}
   //! @brief event handlers for resuming system clocks
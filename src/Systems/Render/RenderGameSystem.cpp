@@ -40,6 +40,7 @@
 #include <Components/Wall.hpp>
 #include <Components/Wormhole/WormholeMultiBlock.hpp>
 #include <Components/ZOrderValue.hpp>
+#include <Debug/Profiler.hpp>
 #include <LightningStrike.hpp>
 #include <PathFinding/SpatialHashGrid.hpp>
 #include <Random.hpp>
@@ -52,6 +53,7 @@
 #include <Shaders/MistShader.hpp>
 #include <Shaders/NightStaticShader.hpp>
 #include <Sprites/MultiSprite.hpp>
+#include <Sprites/SpriteTypes.hpp>
 #include <Sprites/TileMap.hpp>
 #include <Systems/BaseSystem.hpp>
 #include <Systems/ParticleSystem.hpp>
@@ -59,6 +61,7 @@
 #include <Systems/Render/RenderGameSystem.hpp>
 #include <Systems/Render/RenderOverlaySystem.hpp>
 #include <Systems/Render/RenderSystem.hpp>
+#include <Systems/Render/ZOrderQueue.hpp>
 #include <Systems/ShaderSystem.hpp>
 #include <Systems/Threats/HazardFieldSystemImpl.hpp>
 #include <Utils/Constants.hpp>
@@ -94,6 +97,7 @@ RenderGameSystem::~RenderGameSystem() = default;
 
 void RenderGameSystem::render_game( sf::Time dt, RenderOverlaySystem &render_overlay_sys )
 {
+  PROFILE_ZONE( "RenderGameSystem::render_game" );
   using namespace Sprites;
 
   // check for updates to the System modes
@@ -112,6 +116,7 @@ void RenderGameSystem::render_game( sf::Time dt, RenderOverlaySystem &render_ove
   // make sure the local view is centered on the player mid-point and not at their top-left corner
   // (otherwise this makes views, shaders, etc look off-center)
   update_camera( dt );
+  if ( is_headless() ) return;
 
   // re-populate the z-order queue with the latest entity/component data
   refresh_z_order_queue();
@@ -142,22 +147,25 @@ void RenderGameSystem::render_game( sf::Time dt, RenderOverlaySystem &render_ove
       auto *new_angle_cmp = reg().try_get<Cmp::AbsoluteRotation>( entity );
       if ( new_angle_cmp ) new_angle_value = sf::degrees( new_angle_cmp->getAngle() );
 
-      safe_render_sprite_world( anim_cmp.m_sprite_type, pos_cmp, anim_cmp.getFrameIndexOffset() + anim_cmp.m_current_frame, { 1.f, 1.f }, alpha_value,
-                                new_origin_value, new_angle_value );
+      batch_sprite_world( m_sprite_batch, anim_cmp.m_sprite_type, pos_cmp, anim_cmp.getFrameIndexOffset() + anim_cmp.m_current_frame, { 1.f, 1.f },
+                          alpha_value, new_origin_value, new_angle_value );
 
       if ( reg().any_of<Cmp::SeeingStone>( entity ) )
       {
+        flush_sprite_batch( m_sprite_batch );
         const auto &stone_cmp = reg().get<Cmp::SeeingStone>( entity );
         render_seeingstone_doglegs( stone_cmp, pos_cmp );
       }
 
       if ( reg().any_of<Cmp::InventoryWearLevel>( entity ) )
       {
+        flush_sprite_batch( m_sprite_batch );
         render_overlay_sys.render_wear_level( reg().get<Cmp::InventoryWearLevel>( entity ).m_level, pos_cmp );
       }
     }
     else if ( reg().all_of<ParticleSpriteOwner>( entity ) )
     {
+      flush_sprite_batch( m_sprite_batch );
       auto &particle_sprite_owner = reg().get<ParticleSpriteOwner>( entity );
       // pass the world view so the sprite can map world coords to screen coords
       particle_sprite_owner.sprite->set_view_transform( m_window, s_world_view );
@@ -167,12 +175,13 @@ void RenderGameSystem::render_game( sf::Time dt, RenderOverlaySystem &render_ove
     {
       auto &shader_sprite_owner = reg().get<ShaderSpriteOwner>( entity );
       if ( not shader_sprite_owner.sprite ) continue;
+      flush_sprite_batch( m_sprite_batch );
       shader_sprite_owner.sprite->update( reg() );
       if ( m_shaders_enabled ) { draw_world( *shader_sprite_owner.sprite ); }
     }
     else if ( reg().all_of<Sprites::Containers::TileMap>( entity ) )
     {
-
+      flush_sprite_batch( m_sprite_batch );
       auto &floor_tiles = reg().get<Sprites::Containers::TileMap>( entity );
       sf::Vector2f adjusted{ static_cast<float>( floor_tiles.world_grid_offset.x ) * Constants::kGridSizePxF.x,
                              static_cast<float>( floor_tiles.world_grid_offset.y ) * Constants::kGridSizePxF.y };
@@ -180,6 +189,7 @@ void RenderGameSystem::render_game( sf::Time dt, RenderOverlaySystem &render_ove
       draw_world( floor_tiles );
     }
   }
+  flush_sprite_batch( m_sprite_batch );
 
   // finally render anything on top
   render_armed();
@@ -245,23 +255,26 @@ void RenderGameSystem::render_game( sf::Time dt, RenderOverlaySystem &render_ove
     for ( auto [npc_entt, npc_cmp, npc_pos_cmp, anim_cmp] : reg().view<Cmp::NPC, Cmp::Position, Cmp::SpriteAnimation>().each() )
     {
       auto query_compass = PathFinding::QueryCompass::CARDINAL;
-      if ( anim_cmp.m_sprite_type.contains( "sprite.ghost" ) ) query_compass = PathFinding::QueryCompass::BOTH;
+      if ( anim_cmp.m_sprite_type.is_a( Sprites::Type::kGhost ) ) query_compass = PathFinding::QueryCompass::BOTH;
       render_overlay_sys.render_spatial_grid_neighbours( npc_pos_cmp, sf::Color::Magenta, query_compass );
       render_overlay_sys.render_pathfinding_vector( npc_pos_cmp, player_pos_cmp, sf::Color::White, query_compass );
     }
   }
 
   // float start_y_pos = 0;
-  render_overlay_sys.render_ui_outlines();
-  render_overlay_sys.render_ui_icons();
-  render_overlay_sys.render_ui_inventory_icon();
-  render_overlay_sys.render_ui_meters();
-  render_overlay_sys.render_ui_labels( dt );
-  render_overlay_sys.render_ui_texts();
-  render_overlay_sys.render_level_depth();
-
-  auto display_size = Sys::PersistSystem::get<Cmp::Persist::DisplayResolution>( reg() );
-  render_overlay_sys.render_crypt_maze_timer( { static_cast<float>( display_size.x ) / 2.f, 0.f }, 100 );
+  {
+    PROFILE_ZONE( "RenderGameSystem::ui pass" );
+    render_overlay_sys.render_ui_outlines();
+    render_overlay_sys.render_ui_icons();
+    render_overlay_sys.render_ui_inventory_icon();
+    render_overlay_sys.render_ui_meters();
+    render_overlay_sys.render_ui_labels( dt );
+    render_overlay_sys.render_ui_texts();
+    render_overlay_sys.render_level_depth();
+
+    auto display_size = Sys::PersistSystem::get<Cmp::Persist::DisplayResolution>( reg() );
+    render_overlay_sys.render_crypt_maze_timer( { static_cast<float>( display_size.x ) / 2.f, 0.f }, 100 );
+  }
 
   if ( m_show_debug_stats )
   {
@@ -280,33 +293,40 @@ void RenderGameSystem::render_game( sf::Time dt, RenderOverlaySystem &render_ove
   // restart once after all debug blocks
   if ( debug_tick ) { m_debug_update_timer.restart(); }
 
-  m_window.display();
+  // the ImGui profiler panel has to be rendered before display()
+  if ( m_show_debug_stats ) { render_overlay_sys.render_ui_profiler( dt ); }
+
+  {
+    PROFILE_ZONE( "RenderGameSystem::display" );
+    m_window.display();
+  }
 }
 
 void RenderGameSystem::refresh_z_order_queue()
 {
+  PROFILE_ZONE( "RenderGameSystem::refresh_z_order_queue" );
   m_zorder_queue_.clear();
   sf::FloatRect view_bounds = Utils::calculate_view_bounds( s_world_view );
 
-  // prevent pop-in/pop-outs when multiblock entities are near the edge of the view
-  add_visible_entity_to_z_order_queue<Cmp::AltarMultiBlock>( m_zorder_queue_, view_bounds );
-  add_visible_entity_to_z_order_queue<Cmp::CryptMultiBlock>( m_zorder_queue_, view_bounds );
-  add_visible_entity_to_z_order_queue<Cmp::GraveMultiBlock>( m_zorder_queue_, view_bounds );
-  add_visible_entity_to_z_order_queue<Cmp::HolyWellMultiBlock>( m_zorder_queue_, view_bounds );
-  add_visible_entity_to_z_order_queue<Cmp::CryptInteriorMultiBlock>( m_zorder_queue_, view_bounds );
-  add_visible_entity_to_z_order_queue<Cmp::RuinBuildingMultiBlock>( m_zorder_queue_, view_bounds );
-
-  // add any floor tile sets
-  add_visible_entity_to_z_order_queue<Sprites::Containers::TileMap>( m_zorder_queue_, view_bounds );
+  auto &zorder_queue = ZOrderQueue::get( reg() );
+  zorder_queue.sync( reg() );
 
-  // add the wrapper types for all particle and shader sprites so they can be rendered with the other entities
-  add_visible_entity_to_z_order_queue<ParticleSpriteOwner>( m_zorder_queue_, view_bounds );
-  add_visible_entity_to_z_order_queue<ShaderSpriteOwner>( m_zorder_queue_, view_bounds );
+  for ( const auto &entry : zorder_queue.entries() )
+  {
+    // multiblocks are culled by their Position, which spans the whole multiblock, to prevent pop-in/pop-outs near the edge of the view
+    if ( const auto *pos_cmp = reg().try_get<Cmp::Position>( entry.e ) )
+    {
+      if ( not Utils::is_visible_in_view( view_bounds, *pos_cmp ) ) continue;
+    }
+    // floor tile sets and the wrapper types for all particle and shader sprites have no bounds, so are always queued
+    else if ( not reg().any_of<Sprites::Containers::TileMap, ParticleSpriteOwner, ShaderSpriteOwner>( entry.e ) ) { continue; }
 
-  // add other components as normal
-  add_visible_entity_to_z_order_queue<Cmp::Position>( m_zorder_queue_, view_bounds );
+    // catch any z-order that was changed in place without a patch() signal; it gets re-sorted next frame
+    const float z = reg().get<Cmp::ZOrderValue>( entry.e ).getZOrder();
+    if ( z != entry.z ) zorder_queue.mark_dirty( entry.e );
 
-  std::ranges::sort( m_zorder_queue_, []( const ZOrder &a, const ZOrder &b ) { return a.z < b.z; } );
+    m_zorder_queue_.push_back( ZOrder{ entry.z, entry.e } );
+  }
 }
 
 void RenderGameSystem::init_world_view()
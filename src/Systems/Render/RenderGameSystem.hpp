@@ -6,6 +6,7 @@
 #include <Persistent/DisplayResolution.hpp>
 
 #include <Systems/Render/RenderSystem.hpp>
+#include <Systems/Render/SpriteBatch.hpp>
 #include <Utils/Constants.hpp>
 #include <Utils/Optimizations.hpp>
 
@@ -96,33 +97,6 @@ private:
   //! @param color
   void render_screen_flash( sf::Color color );
 
-  //! @brief Adds visible entities of a specific component type to the Z-order queue
-  //! Optimized (single-type view) query on entt components for visibility check and Z-order queue
-  //! addition
-  //! @note The Component-owning entity must also have a Cmp::ZOrderValue component to be added to
-  //! the queue
-  //! @tparam Component The component type to check for visibility
-  //! @param zorder_queue The Z-order queue to add visible entities to
-  //! @param view_bounds The view bounds to check against
-  template <typename Component>
-  void add_visible_entity_to_z_order_queue( std::vector<ZOrder> &zorder_queue, sf::FloatRect view_bounds )
-  {
-    for ( auto [entity, component] : reg().view<Component>().each() )
-    {
-      if constexpr ( std::is_base_of_v<sf::FloatRect, Component> )
-      {
-        if ( not Utils::is_visible_in_view( view_bounds, component ) ) continue;
-      }
-      if constexpr ( std::is_base_of_v<Cmp::Particle::IParticleSprite, Component> )
-      {
-        if ( not Utils::is_visible_in_view( view_bounds, { component.get_emitter_position(), Constants::kGridSizePxF } ) ) continue;
-      }
-
-      auto z_order_cmp = reg().try_get<Cmp::ZOrderValue>( entity );
-      if ( z_order_cmp ) { zorder_queue.push_back( ZOrder{ z_order_cmp->getZOrder(), entity } ); }
-    }
-  }
-
   //! @brief event handlers for pausing system clocks
   void on_pause() override {}
   //! @brief event handlers for resuming system clocks
@@ -139,9 +113,12 @@ private:
   float m_compass_min_scale{ 0.5f };
   float m_compass_max_scale{ 1.5f };
 
-  //! @brief The z-order queue for rendering
-  //! Each frame, this queue is refreshed to ensure correct rendering order
+  //! @brief The visible subset of ZOrderQueue for rendering
+  //! Each frame, this queue is refreshed from the (already sorted) ZOrderQueue of the current registry
   std::vector<ZOrder> m_zorder_queue_;
+
+  //! @brief Batches consecutive z-ordered sprites that share an atlas page into a single draw call
+  SpriteBatch m_sprite_batch;
 };
 
 } // namespace ProceduralMaze::Sys
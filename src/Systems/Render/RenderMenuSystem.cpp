@@ -73,6 +73,8 @@ RenderMenuSystem::~RenderMenuSystem() = default;
 
 void RenderMenuSystem::render_title()
 {
+  if ( is_headless() ) return;
+
   // main render begin
   m_window.clear();
   {
@@ -109,6 +111,8 @@ void RenderMenuSystem::render_title()
 
 void RenderMenuSystem::render_settings( sf::Time globalDeltaTime )
 {
+  if ( is_headless() ) return;
+
   m_window.clear();
   sf::Vector2u display_size = Sys::PersistSystem::get<Cmp::Persist::DisplayResolution>( reg() );
   sf::Text title_text( m_font, "Settings", display_size.x / 20 );
@@ -268,6 +272,8 @@ void RenderMenuSystem::render_settings_widgets( sf::Time globalDeltaTime, sf::Fl
 
 void RenderMenuSystem::render_paused( sf::Time globalDeltaTime )
 {
+  if ( is_headless() ) return;
+
   // main render begin
   m_window.clear();
 
@@ -301,6 +307,8 @@ void RenderMenuSystem::render_paused( sf::Time globalDeltaTime )
 
 void RenderMenuSystem::render_defeat_screen()
 {
+  if ( is_headless() ) return;
+
   // main render begin
   m_window.clear();
   {
@@ -324,6 +332,8 @@ void RenderMenuSystem::render_defeat_screen()
 
 void RenderMenuSystem::render_victory_screen( bool allow_continue )
 {
+  if ( is_headless() ) return;
+
   // main render begin
   m_window.clear();
 
@@ -15,6 +15,7 @@
 #include <Components/SpriteAnimation.hpp>
 #include <Components/ZOrderValue.hpp>
 #include <Constants.hpp>
+#include <Debug/Profiler.hpp>
 #include <Inventory/FlashUICadaver.hpp>
 #include <Inventory/FlashUIInventory.hpp>
 #include <Inventory/FlashUIRadius.hpp>
@@ -41,7 +42,10 @@
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/System/Vector2.hpp>
+#include <imgui-SFML.h>
+#include <imgui.h>
 
+#include <algorithm>
 #include <iomanip>
 #include <ranges>
 #include <sstream>
@@ -605,6 +609,85 @@ void RenderOverlaySystem::render_ui_npc_list()
   }
 }
 
+void RenderOverlaySystem::render_ui_profiler( sf::Time dt )
+{
+  using Debug::Profiler;
+
+  // need to make sure we call Update() and Render() every frame the panel is shown
+  ImGui::SFML::Update( m_window, dt );
+  ImGui::SetNextWindowPos( ImVec2( 10.f, 10.f ), ImGuiCond_FirstUseEver );
+  ImGui::SetNextWindowSize( ImVec2( 560.f, 480.f ), ImGuiCond_FirstUseEver );
+  ImGui::Begin( "Profiler" );
+
+  const auto &history = Profiler::frame_history();
+  if ( not history.empty() )
+  {
+    const float worst_ms = *std::ranges::max_element( history );
+    ImGui::Text( "Frame %.2f ms (worst %.2f ms)", history.back(), worst_ms );
+    ImGui::PlotLines( "##frame_ms", history.data(), static_cast<int>( history.size() ), 0, nullptr, 0.f, std::max( worst_ms, 1.f ),
+                      ImVec2( -1.f, 60.f ) );
+  }
+
+  if ( not Profiler::enabled() ) { ImGui::TextUnformatted( "Zones are compiled out. Configure with -DPROCEDURALMAZE_PROFILER=ON" ); }
+  else
+  {
+    if ( ImGui::Button( "Dump Chrome trace" ) ) { Profiler::dump_chrome_trace( "profile_trace.json" ); }
+
+    // flame graph of the last frame: one row per zone depth, width proportional to time
+    const auto &events = Profiler::last_frame_events();
+    const auto frame_ns = static_cast<float>( std::max<int64_t>( 1, Profiler::last_frame_end_ns() - Profiler::last_frame_start_ns() ) );
+    constexpr float kRowHeight = 18.f;
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    const float width = std::max( ImGui::GetContentRegionAvail().x, 1.f );
+    auto *draw_list = ImGui::GetWindowDrawList();
+    uint16_t max_depth = 0;
+    for ( const auto &event : events )
+    {
+      max_depth = std::max( max_depth, event.depth );
+      const ImVec2 min( origin.x + width * static_cast<float>( event.start_ns - Profiler::last_frame_start_ns() ) / frame_ns,
+                        origin.y + kRowHeight * event.depth );
+      const ImVec2 max( std::max( min.x + 1.f, origin.x + width * static_cast<float>( event.end_ns - Profiler::last_frame_start_ns() ) / frame_ns ),
+                        min.y + kRowHeight - 1.f );
+      const auto shade = static_cast<unsigned char>( 255 - std::min( event.depth * 24, 160 ) );
+      draw_list->AddRectFilled( min, max, IM_COL32( shade, shade / 2, 32, 255 ) );
+      if ( max.x - min.x > ImGui::CalcTextSize( event.name ).x + 4.f )
+      {
+        draw_list->AddText( ImVec2( min.x + 2.f, min.y + 2.f ), IM_COL32_WHITE, event.name );
+      }
+      if ( ImGui::IsMouseHoveringRect( min, max ) )
+      {
+        ImGui::SetTooltip( "%s: %.3f ms", event.name, static_cast<double>( event.end_ns - event.start_ns ) / 1e6 );
+      }
+    }
+    ImGui::Dummy( ImVec2( width, kRowHeight * ( events.empty() ? 1 : max_depth + 1 ) ) );
+
+    if ( ImGui::BeginTable( "profiler_zones", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY ) )
+    {
+      ImGui::TableSetupColumn( "Zone", ImGuiTableColumnFlags_WidthStretch );
+      ImGui::TableSetupColumn( "Calls", ImGuiTableColumnFlags_WidthFixed );
+      ImGui::TableSetupColumn( "Total ms", ImGuiTableColumnFlags_WidthFixed );
+      ImGui::TableSetupColumn( "Self ms", ImGuiTableColumnFlags_WidthFixed );
+      ImGui::TableHeadersRow();
+      for ( const auto &zone : Profiler::last_frame() )
+      {
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::Text( "%*s%s", zone.depth * 2, "", zone.name );
+        ImGui::TableNextColumn();
+        ImGui::Text( "%u", zone.calls );
+        ImGui::TableNextColumn();
+        ImGui::Text( "%.3f", zone.total_ms );
+        ImGui::TableNextColumn();
+        ImGui::Text( "%.3f", zone.self_ms );
+      }
+      ImGui::EndTable();
+    }
+  }
+
+  ImGui::End();
+  ImGui::SFML::Render( m_window );
+}
+
 void RenderOverlaySystem::render_lerp_positions()
 {
   auto lerp_view = reg().view<Cmp::LerpPosition, Cmp::Direction, Cmp::NPC, Cmp::Position>();
@@ -65,6 +65,8 @@ public:
   void render_ui_stats();
   void render_ui_zorder_list( std::vector<ZOrder> &zorder_queue );
   void render_ui_npc_list();
+  //! @brief ImGui panel with the frame-time graph, a flame graph and a timing table of the profiler zones of the last frame
+  void render_ui_profiler( sf::Time dt );
 
   void render_lerp_positions();
 
@@ -10,10 +10,12 @@
 #include <Systems/PersistSystem.hpp>
 #include <Systems/Render/RenderBuffer.hpp>
 #include <Systems/Render/RenderSystem.hpp>
+#include <Systems/Render/SpriteBatch.hpp>
 #include <Utils/Constants.hpp>
 
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/Transformable.hpp>
 #include <entt/entity/fwd.hpp>
 #include <imgui-SFML.h>
 
@@ -61,7 +63,7 @@ void RenderSystem::render_text( std::string text, unsigned int size, sf::Vector2
   m_window.draw( title_text );
 }
 
-void RenderSystem::safe_render_sprite_to_target( sf::RenderTarget &target, const std::string &sprite_type, const sf::FloatRect &pos_cmp,
+void RenderSystem::safe_render_sprite_to_target( sf::RenderTarget &target, const Sprites::SpriteMetaType &sprite_type, const sf::FloatRect &pos_cmp,
                                                  std::size_t sprite_index, sf::Vector2f scale, uint8_t alpha, sf::Vector2f origin, sf::Angle angle )
 {
 
@@ -114,7 +116,7 @@ void RenderSystem::render_fallback_square_to_target( sf::RenderTarget &target, c
 }
 
 // Keep the original for backwards compatibility
-void RenderSystem::safe_render_sprite_world( const std::string &sprite_type, const sf::FloatRect &pos_cmp, std::size_t sprite_index,
+void RenderSystem::safe_render_sprite_world( const Sprites::SpriteMetaType &sprite_type, const sf::FloatRect &pos_cmp, std::size_t sprite_index,
                                              sf::Vector2f scale, uint8_t alpha, sf::Vector2f origin, sf::Angle angle )
 {
   const sf::View previous_view = m_window.getView();
@@ -123,7 +125,7 @@ void RenderSystem::safe_render_sprite_world( const std::string &sprite_type, con
   m_window.setView( previous_view );
 }
 
-void RenderSystem::safe_render_sprite_screen( const std::string &sprite_type, const sf::FloatRect &pos_cmp, std::size_t sprite_index,
+void RenderSystem::safe_render_sprite_screen( const Sprites::SpriteMetaType &sprite_type, const sf::FloatRect &pos_cmp, std::size_t sprite_index,
                                               sf::Vector2f scale, uint8_t alpha, sf::Vector2f origin, sf::Angle angle )
 {
   const sf::View previous_view = m_window.getView();
@@ -132,6 +134,39 @@ void RenderSystem::safe_render_sprite_screen( const std::string &sprite_type, co
   m_window.setView( previous_view );
 }
 
+void RenderSystem::batch_sprite_world( SpriteBatch &batch, const Sprites::SpriteMetaType &sprite_type, const sf::FloatRect &pos_cmp,
+                                       std::size_t sprite_index, sf::Vector2f scale, uint8_t alpha, sf::Vector2f origin, sf::Angle angle )
+{
+  auto &sprite = m_sprite_factory.get_multisprite_by_type( sprite_type );
+  if ( sprite_index >= sprite.get_sprite_count() )
+  {
+    SPDLOG_WARN( "Unable to get idx: {}. {} has sprite count = {}", sprite_index, sprite_type, sprite.get_sprite_count() );
+    flush_sprite_batch( batch );
+    render_fallback_square_world( pos_cmp, sf::Color::Cyan );
+    return;
+  }
+
+  // same transform as the RenderBuffer used by safe_render_sprite_to_target()
+  sf::Transformable transformable;
+  sf::Vector2f adjusted_position = pos_cmp.position;
+  if ( origin != sf::Vector2f( 0.f, 0.f ) ) { adjusted_position += origin; }
+  transformable.setPosition( adjusted_position );
+  transformable.setScale( scale );
+  transformable.setOrigin( origin );
+  transformable.setRotation( angle );
+
+  const auto &texture = sprite.get_texture();
+  if ( batch.needs_flush( texture ) ) { flush_sprite_batch( batch ); }
+  batch.add( sprite.m_va_list[sprite_index], texture, transformable.getTransform(), alpha );
+}
+
+void RenderSystem::flush_sprite_batch( SpriteBatch &batch )
+{
+  if ( batch.empty() ) return;
+  draw_world( batch );
+  batch.clear();
+}
+
 void RenderSystem::render_fallback_square_world( const sf::FloatRect &pos_cmp, const sf::Color &color )
 {
   const sf::View previous_view = m_window.getView();
@@ -169,5 +204,6 @@ void RenderSystem::draw_world( const sf::Drawable &drawable )
 }
 
 sf::View RenderSystem::s_world_view{};
+bool RenderSystem::s_headless{ false };
 
 } // namespace ProceduralMaze::Sys
@@ -27,6 +27,8 @@ class RectBounds;
 namespace ProceduralMaze::Sys
 {
 
+class SpriteBatch;
+
 class RenderSystem : public BaseSystem
 {
 public:
@@ -46,6 +48,15 @@ public:
   //! @return const sf::View&
   static const sf::View &get_world_view() { return s_world_view; }
 
+  //! @brief In a headless run (see Engine) the render systems still move the camera but skip every draw call, and no
+  //! font, tileset texture or shader is created
+  static void set_headless( bool headless ) { s_headless = headless; }
+  static bool is_headless() { return s_headless; }
+
+  //! @brief Dimension for `s_world_view`.
+  constexpr static sf::Vector2u kWorldViewSize{ 300u, 200u };
+  constexpr static sf::Vector2f kWorldViewSizeF{ static_cast<float>( kWorldViewSize.x ), static_cast<float>( kWorldViewSize.y ) };
+
   //! @brief Get the screen resolution view. See Cmp::Persist::DisplayResolution.
   //! @return const sf::View&
   const sf::View &get_screen_view() { return m_window.getDefaultView(); }
@@ -82,12 +93,11 @@ protected:
   //! @brief Current view of the game world.
   static sf::View s_world_view;
 
-  //! @brief Dimension for `s_world_view`.
-  constexpr static sf::Vector2u kWorldViewSize{ 300u, 200u };
-  constexpr static sf::Vector2f kWorldViewSizeF{ static_cast<float>( kWorldViewSize.x ), static_cast<float>( kWorldViewSize.y ) };
+  //! @brief See RenderSystem::set_headless()
+  static bool s_headless;
 
-  //! @brief Default font for rendering text
-  Cmp::Font m_font = Cmp::Font( "res/fonts/tuffy.ttf" );
+  //! @brief Default font for rendering text. Left unopened in a headless run.
+  Cmp::Font m_font = is_headless() ? Cmp::Font() : Cmp::Font( "res/fonts/tuffy.ttf" );
 
   // System mode flags
   bool m_show_path_finding{ false };
@@ -112,7 +122,7 @@ protected:
                     sf::Color fill_color = sf::Color::White, sf::Color outline_color = sf::Color::Transparent );
 
   // Variant that renders to a specific render target (shader, texture, etc.)
-  void safe_render_sprite_to_target( sf::RenderTarget &target, const std::string &sprite_type, const sf::FloatRect &pos_cmp,
+  void safe_render_sprite_to_target( sf::RenderTarget &target, const Sprites::SpriteMetaType &sprite_type, const sf::FloatRect &pos_cmp,
                                      std::size_t sprite_index = 0, sf::Vector2f scale = { 1.f, 1.f }, uint8_t alpha = 255,
                                      sf::Vector2f origin = { 0.f, 0.f }, sf::Angle angle = sf::degrees( 0.f ) );
 
@@ -120,14 +130,24 @@ protected:
   void render_fallback_square_to_target( sf::RenderTarget &target, const sf::FloatRect &pos_cmp, const sf::Color &color = sf::Color::Magenta );
 
   // Safe sprite accessor that renders a fallback square if sprite is missing
-  void safe_render_sprite_screen( const std::string &sprite_type, const sf::FloatRect &position, std::size_t sprite_index = 0,
+  void safe_render_sprite_screen( const Sprites::SpriteMetaType &sprite_type, const sf::FloatRect &position, std::size_t sprite_index = 0,
                                   sf::Vector2f scale = { 1.f, 1.f }, uint8_t alpha = 255, sf::Vector2f origin = { 0.f, 0.f },
                                   sf::Angle angle = sf::degrees( 0.f ) );
 
-  void safe_render_sprite_world( const std::string &sprite_type, const sf::FloatRect &position, std::size_t sprite_index = 0,
+  void safe_render_sprite_world( const Sprites::SpriteMetaType &sprite_type, const sf::FloatRect &position, std::size_t sprite_index = 0,
                                  sf::Vector2f scale = { 1.f, 1.f }, uint8_t alpha = 255, sf::Vector2f origin = { 0.f, 0.f },
                                  sf::Angle angle = sf::degrees( 0.f ) );
 
+  //! @brief Batched equivalent of `safe_render_sprite_world()`: appends the sprite to `batch` in world coordinates, drawing the
+  //! batch first if the sprite uses a different texture. Missing sprites flush the batch and render a fallback square.
+  void batch_sprite_world( SpriteBatch &batch, const Sprites::SpriteMetaType &sprite_type, const sf::FloatRect &position,
+                           std::size_t sprite_index = 0, sf::Vector2f scale = { 1.f, 1.f }, uint8_t alpha = 255,
+                           sf::Vector2f origin = { 0.f, 0.f }, sf::Angle angle = sf::degrees( 0.f ) );
+
+  //! @brief Draw any batched sprites in world view coordinates and empty the batch.
+  //! Call this before drawing anything that must appear on top of the sprites batched so far.
+  void flush_sprite_batch( SpriteBatch &batch );
+
   // Fallback rendering for missing sprites
   void render_fallback_square_world( const sf::FloatRect &pos_cmp, const sf::Color &color = sf::Color::Magenta );
 
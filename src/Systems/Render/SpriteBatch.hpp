@@ -0,0 +1,66 @@
+#ifndef SRC_SYSTEMS_RENDER_SPRITEBATCH_HPP_
+#define SRC_SYSTEMS_RENDER_SPRITEBATCH_HPP_
+
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace ProceduralMaze::Sys {
+
+//! @brief Collects pre-transformed sprite triangles that share a texture (i.e. an atlas page) so they can be drawn with one draw call.
+//! @note The caller owns the batch boundaries: call `needs_flush()` before `add()`, and draw + `clear()` the batch whenever
+//!       something else must be drawn in between to preserve z-order. Vertex storage is kept between frames.
+class SpriteBatch : public sf::Drawable
+{
+public:
+  //! @brief Would adding a sprite using `texture` require the current batch to be drawn first?
+  bool needs_flush( const sf::Texture &texture ) const { return not m_vertices.empty() && m_texture != &texture; }
+
+  //! @brief Append a copy of `vertices` in world space
+  //! @param vertices Local space sprite geometry, i.e. an item from MultiSprite::m_va_list
+  //! @param texture Must match the texture of the sprites already in the batch, see `needs_flush()`
+  //! @param transform Local to world transform
+  //! @param alpha The alpha value to set on each vertex (0-255)
+  void add( const sf::VertexArray &vertices, const sf::Texture &texture, const sf::Transform &transform, uint8_t alpha )
+  {
+    m_texture = &texture;
+    for ( std::size_t idx = 0; idx < vertices.getVertexCount(); ++idx )
+    {
+      sf::Vertex vertex = vertices[idx];
+      vertex.position = transform.transformPoint( vertex.position );
+      vertex.color.a = alpha;
+      m_vertices.push_back( vertex );
+    }
+  }
+
+  bool empty() const { return m_vertices.empty(); }
+
+  //! @brief Drop the batched geometry, keeping the allocated storage
+  void clear() { m_vertices.clear(); }
+
+  //! @brief Draw the batched geometry to the target
+  //! @param target The render target to draw to
+  //! @param states The render states to apply
+  void draw( sf::RenderTarget &target, sf::RenderStates states ) const override
+  {
+    if ( m_vertices.empty() ) return;
+    states.texture = m_texture;
+    target.draw( m_vertices.data(), m_vertices.size(), sf::PrimitiveType::Triangles, states );
+  }
+
+private:
+  //! @brief World space triangles for the current batch
+  std::vector<sf::Vertex> m_vertices;
+
+  //! @brief The texture shared by every sprite in the current batch
+  const sf::Texture *m_texture{ nullptr };
+};
+
+} // namespace ProceduralMaze::Sys
+
+#endif // SRC_SYSTEMS_RENDER_SPRITEBATCH_HPP_
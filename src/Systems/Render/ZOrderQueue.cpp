@@ -0,0 +1,118 @@
+#include <Components/ZOrderValue.hpp>
+#include <Systems/Render/ZOrderQueue.hpp>
+
+#include <algorithm>
+#include <unordered_set>
+
+namespace ProceduralMaze::Sys
+{
+
+namespace
+{
+
+bool entry_less( const ZOrderQueue::Entry &lhs, const ZOrderQueue::Entry &rhs )
+{
+  if ( lhs.z != rhs.z ) return lhs.z < rhs.z;
+  return lhs.e < rhs.e;
+}
+
+} // namespace
+
+ZOrderQueue &ZOrderQueue::get( entt::registry &reg )
+{
+  if ( auto *queue = reg.ctx().find<ZOrderQueue>() ) return *queue;
+  auto &queue = reg.ctx().emplace<ZOrderQueue>();
+
+  reg.on_construct<Cmp::ZOrderValue>().connect<&ZOrderQueue::on_change>();
+  reg.on_update<Cmp::ZOrderValue>().connect<&ZOrderQueue::on_change>();
+  reg.on_destroy<Cmp::ZOrderValue>().connect<&ZOrderQueue::on_change>();
+  for ( auto [entt, zorder_cmp] : reg.view<Cmp::ZOrderValue>().each() )
+    queue.mark_dirty( entt );
+  queue.sync( reg );
+  return queue;
+}
+
+void ZOrderQueue::sync( entt::registry &reg )
+{
+  if ( m_dirty.empty() ) return;
+
+  if ( m_dirty.size() > kMergeThreshold ) { sync_all( reg ); }
+  else
+  {
+    for ( auto entt : m_dirty )
+      sync_one( reg, entt );
+  }
+  m_dirty.clear();
+}
+
+void ZOrderQueue::sync_one( entt::registry &reg, entt::entity entt )
+{
+  const auto *zorder_cmp = reg.valid( entt ) ? reg.try_get<Cmp::ZOrderValue>( entt ) : nullptr;
+  auto sorted_it = m_sorted_z.find( entt );
+
+  if ( not zorder_cmp )
+  {
+    if ( sorted_it == m_sorted_z.end() ) return;
+    if ( auto it = find( entt, sorted_it->second ); it != m_entries.end() ) m_entries.erase( it );
+    m_sorted_z.erase( sorted_it );
+    return;
+  }
+
+  const Entry entry{ zorder_cmp->getZOrder(), entt };
+  if ( sorted_it == m_sorted_z.end() )
+  {
+    m_entries.insert( std::ranges::lower_bound( m_entries, entry, entry_less ), entry );
+    m_sorted_z.emplace( entt, entry.z );
+    return;
+  }
+  if ( sorted_it->second == entry.z ) return;
+
+  // z-orders drift a little each frame, so shuffling the neighbours along by one is cheaper than erase + insert
+  auto it = find( entt, sorted_it->second );
+  if ( it == m_entries.end() ) return;
+  auto target = std::ranges::lower_bound( m_entries, entry, entry_less );
+  if ( target > it )
+  {
+    std::rotate( it, it + 1, target );
+    *( target - 1 ) = entry;
+  }
+  else
+  {
+    std::rotate( target, it, it + 1 );
+    *target = entry;
+  }
+  sorted_it->second = entry.z;
+}
+
+void ZOrderQueue::sync_all( entt::registry &reg )
+{
+  std::unordered_set<entt::entity> dirty( m_dirty.begin(), m_dirty.end() );
+  std::erase_if( m_entries, [&]( const Entry &entry ) { return dirty.contains( entry.e ); } );
+
+  const auto sorted_count = static_cast<std::ptrdiff_t>( m_entries.size() );
+  for ( auto entt : dirty )
+  {
+    const auto *zorder_cmp = reg.valid( entt ) ? reg.try_get<Cmp::ZOrderValue>( entt ) : nullptr;
+    if ( not zorder_cmp )
+    {
+      m_sorted_z.erase( entt );
+      continue;
+    }
+    m_entries.push_back( Entry{ zorder_cmp->getZOrder(), entt } );
+    m_sorted_z.insert_or_assign( entt, zorder_cmp->getZOrder() );
+  }
+
+  auto middle = m_entries.begin() + sorted_count;
+  std::sort( middle, m_entries.end(), entry_less );
+  std::inplace_merge( m_entries.begin(), middle, m_entries.end(), entry_less );
+}
+
+std::vector<ZOrderQueue::Entry>::iterator ZOrderQueue::find( entt::entity entt, float z )
+{
+  const Entry key{ z, entt };
+  auto it = std::ranges::lower_bound( m_entries, key, entry_less );
+  if ( it == m_entries.end() || it->e != entt || it->z != z ) return m_entries.end();
+  return it;
+}
+
+} // namespace ProceduralMaze::Sys
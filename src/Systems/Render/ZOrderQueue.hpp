@@ -0,0 +1,65 @@
+#ifndef SRC_SYSTEMS_RENDER_ZORDERQUEUE_HPP_
+#define SRC_SYSTEMS_RENDER_ZORDERQUEUE_HPP_
+
+#include <entt/entity/registry.hpp>
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+namespace ProceduralMaze::Sys {
+
+//! @brief Every entity with a Cmp::ZOrderValue, kept sorted by z-order across frames.
+//! One instance lives in the registry context. Construct/update/destroy signals on Cmp::ZOrderValue queue entities for `sync()`,
+//! which only moves the entries that changed, so static scenery costs nothing once it is sorted.
+//! @note Use `registry.patch<Cmp::ZOrderValue>()` when changing the z-order of an existing entity. Changes made in place are
+//!       only noticed when the caller reports them via `mark_dirty()`.
+class ZOrderQueue
+{
+public:
+  struct Entry
+  {
+    float z;
+    entt::entity e;
+  };
+
+  //! @brief Get the queue for `reg`, creating and populating it on first use
+  static ZOrderQueue &get( entt::registry &reg );
+
+  //! @brief Re-sort the entries queued by signals or `mark_dirty()` since the last call
+  void sync( entt::registry &reg );
+
+  //! @brief All z-ordered entities, lowest z-order first. Ties are ordered by entity.
+  const std::vector<Entry> &entries() const { return m_entries; }
+
+  //! @brief Queue `entt` to be re-sorted by the next `sync()`
+  void mark_dirty( entt::entity entt ) { m_dirty.push_back( entt ); }
+
+private:
+  //! @brief Above this many pending changes, `sync()` rebuilds with a sort + merge instead of moving entries one at a time
+  static constexpr std::size_t kMergeThreshold = 64;
+
+  //! @brief sorted by z, then entity
+  std::vector<Entry> m_entries;
+
+  //! @brief the z-order each queued entity is currently sorted under, used to find its entry
+  std::unordered_map<entt::entity, float> m_sorted_z;
+
+  //! @brief entities constructed, updated or destroyed since the last `sync()`
+  std::vector<entt::entity> m_dirty;
+
+  //! @brief Move a single entity to its new place in `m_entries` (or add/drop it)
+  void sync_one( entt::registry &reg, entt::entity entt );
+
+  //! @brief Drop all dirty entities, then sort and merge the survivors back in
+  void sync_all( entt::registry &reg );
+
+  //! @return std::vector<Entry>::iterator the entry for `entt` sorted under `z`, or end()
+  std::vector<Entry>::iterator find( entt::entity entt, float z );
+
+  static void on_change( entt::registry &reg, entt::entity entt ) { reg.ctx().get<ZOrderQueue>().mark_dirty( entt ); }
+};
+
+} // namespace ProceduralMaze::Sys
+
+#endif // SRC_SYSTEMS_RENDER_ZORDERQUEUE_HPP_
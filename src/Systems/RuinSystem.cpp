@@ -1,5 +1,6 @@
 #include <Events/DropInventoryEvent.hpp>
 #include <Exit.hpp>
+#include <Sprites/SpriteTypes.hpp>
 #include <Stats/BaseAction.hpp>
 #include <Stats/CollisionAction.hpp>
 #include <System.hpp>
@@ -8,6 +9,7 @@
 #include <typeindex>
 #define SPDLOG_ACTIVE_LEVEL SPDLOG_LEVEL_INFO
 
+#include <Audio/Effects.hpp>
 #include <Audio/SoundBank.hpp>
 #include <Components/Inventory/InventoryItem.hpp>
 #include <Components/Npc/Npc.hpp>
@@ -346,7 +348,7 @@ void RuinSystem::creaking_rope_update()
   float stereo_pan_value = std::sin( t * m_creaking_rope_swing_freq * std::numbers::pi );
 
   // SPDLOG_INFO( "creaking_rope_update: {}", stereo_pan_value );
-  m_sound_bank.get_music( "ruin_creaking_rope" ).setPan( stereo_pan_value );
+  m_sound_bank.set_music_pan( "ruin_creaking_rope", stereo_pan_value );
 }
 
 bool RuinSystem::check_activate_player_curse( sf::Vector2f scene_dimensions )
@@ -361,14 +363,11 @@ bool RuinSystem::check_activate_player_curse( sf::Vector2f scene_dimensions )
   {
     if ( not m_curse_activation_future.valid() )
     {
-      m_sound_bank.get_music( "ruin_creaking_rope" ).stop();
-      m_sound_bank.get_music( "ruin_music" ).stop();
+      m_sound_bank.stop_music( "ruin_creaking_rope" );
+      m_sound_bank.stop_music( "ruin_music" );
 
-      if ( m_sound_bank.get_effect( "witch_scream" ).getStatus() != sf::Sound::Status::Playing ) { m_sound_bank.get_effect( "witch_scream" ).play(); }
-      if ( m_sound_bank.get_effect( "banging_smashing_sounds" ).getStatus() != sf::Sound::Status::Playing )
-      {
-        m_sound_bank.get_effect( "banging_smashing_sounds" ).play();
-      }
+      m_sound_bank.play_once( Audio::Effect::kWitchScream );
+      m_sound_bank.play_once( Audio::Effect::kBangingSmashingSounds );
       player_curse.active = true; // prevent the active curse from being re-activated
 
       Factory::create_shadow_hand( m_reg, scene_dimensions, hand_ms );
@@ -454,7 +453,7 @@ void RuinSystem::check_create_witch( entt::registry &reg, sf::FloatRect scene_di
   bool witch_exists = false;
   for ( auto [npc_entt, npc_cmp, npc_sprite_cmp] : reg.view<Cmp::NPC, Cmp::SpriteAnimation>().each() )
   {
-    if ( npc_sprite_cmp.m_sprite_type == "sprite.witch" ) { witch_exists = true; }
+    if ( npc_sprite_cmp.m_sprite_type == Sprites::Type::kWitch ) { witch_exists = true; }
   }
   if ( not witch_exists )
   {
@@ -6,6 +6,7 @@
 #include <SFML/Graphics/Rect.hpp>
 #include <SpatialHashGrid.hpp>
 #include <Systems/BaseSystem.hpp>
+#include <Utils/GameClock.hpp>
 
 #include <Sprites/SpriteMetaType.hpp>
 #include <future>
@@ -83,13 +84,13 @@ private:
   entt::dispatcher &m_scenemanager_event_dispatcher;
 
   //! @brief Cooldown clock to prevent immediate floor access re-triggering
-  sf::Clock m_floor_access_cooldown{};
+  Utils::GameClock m_floor_access_cooldown{};
   static constexpr float kFloorAccessCooldownSeconds = 0.5f;
 
   //! @brief Track if player was on floor access last frame (requires leaving before re-triggering)
   bool m_was_on_floor_access{ false };
 
-  sf::Clock m_creaking_rope_swing_timer{};
+  Utils::GameClock m_creaking_rope_swing_timer{};
   std::future<void> m_curse_activation_future;
 
   PathFinding::SpatialHashGridWeakPtr m_pathfinding_navmesh;
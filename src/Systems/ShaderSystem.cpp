@@ -1,4 +1,6 @@
+#include <Debug/Profiler.hpp>
 #include <Shaders/IShaderSprite.hpp>
+#include <Systems/Render/RenderSystem.hpp>
 #include <Systems/ShaderSystem.hpp>
 
 namespace ProceduralMaze::Sys
@@ -24,6 +26,9 @@ std::vector<entt::entity> ShaderSystem::add_to_registry( ShaderSpriteOwner owner
 
 void ShaderSystem::update()
 {
+  PROFILE_ZONE( "ShaderSystem::update" );
+  // the shader sprites only draw into their own render textures
+  if ( RenderSystem::is_headless() ) return;
   for ( auto [entt, owner] : reg().view<ShaderSpriteOwner>().each() )
   {
     owner.sprite->update( reg() );
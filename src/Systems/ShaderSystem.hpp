@@ -7,8 +7,9 @@
 namespace ProceduralMaze::Sys
 {
 
-//! @brief  This wraps ParticleSpriteBase<IParticle> so it can be emplaced/retrieved with the Entt registry as a single type.
-//!         ParticleSystem::find can retrieve ParticleSpriteBase<IParticle> via the specified `tag`
+//! @brief  This wraps IShaderSprite so it can be emplaced/retrieved with the Entt registry as a single type.
+//!         ShaderSystem::find can retrieve IShaderSprite via the specified `tag`. The pool-based particle sprites
+//!         (Cmp::Particle::ParticleSpriteBase) are not shaders: they are owned by ParticleSpriteOwner, see ParticleSystem.
 struct ShaderSpriteOwner
 {
   std::unique_ptr<Sprites::IShaderSprite> sprite;
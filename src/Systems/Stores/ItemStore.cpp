@@ -77,4 +77,13 @@ void ItemStore::init_store()
   SPDLOG_INFO( "Item store loaded with {} items", m_store.size() );
 }
 
+std::string ItemStore::find_key( Sprites::SpriteMetaType sprite_type ) const
+{
+  for ( const auto &[item_key, item] : m_store )
+  {
+    if ( item.sprite_type == sprite_type ) return item_key;
+  }
+  return "";
+}
+
 } // namespace ProceduralMaze::Sys
\ No newline at end of file
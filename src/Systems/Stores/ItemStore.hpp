@@ -16,6 +16,9 @@ public:
 
   //! @brief Populates m_store with InventoryItem components
   void init_store();
+
+  //! @brief Key of the item drawn with `sprite_type`, or an empty string if no item uses it
+  std::string find_key( Sprites::SpriteMetaType sprite_type ) const;
 };
 
 } // namespace ProceduralMaze::Sys
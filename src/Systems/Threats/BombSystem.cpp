@@ -1,3 +1,4 @@
+#include <Audio/Effects.hpp>
 #include <Audio/SoundBank.hpp>
 #include <Components/Altar/AltarSegment.hpp>
 #include <Components/Armable.hpp>
@@ -24,6 +25,7 @@
 #include <Components/ReservedPosition.hpp>
 #include <Components/SpriteAnimation.hpp>
 #include <Components/ZOrderValue.hpp>
+#include <Debug/Profiler.hpp>
 #include <Events/PauseClocksEvent.hpp>
 #include <Events/PlayerMortalityEvent.hpp>
 #include <Events/ResumeClocksEvent.hpp>
@@ -35,6 +37,7 @@
 #include <PathFinding/SpatialHashGrid.hpp>
 #include <SFML/Graphics/Rect.hpp>
 #include <Sprites/SpriteFactory.hpp>
+#include <Sprites/SpriteTypes.hpp>
 #include <Systems/PersistSystem.hpp>
 #include <Systems/Threats/BombSystem.hpp>
 #include <Utils/Maths.hpp>
@@ -62,8 +65,8 @@ BombSystem::BombSystem( entt::registry &reg, sf::RenderWindow &window, Sprites::
 
 void BombSystem::on_pause()
 {
-  if ( m_sound_bank.get_effect( "bomb_fuse" ).getStatus() == sf::Sound::Status::Playing ) m_sound_bank.get_effect( "bomb_fuse" ).pause();
-  if ( m_sound_bank.get_effect( "bomb_detonate" ).getStatus() == sf::Sound::Status::Playing ) m_sound_bank.get_effect( "bomb_detonate" ).pause();
+  m_sound_bank.pause( Audio::Effect::kBombFuse );
+  m_sound_bank.pause( Audio::Effect::kBombDetonate );
   auto armed_view = reg().view<Cmp::Armed>();
   for ( auto [entt, armed_cmp] : armed_view.each() )
   {
@@ -73,8 +76,8 @@ void BombSystem::on_pause()
 }
 void BombSystem::on_resume()
 {
-  if ( m_sound_bank.get_effect( "bomb_fuse" ).getStatus() == sf::Sound::Status::Paused ) m_sound_bank.get_effect( "bomb_fuse" ).play();
-  if ( m_sound_bank.get_effect( "bomb_detonate" ).getStatus() == sf::Sound::Status::Paused ) m_sound_bank.get_effect( "bomb_detonate" ).play();
+  m_sound_bank.resume( Audio::Effect::kBombFuse );
+  m_sound_bank.resume( Audio::Effect::kBombDetonate );
   auto armed_view = reg().view<Cmp::Armed>();
   for ( auto [entt, armed_cmp] : armed_view.each() )
   {
@@ -92,7 +95,7 @@ void BombSystem::on_bomb_event( const Events::PlayerActionEvent &event )
 void BombSystem::arm_grave_bomb()
 {
   auto player_entt = Utils::Player::get_entity( reg() );
-  m_sound_bank.get_effect( "bomb_fuse" ).play();
+  m_sound_bank.restart( Audio::Effect::kBombFuse );
   place_concentric_bomb_pattern( player_entt, reg().get<Cmp::PlayerBlastRadius>( player_entt ).value );
 }
 
@@ -103,7 +106,7 @@ void BombSystem::arm_entt( entt::entity target_entt )
   // then use the candidate entity to place the booby trap bomb
   if ( target_entt != entt::null )
   {
-    m_sound_bank.get_effect( "bomb_fuse" ).play();
+    m_sound_bank.restart( Audio::Effect::kBombFuse );
 
     place_concentric_bomb_pattern( target_entt, reg().get<Cmp::PlayerBlastRadius>( player_entt ).value );
   }
@@ -131,7 +134,7 @@ void BombSystem::arm_player_bomb()
     // are we standing on a destructable tile?
     if ( player_hitbox.findIntersection( destructable_pos_cmp ) )
     {
-      m_sound_bank.get_effect( "bomb_fuse" ).play();
+      m_sound_bank.restart( Audio::Effect::kBombFuse );
 
       auto armed_epicenter_entity = reg().create();
       reg().emplace<Cmp::Position>( armed_epicenter_entity, destructable_pos_cmp.position, destructable_pos_cmp.size );
@@ -214,6 +217,7 @@ void BombSystem::place_concentric_bomb_pattern( const entt::entity &epicenter_en
 
 void BombSystem::update()
 {
+  PROFILE_ZONE( "BombSystem::update" );
 
   // remove any finished explosions
   for ( auto [death_entt, death_cmp, anim_cmp] : reg().view<Cmp::DeathPosition, Cmp::SpriteAnimation>().each() )
@@ -247,7 +251,7 @@ void BombSystem::update()
     {
       if ( not loot_pos_cmp.findIntersection( armed_pos_cmp ) ) continue;
 
-      if ( loot_entt != entt::null ) { m_sound_bank.get_effect( "break_pot" ).play(); }
+      if ( loot_entt != entt::null ) { m_sound_bank.play( Audio::Effect::kBreakPot ); }
 
       Factory::destroy_loot_container( reg(), loot_entt );
     }
@@ -320,7 +324,7 @@ void BombSystem::update()
     // Check if NPC was killed by explosion
     for ( auto [npc_entt, npc_cmp, npc_pos_cmp, npc_anim_cmp] : reg().view<Cmp::NPC, Cmp::Position, Cmp::SpriteAnimation>().each() )
     {
-      if ( npc_anim_cmp.m_sprite_type.contains( "sprite.ghost" ) ) continue;
+      if ( npc_anim_cmp.m_sprite_type.is_a( Sprites::Type::kGhost ) ) continue;
       // notify npc system of death
       if ( npc_pos_cmp.findIntersection( armed_pos_cmp ) )
       {
@@ -330,7 +334,7 @@ void BombSystem::update()
         Factory::destroy_npc( reg(), npc_entt );
 
         auto [sprite_type, sprite_index] = m_sprite_factory.get_random_type_and_texture_index(
-            std::vector<std::string>{ "sprite.graveyard.loot.health", "sprite.graveyard.loot.blast", "sprite.graveyard.loot.repair" } );
+            std::vector<Sprites::SpriteMetaType>{ "sprite.graveyard.loot.health", "sprite.graveyard.loot.blast", "sprite.graveyard.loot.repair" } );
 
         Cmp::RandomInt do_drop( 0, 2 ); // 1 in 3 chance of no drop
         if ( do_drop.gen() == 0 )
@@ -347,14 +351,14 @@ void BombSystem::update()
           if ( dropped_loot_entt != entt::null )
           {
             SPDLOG_INFO( "NPC dropped loot." );
-            m_sound_bank.get_effect( "drop_loot" ).play();
+            m_sound_bank.play( Audio::Effect::kDropLoot );
           }
         }
       }
     }
 
     // play sound effect if this armed component is epicenter
-    if ( armed_cmp.m_epicenter == Cmp::Armed::EpiCenter::YES ) { m_sound_bank.get_effect( "bomb_detonate" ).play(); }
+    if ( armed_cmp.m_epicenter == Cmp::Armed::EpiCenter::YES ) { m_sound_bank.play( Audio::Effect::kBombDetonate ); }
 
     // check if we have any epicenter armed components before stopping the fuse sound
     bool remaining_epicenter_bombs = false;
@@ -366,7 +370,7 @@ void BombSystem::update()
         break; // we dont care how many
       }
     }
-    if ( not remaining_epicenter_bombs ) m_sound_bank.get_effect( "bomb_fuse" ).stop();
+    if ( not remaining_epicenter_bombs ) m_sound_bank.stop( Audio::Effect::kBombFuse );
 
     // finally delete the armed component
     Factory::destroy_armed( reg(), armed_entt );
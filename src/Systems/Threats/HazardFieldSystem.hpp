@@ -4,7 +4,7 @@
 #include <Utils/Random.hpp>
 #include <entt/entity/fwd.hpp>
 
-#include <SFML/System/Clock.hpp>
+#include <Utils/GameClock.hpp>
 #include <SFML/System/Time.hpp>
 
 #include <Components/Hazard/CorruptionCell.hpp>
@@ -82,7 +82,7 @@ private:
 
   //! @brief Clock used to track time for hazard field updates.
   //!
-  sf::Clock m_spread_update_clock;
+  Utils::GameClock m_spread_update_clock;
 
   //! @brief Time period for updating hazard fields.
   //!
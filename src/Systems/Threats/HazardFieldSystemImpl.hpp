@@ -1,6 +1,7 @@
 #ifndef SRC_SYSTEMS_HAZARDFIELDSYSTEMIMPL_HPP__
 #define SRC_SYSTEMS_HAZARDFIELDSYSTEMIMPL_HPP__
 
+#include <Audio/Effects.hpp>
 #include <Audio/SoundBank.hpp>
 #include <Components/Exit.hpp>
 #include <Components/Npc/Npc.hpp>
@@ -12,6 +13,7 @@
 #include <Components/System.hpp>
 #include <Components/Wall.hpp>
 #include <Components/ZOrderValue.hpp>
+#include <Debug/Profiler.hpp>
 #include <Events/PauseClocksEvent.hpp>
 #include <Events/PlayerMortalityEvent.hpp>
 #include <Events/ResumeClocksEvent.hpp>
@@ -40,6 +42,7 @@ HazardFieldSystem<HazardType>::HazardFieldSystem( entt::registry &reg, sf::Rende
 template <ValidHazard HazardType>
 sf::Vector2f HazardFieldSystem<HazardType>::update()
 {
+  PROFILE_ZONE( "HazardFieldSystem::update" );
   sf::Vector2f add_hazard_cell;
   add_hazard_cell = update_hazard_field();
   check_npc_hazard_field_collision();
@@ -61,7 +64,7 @@ sf::Vector2f HazardFieldSystem<HazardType>::init_hazard_field()
   unsigned long seed = Sys::PersistSystem::get<typename Traits::SeedType>( reg() ).get_value();
   auto [random_entity, random_pos] = Utils::Rnd::get_random_position(
       reg(), Utils::Rnd::IncludePack<Cmp::Obstacle>{},
-      Utils::Rnd::ExcludePack<Cmp::Wall, Cmp::Exit, Cmp::PlayerCharacter, Cmp::NPC, Cmp::ReservedPosition>(), seed );
+      Utils::Rnd::ExcludePack<Cmp::Wall, Cmp::Exit, Cmp::PlayerCharacter, Cmp::NPC, Cmp::ReservedPosition>(), seed, Utils::Rnd::Stream::HAZARDS );
   if ( random_entity == entt::null ) { return {}; }
 
   Factory::remove_obstacle( reg(), random_entity );
@@ -95,7 +98,7 @@ sf::Vector2f HazardFieldSystem<HazardType>::update_hazard_field()
   auto hazard_view = reg().template view<HazardType, Cmp::Position>();
   auto obstacle_view = reg().template view<Cmp::Obstacle, Cmp::Position>( entt::exclude<Cmp::ReservedPosition> );
 
-  Cmp::RandomInt hazard_spread_picker( 0, Traits::odds ); // 1 in 8 chance for picking an adjacent obstacle
+  Cmp::RandomInt hazard_spread_picker( 0, Traits::odds, Utils::Rnd::Stream::HAZARDS ); // 1 in 8 chance for picking an adjacent obstacle
 
   for ( auto [hazard_entity, hazard_cmp, position_cmp] : hazard_view.each() )
   {
@@ -217,7 +220,7 @@ void HazardFieldSystem<HazardType>::check_npc_hazard_field_collision()
       if ( loot_entity != entt::null )
       {
         SPDLOG_DEBUG( "Dropped RELIC_DROP loot at NPC death position." );
-        m_sound_bank.get_effect( "drop_relic" ).play();
+        m_sound_bank.play( Audio::Effect::kDropRelic );
       }
       SPDLOG_DEBUG( "NPC fell into a hazard field at position ({}, {})!", hazard_pos_cmp.x, hazard_pos_cmp.y );
       return;
@@ -1,4 +1,6 @@
+#include <Audio/Effects.hpp>
 #include <Audio/SoundBank.hpp>
+#include <Debug/Profiler.hpp>
 #include <Events/LightningEvent.hpp>
 #include <Events/PlayerMortalityEvent.hpp>
 #include <LightningStrike.hpp>
@@ -31,6 +33,7 @@ void LightningSystem::on_lightning_event( [[maybe_unused]] Events::LightningEven
 
 void LightningSystem::update( sf::Time dt )
 {
+  PROFILE_ZONE( "LightningSystem::update" );
   if ( trigger_lightning and not lightning_strike_exists() )
   {
     create_lightning_strike( dt );
@@ -82,7 +85,7 @@ void LightningSystem::create_lightning_strike( [[maybe_unused]] sf::Time dt )
     reg().emplace_or_replace<Cmp::LightningStrike>( entt_main, ls_cmp_main );
     SPDLOG_INFO( "Created lightning strike {}", static_cast<uint32_t>( entt_main ) );
   }
-  m_sound_bank.get_effect( "lightning_strike" ).play();
+  m_sound_bank.play( Audio::Effect::kLightningStrike );
 }
 
 void LightningSystem::delete_expired_lightning_strikes()
@@ -1,3 +1,4 @@
+#include <Audio/Effects.hpp>
 #include <Audio/SoundBank.hpp>
 #include <Collision.hpp>
 #include <Components/Altar/AltarSegment.hpp>
@@ -24,15 +25,17 @@
 #include <Components/Wormhole/WormholeJump.hpp>
 #include <Components/ZOrderValue.hpp>
 #include <Crypt/CryptObjectiveSegment.hpp>
+#include <Debug/Profiler.hpp>
 #include <Events/PlayerMortalityEvent.hpp>
 #include <Factory/NpcFactory.hpp>
 #include <Grave/GraveSegment.hpp>
 #include <Npc/NpcFriendly.hpp>
 #include <Npc/NpcLerpSpeed.hpp>
-#include <PathFinding/AStar.hpp>
+#include <PathFinding/FlowField.hpp>
 #include <PathFinding/SpatialHashGrid.hpp>
 #include <Ruin/RuinSegment.hpp>
 #include <Sprites/SpriteFactory.hpp>
+#include <Sprites/SpriteTypes.hpp>
 #include <Stats/BaseAction.hpp>
 #include <Stats/CollisionAction.hpp>
 #include <Systems/BaseSystem.hpp>
@@ -62,6 +65,7 @@ NpcSystem::NpcSystem( entt::registry &reg, sf::RenderWindow &window, Sprites::Sp
 
 void NpcSystem::update( sf::Time dt )
 {
+  PROFILE_ZONE( "NpcSystem::update" );
 
   // run skelton activation checks at 5Hz
   static constexpr float kBonesInterval = 0.20f;
@@ -119,7 +123,7 @@ void NpcSystem::check_bones_reanimation()
     if ( player_pos.findIntersection( npc_activate_bounds.getBounds() ) )
     {
       Factory::create_npc( reg(), npccontainer_entt, "npc.skeleton" );
-      m_sound_bank.get_effect( "spawn_skeleton" ).play();
+      m_sound_bank.play( Audio::Effect::kSpawnSkeleton );
     }
   }
 }
@@ -136,21 +140,21 @@ void NpcSystem::update_animation()
     }
 
     anim_cmp.m_animation_active = true;
-    if ( anim_cmp.m_sprite_type.contains( "sprite.skeleton" ) )
+    if ( anim_cmp.m_sprite_type.is_a( Sprites::Type::kSkeleton ) )
     {
 
-      if ( npc_dir_cmp.x > 0 ) { anim_cmp.m_sprite_type = "sprite.skeleton.walk.east"; }
-      else if ( npc_dir_cmp.x < 0 ) { anim_cmp.m_sprite_type = "sprite.skeleton.walk.west"; }
-      else if ( npc_dir_cmp.y < 0 ) { anim_cmp.m_sprite_type = "sprite.skeleton.walk.north"; }
-      else if ( npc_dir_cmp.y > 0 ) { anim_cmp.m_sprite_type = "sprite.skeleton.walk.south"; }
+      if ( npc_dir_cmp.x > 0 ) { anim_cmp.m_sprite_type = Sprites::Type::kSkeletonWalkEast; }
+      else if ( npc_dir_cmp.x < 0 ) { anim_cmp.m_sprite_type = Sprites::Type::kSkeletonWalkWest; }
+      else if ( npc_dir_cmp.y < 0 ) { anim_cmp.m_sprite_type = Sprites::Type::kSkeletonWalkNorth; }
+      else if ( npc_dir_cmp.y > 0 ) { anim_cmp.m_sprite_type = Sprites::Type::kSkeletonWalkSouth; }
     }
-    else if ( anim_cmp.m_sprite_type.contains( "sprite.ghost" ) )
+    else if ( anim_cmp.m_sprite_type.is_a( Sprites::Type::kGhost ) )
     {
       // Ghost NPCs face cardinal directions only
-      if ( npc_dir_cmp.x > 0 ) { anim_cmp.m_sprite_type = "sprite.ghost.walk.east"; }
-      else if ( npc_dir_cmp.x < 0 ) { anim_cmp.m_sprite_type = "sprite.ghost.walk.west"; }
-      else if ( npc_dir_cmp.y < 0 ) { anim_cmp.m_sprite_type = "sprite.ghost.walk.north"; }
-      else if ( npc_dir_cmp.y > 0 ) { anim_cmp.m_sprite_type = "sprite.ghost.walk.south"; }
+      if ( npc_dir_cmp.x > 0 ) { anim_cmp.m_sprite_type = Sprites::Type::kGhostWalkEast; }
+      else if ( npc_dir_cmp.x < 0 ) { anim_cmp.m_sprite_type = Sprites::Type::kGhostWalkWest; }
+      else if ( npc_dir_cmp.y < 0 ) { anim_cmp.m_sprite_type = Sprites::Type::kGhostWalkNorth; }
+      else if ( npc_dir_cmp.y > 0 ) { anim_cmp.m_sprite_type = Sprites::Type::kGhostWalkSouth; }
     }
   }
 }
@@ -164,6 +168,16 @@ void NpcSystem::update_pathfinding( [[maybe_unused]] entt::entity player_entity
   auto player_pos_cmp = Utils::Player::get_position( reg() );
   auto player_in_spawn = Utils::Player::is_in_spawn( reg(), player_pos_cmp );
 
+  // The flow fields are only rebuilt when the player changes cell or the navmesh changes, and only if an NPC needs them
+  bool cardinal_flowfield_updated = false;
+  bool ordinal_flowfield_updated = false;
+  auto get_flowfield = [&]( PathFinding::FlowField &flowfield, bool &updated ) -> const PathFinding::FlowField &
+  {
+    if ( not updated ) flowfield.update( reg(), *pathfinding_navmesh, player_pos_cmp );
+    updated = true;
+    return flowfield;
+  };
+
   auto npc_view = reg().view<Cmp::NPC, Cmp::Position, Cmp::SpriteAnimation, Cmp::NpcLerpSpeed>( entt::exclude<Cmp::NpcFriendly> );
   for ( auto [npc_entity, npc_cmp, npc_pos_cmp, anim_cmp, lerp_speed_cmp] : npc_view.each() )
   {
@@ -175,18 +189,15 @@ void NpcSystem::update_pathfinding( [[maybe_unused]] entt::entity player_entity
     if ( npc_lerp_pos_cmp && npc_lerp_pos_cmp->m_lerp_factor < 1.0f ) continue;
 
     // allow ghosts to sneak through gaps
-    auto query_compass = PathFinding::QueryCompass::CARDINAL;
-    if ( anim_cmp.m_sprite_type.contains( "sprite.ghost" ) ) query_compass = PathFinding::QueryCompass::BOTH;
-
-    // now get latest path vector for NPC -> player
-    std::vector<PathFinding::PathNode> path = PathFinding::astar( reg(), *pathfinding_navmesh, npc_pos_cmp, player_pos_cmp, query_compass );
+    const auto &flowfield = anim_cmp.m_sprite_type.is_a( Sprites::Type::kGhost )
+                                ? get_flowfield( m_ordinal_flowfield, ordinal_flowfield_updated )
+                                : get_flowfield( m_cardinal_flowfield, cardinal_flowfield_updated );
 
-    // dont let NPC follow player into spawn but keep pathfinding active up to penultimate path node
-    // if ( player_in_spawn and not path.empty() ) path.pop_back();
-    if ( path.size() > 1 )
+    // now get the next step for NPC -> player
+    std::optional<Cmp::Position> next_step = flowfield.next_step( npc_pos_cmp );
+    if ( next_step )
     {
-      // path[0] is the NPC current position, so go one forward
-      auto new_position_cmp = path[1].pos;
+      auto new_position_cmp = *next_step;
 
       // If the player is in spawn, pathfind to them but not to final position
       if ( player_in_spawn and player_pos_cmp == new_position_cmp ) continue;
@@ -299,7 +310,7 @@ void NpcSystem::check_once_collision()
 
       Utils::Player::get_player_stats( reg() ).apply_modifiers( action );
 
-      m_sound_bank.get_effect( "damage_player" ).play();
+      m_sound_bank.play( Audio::Effect::kDamagePlayer, Audio::SoundBank::Priority::HIGH );
 
       if ( Utils::Player::get_player_stats( reg() ).health() <= 0 )
       {
@@ -337,7 +348,7 @@ void NpcSystem::check_timed_collision( sf::Time dt )
     if ( not player_pos.findIntersection( npc_pos_cmp ) ) continue;
 
     Utils::Player::get_player_stats( reg() ).apply_modifiers( npc_action );
-    if ( m_sound_bank.get_effect( "damage_player" ).getStatus() != sf::Sound::Status::Playing ) { m_sound_bank.get_effect( "damage_player" ).play(); }
+    m_sound_bank.play_once( Audio::Effect::kDamagePlayer, Audio::SoundBank::Priority::HIGH );
 
     npc_action_timer = sf::Time::Zero;
 
@@ -376,7 +387,7 @@ void NpcSystem::update_shockwaves()
   for ( auto npc_entt : reg().view<Cmp::NPC>() )
   {
     auto *npc_sprite_anim = reg().try_get<Cmp::SpriteAnimation>( npc_entt );
-    if ( npc_sprite_anim && npc_sprite_anim->m_sprite_type == "sprite.priest" )
+    if ( npc_sprite_anim && npc_sprite_anim->m_sprite_type == Sprites::Type::kPriest )
     {
       // cooldown is handled in Factory function via Cmp::NpcShockwaveTimer per NPC
       Factory::create_shockwave( reg(), npc_entt );
@@ -421,8 +432,8 @@ void NpcSystem::checkShockwaveObstacleCollision( [[maybe_unused]] entt::entity s
   for ( auto [obstacle_entity, obstacle_cmp, obstacle_pos, sprite_anim] : obstacle_view.each() )
   {
     // Check if this is the specific obstacle type and index we care about
-    if ( ( sprite_anim.m_sprite_type == "sprite.crypt.wall.int" && sprite_anim.getFrameIndexOffset() == 1 ) or
-         ( sprite_anim.m_sprite_type == "sprite.crypt.wall.int" && sprite_anim.getFrameIndexOffset() == 0 ) )
+    if ( ( sprite_anim.m_sprite_type == Sprites::Type::kCryptWallInt && sprite_anim.getFrameIndexOffset() == 1 ) or
+         ( sprite_anim.m_sprite_type == Sprites::Type::kCryptWallInt && sprite_anim.getFrameIndexOffset() == 0 ) )
     {
       sf::FloatRect obstacle_rect( obstacle_pos.position, obstacle_pos.size );
 
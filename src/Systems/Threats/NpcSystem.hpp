@@ -1,7 +1,9 @@
 #ifndef SRC_SYSTEMS_NPCSYSTEM_HPP__
 #define SRC_SYSTEMS_NPCSYSTEM_HPP__
 
+#include <PathFinding/FlowField.hpp>
 #include <Systems/BaseSystem.hpp>
+#include <Utils/GameClock.hpp>
 
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
@@ -36,7 +38,12 @@ public:
 
   //! @brief init the weak pointer for the pathfinding navmesh
   //! @param pathfinding_navmesh
-  void init( const PathFinding::SpatialHashGridSharedPtr &pathfinding_navmesh ) { m_pathfinding_navmesh = pathfinding_navmesh; }
+  void init( const PathFinding::SpatialHashGridSharedPtr &pathfinding_navmesh )
+  {
+    m_pathfinding_navmesh = pathfinding_navmesh;
+    m_cardinal_flowfield.invalidate();
+    m_ordinal_flowfield.invalidate();
+  }
 
   //! @brief Update the NpcSystem
   //! @param dt Delta time since last update call
@@ -76,7 +83,7 @@ private:
   void update_animation();
 
   void update_shockwaves();
-  sf::Clock shockwave_update_clock;
+  Utils::GameClock shockwave_update_clock;
 
   void checkShockwaveObstacleCollision( entt::entity shockwave_entity, Cmp::NpcShockwave &shockwave );
 
@@ -85,6 +92,10 @@ private:
   sf::Time m_bones_accumulator;
 
   PathFinding::SpatialHashGridWeakPtr m_pathfinding_navmesh;
+
+  //! @brief Player-rooted flow fields shared by all NPCs: cardinal-only movers and ghosts (which can sneak through diagonal gaps)
+  PathFinding::FlowField m_cardinal_flowfield{ PathFinding::QueryCompass::CARDINAL };
+  PathFinding::FlowField m_ordinal_flowfield{ PathFinding::QueryCompass::BOTH };
 };
 
 } // namespace ProceduralMaze::Sys
@@ -1,4 +1,5 @@
 #include "ShockwaveSystem.hpp"
+#include <Audio/Effects.hpp>
 #include <Audio/SoundBank.hpp>
 #include <Components/Npc/NpcShockwave.hpp>
 #include <Components/Obstacle.hpp>
@@ -199,7 +200,7 @@ void ShockwaveSystem::checkShockwavePlayerCollision()
       if ( Sys::ShockwaveSystem::intersectsWithVisibleSegments( reg(), shockwave, player_pos ) )
       {
         player_stats_cmp.apply_modifiers( priest_projectile_action.action );
-        m_sound_bank.get_effect( "damage_player" ).play();
+        m_sound_bank.play( Audio::Effect::kDamagePlayer, Audio::SoundBank::Priority::HIGH );
         player_cmp.m_damage_cooldown_timer.restart();
         SPDLOG_INFO( "Player (health:{}) INTERSECTS with Shockwave (position: {},{} - effective_radius: {})", player_stats_cmp.health(),
                      shockwave.sprite.getPosition().x, shockwave.sprite.getPosition().y, shockwave.sprite.getRadius() );
@@ -1,4 +1,5 @@
 
+#include <Audio/Effects.hpp>
 #include <Audio/SoundBank.hpp>
 #include <Components/Altar/AltarSegment.hpp>
 #include <Components/Crypt/CryptSegment.hpp>
@@ -27,6 +28,7 @@
 #include <Factory/LootFactory.hpp>
 #include <Factory/NpcFactory.hpp>
 #include <Factory/ObstacleFactory.hpp>
+#include <PathFinding/OccupancyGrid.hpp>
 #include <Systems/PersistSystem.hpp>
 #include <Systems/PersistSystemImpl.hpp>
 #include <Systems/Render/RenderSystem.hpp>
@@ -53,7 +55,7 @@ WormholeSystem::WormholeSystem( entt::registry &reg, sf::RenderWindow &window, S
 
 void WormholeSystem::on_pause()
 {
-  if ( m_sound_bank.get_effect( "wormhole_jump" ).getStatus() == sf::Sound::Status::Playing ) m_sound_bank.get_effect( "wormhole_jump" ).pause();
+  m_sound_bank.pause( Audio::Effect::kWormholeJump );
 
   auto jump_view = reg().view<Cmp::WormholeJump>();
   for ( auto [entity, jump_cmp] : jump_view.each() )
@@ -64,7 +66,7 @@ void WormholeSystem::on_pause()
 
 void WormholeSystem::on_resume()
 {
-  if ( m_sound_bank.get_effect( "wormhole_jump" ).getStatus() == sf::Sound::Status::Paused ) m_sound_bank.get_effect( "wormhole_jump" ).play();
+  m_sound_bank.resume( Audio::Effect::kWormholeJump );
 
   auto jump_view = reg().view<Cmp::WormholeJump>();
   for ( auto [entity, jump_cmp] : jump_view.each() )
@@ -75,71 +77,30 @@ void WormholeSystem::on_resume()
 
 std::pair<entt::entity, Cmp::Position> WormholeSystem::find_spawn_location( unsigned long seed )
 {
-  constexpr int kMaxAttempts = 1000;
-  int attempts = 0;
-  unsigned long current_seed = seed;
+  using WormholeOccupancy = PathFinding::BlockerOccupancy<Cmp::Wall, Cmp::GraveSegment, Cmp::AltarSegment, Cmp::CryptSegment, Cmp::HazardFieldCell>;
 
-  while ( attempts < kMaxAttempts )
+  auto &wormhole_ms = m_sprite_factory.get_multisprite_by_type( "sprite.graveyard.hazard.wormhole" );
+  const auto footprint = PathFinding::OccupancyGrid::footprint( wormhole_ms.get_grid_size().componentWiseMul( Constants::kGridSizePx ) );
+  const auto &occupancy = WormholeOccupancy::get( reg() );
+
+  // the wormhole takes over an existing obstacle, so the candidates are the obstacles whose footprint is clear
+  std::vector<std::pair<entt::entity, Cmp::Position>> candidates;
+  auto obstacle_view = reg().view<Cmp::Obstacle, Cmp::Position>(
+      entt::exclude<Cmp::Wall, Cmp::Exit, Cmp::PlayerCharacter, Cmp::NPC, Cmp::ReservedPosition> );
+  for ( auto [entity, obstacle_cmp, obstacle_pos_cmp] : obstacle_view.each() )
   {
-    auto [random_entity, random_pos] = Utils::Rnd::get_random_position(
-        reg(), Utils::Rnd::IncludePack<Cmp::Obstacle>{},
-        Utils::Rnd::ExcludePack<Cmp::Wall, Cmp::Exit, Cmp::PlayerCharacter, Cmp::NPC, Cmp::ReservedPosition>{}, current_seed );
-
-    auto &wormhole_ms = m_sprite_factory.get_multisprite_by_type( "sprite.graveyard.hazard.wormhole" );
-    Cmp::WormholeMultiBlock wormhole_block( random_pos.position, wormhole_ms.get_grid_size().componentWiseMul( Constants::kGridSizePx ) );
-
-    // Check collisions with walls, graves, shrines
-    auto is_valid = [&]() -> bool
-    {
-      // return false for wall collisions
-      for ( auto [entity, wall_cmp, wall_pos_cmp] : reg().view<Cmp::Wall, Cmp::Position>().each() )
-      {
-        if ( wall_pos_cmp.findIntersection( wormhole_block ) ) return false;
-      }
-
-      // Return false for grave collisions
-      for ( auto [entity, grave_cmp, grave_pos_cmp] : reg().view<Cmp::GraveSegment, Cmp::Position>().each() )
-      {
-        if ( grave_pos_cmp.findIntersection( wormhole_block ) ) return false;
-      }
-
-      // Return false for altar collisions
-      for ( auto [entity, altar_cmp, altar_pos_cmp] : reg().view<Cmp::AltarSegment, Cmp::Position>().each() )
-      {
-        if ( altar_pos_cmp.findIntersection( wormhole_block ) ) return false;
-      }
-
-      // Return false for crypt collisions
-      for ( auto [entity, crypt_cmp, crypt_pos_cmp] : reg().view<Cmp::CryptSegment, Cmp::Position>().each() )
-      {
-        if ( crypt_pos_cmp.findIntersection( wormhole_block ) ) return false;
-      }
-
-      // Return false for hazard collisions
-      for ( auto [entity, hazard_cmp, hazard_pos_cmp] : reg().view<Cmp::HazardFieldCell, Cmp::Position>().each() )
-      {
-        if ( hazard_pos_cmp.findIntersection( wormhole_block ) ) return false;
-      }
-
-      return true;
-    };
-
-    if ( is_valid() )
-    {
-      if ( current_seed != seed && seed > 0 )
-      {
-        SPDLOG_WARN( "Wormhole spawn: original seed {} was invalid, used seed {} instead (attempt {})", seed, current_seed, attempts + 1 );
-      }
-      return { random_entity, random_pos };
-    }
+    if ( occupancy.is_free( PathFinding::OccupancyGrid::cell_of( obstacle_pos_cmp ), footprint ) ) candidates.emplace_back( entity, obstacle_pos_cmp );
+  }
 
-    attempts++;
-    // Increment seed for next attempt (works for both seeded and non-seeded cases)
-    if ( seed > 0 ) { current_seed++; }
+  if ( candidates.empty() )
+  {
+    SPDLOG_ERROR( "Failed to find valid wormhole spawn location (seed: {})", seed );
+    return { entt::null, Cmp::Position{ { 0.f, 0.f }, { 0.f, 0.f } } };
   }
 
-  SPDLOG_ERROR( "Failed to find valid wormhole spawn location after {} attempts (original seed: {})", kMaxAttempts, seed );
-  return { entt::null, Cmp::Position{ { 0.f, 0.f }, { 0.f, 0.f } } };
+  Cmp::RandomInt seed_picker( 0, static_cast<int>( candidates.size() - 1 ), Utils::Rnd::Stream::HAZARDS );
+  if ( seed != 0 ) { seed_picker.seed( seed ); }
+  return candidates[static_cast<std::size_t>( seed_picker.gen() )];
 }
 
 void WormholeSystem::spawn_wormhole( SpawnPhase phase )
@@ -226,7 +187,7 @@ void WormholeSystem::check_player_wormhole_collision()
     {
       SPDLOG_WARN( "Entity {} has WormholeJump but is NO LONGER colliding - removing jump component", static_cast<uint32_t>( entity ) );
       reg().remove<Cmp::WormholeJump>( entity );
-      m_sound_bank.get_effect( "wormhole_jump" ).stop();
+      m_sound_bank.stop( Audio::Effect::kWormholeJump );
     }
   }
 
@@ -246,9 +207,9 @@ void WormholeSystem::check_player_wormhole_collision()
         // First collision - create component
         reg().emplace<Cmp::WormholeJump>( actor_entity );
         SPDLOG_INFO( "Entity {} is jump candidate.", static_cast<uint32_t>( actor_entity ) );
-        // restart the jump sfx for each actor processed so that it is heard by the last actor.
+        // restart the jump sfx for each actor processed so that it is heard once, in time with the last actor.
         // There is adequate lead time on the sfx (~2secs) to prevent restart stuttering.
-        m_sound_bank.get_effect( "wormhole_jump" ).play();
+        m_sound_bank.restart( Audio::Effect::kWormholeJump );
       }
     }
   }
@@ -273,7 +234,8 @@ void WormholeSystem::check_player_wormhole_collision()
 
       // Get unique random position for this actor entity
       auto [new_spawn_entity, new_spawn_pos_cmp] = Utils::Rnd::get_random_position(
-          reg(), Utils::Rnd::IncludePack<Cmp::Obstacle>{}, Utils::Rnd::ExcludePack<Cmp::Wall, Cmp::Exit, Cmp::PlayerCharacter, Cmp::NPC>{}, 0 );
+          reg(), Utils::Rnd::IncludePack<Cmp::Obstacle>{}, Utils::Rnd::ExcludePack<Cmp::Wall, Cmp::Exit, Cmp::PlayerCharacter, Cmp::NPC>{}, 0,
+          Utils::Rnd::Stream::HAZARDS );
 
       Factory::remove_obstacle( reg(), new_spawn_entity );
       reg().emplace_or_replace<Cmp::SpriteAnimation>( new_spawn_entity, 0, 0, true, "sprite.graveyard.detonated", 0 );
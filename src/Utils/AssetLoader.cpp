@@ -0,0 +1,82 @@
+#include <Utils/AssetLoader.hpp>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+
+namespace ProceduralMaze::Utils
+{
+
+std::atomic<std::size_t> AssetLoader::s_done{ 0 };
+std::atomic<std::size_t> AssetLoader::s_total{ 0 };
+
+AssetLoader::AssetLoader( unsigned int thread_count )
+{
+  thread_count = std::max( thread_count, 1u );
+  m_workers.reserve( thread_count );
+  try
+  {
+    for ( unsigned int i = 0; i < thread_count; ++i )
+      m_workers.emplace_back( [this]() { worker_loop(); } );
+  } catch ( ... )
+  {
+    // the destructor never runs for a throwing constructor, and destroying a joinable std::thread terminates
+    SPDLOG_ERROR( "Asset loader could only start {} of {} worker threads", m_workers.size(), thread_count );
+    stop();
+    throw;
+  }
+  SPDLOG_INFO( "Asset loader started {} worker threads", thread_count );
+}
+
+AssetLoader::~AssetLoader()
+{
+  stop();
+
+  SPDLOG_INFO( "Asset loader finished {} jobs", s_done.load() );
+  s_done = 0;
+  s_total = 0;
+}
+
+AssetLoader::Progress AssetLoader::progress() { return Progress{ s_done.load(), s_total.load() }; }
+
+void AssetLoader::enqueue( std::function<void()> job )
+{
+  {
+    std::lock_guard lock( m_mutex );
+    m_jobs.push_back( std::move( job ) );
+  }
+  ++s_total;
+  m_cv.notify_one();
+}
+
+void AssetLoader::stop()
+{
+  {
+    std::lock_guard lock( m_mutex );
+    m_stopping = true;
+  }
+  m_cv.notify_all();
+  for ( auto &worker : m_workers )
+    worker.join();
+}
+
+void AssetLoader::worker_loop()
+{
+  while ( true )
+  {
+    std::function<void()> job;
+    {
+      std::unique_lock lock( m_mutex );
+      m_cv.wait( lock, [this]() { return m_stopping or not m_jobs.empty(); } );
+      // drain the queue before stopping, so no future is left without a result
+      if ( m_jobs.empty() ) return;
+      job = std::move( m_jobs.front() );
+      m_jobs.pop_front();
+    }
+    // packaged_task stores any exception in the job's future
+    job();
+    ++s_done;
+  }
+}
+
+} // namespace ProceduralMaze::Utils
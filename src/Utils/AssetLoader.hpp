@@ -0,0 +1,82 @@
+#ifndef SRC_UTILS_ASSETLOADER_HPP_
+#define SRC_UTILS_ASSETLOADER_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace ProceduralMaze::Utils
+{
+
+//! @brief A small worker pool for the file I/O and decoding of game assets (images, sound buffers, music streams).
+//! Jobs must not touch the GPU: submit the decode and do the texture upload on the thread that owns the result.
+//! Every submitted and finished job is counted in `progress()`, which the loading screens display.
+//!
+//! @example
+//! Utils::AssetLoader loader;
+//! auto image = loader.submit( [] { return sf::Image( "res/textures/splash.png" ); } );
+//! sf::Texture texture( image.get() ); // exceptions thrown by the job are rethrown here
+class AssetLoader
+{
+public:
+  //! @brief Completed and submitted job counts of the live AssetLoader. Both are 0 when nothing is loading.
+  struct Progress
+  {
+    std::size_t done{ 0 };
+    std::size_t total{ 0 };
+  };
+
+  //! @brief Start `thread_count` workers (one per core by default)
+  //! @throws std::system_error If a worker thread cannot be started. The workers already started are joined first.
+  explicit AssetLoader( unsigned int thread_count = std::thread::hardware_concurrency() );
+
+  //! @brief Finishes the queued jobs, joins the workers and resets `progress()`
+  ~AssetLoader();
+
+  AssetLoader( const AssetLoader & ) = delete;
+  AssetLoader &operator=( const AssetLoader & ) = delete;
+
+  //! @brief Queue `job` on the worker pool
+  //! @return The result of `job`, or the exception it threw
+  template <typename Job>
+  auto submit( Job &&job ) -> std::future<std::invoke_result_t<Job>>
+  {
+    using Result = std::invoke_result_t<Job>;
+    // std::function needs a copyable target, so the (move-only) task is shared
+    auto task = std::make_shared<std::packaged_task<Result()>>( std::forward<Job>( job ) );
+    auto result = task->get_future();
+    enqueue( [task]() { ( *task )(); } );
+    return result;
+  }
+
+  //! @brief Safe to call from any thread, e.g. the loading screen
+  static Progress progress();
+
+private:
+  void enqueue( std::function<void()> job );
+  void worker_loop();
+
+  //! @brief Let the workers finish the queued jobs, then join them
+  void stop();
+
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::deque<std::function<void()>> m_jobs;
+  bool m_stopping{ false };
+  std::vector<std::thread> m_workers;
+
+  static std::atomic<std::size_t> s_done;
+  static std::atomic<std::size_t> s_total;
+};
+
+} // namespace ProceduralMaze::Utils
+
+#endif // SRC_UTILS_ASSETLOADER_HPP_
@@ -3,6 +3,7 @@
 
 #include <Components/Position.hpp>
 #include <Components/RectBounds.hpp>
+#include <Utils/CollisionBroadphase.hpp>
 #include <entt/entity/registry.hpp>
 
 namespace ProceduralMaze::Utils::Collision
@@ -13,16 +14,33 @@ namespace ProceduralMaze::Utils::Collision
 //! @param reg reference to the entt reg
 //! @param pos Does this position contain a `Component`
 //! @param filter Optional callback to filter candidates. Return true to consider this entity, false to skip.
+//! @note Only the broadphase cells around `pos` are searched, unless `Component` moves in place (see `kMovesInPlace`)
 //! @return requires
 template <typename Component>
 bool check_cmp( entt::registry &reg, Cmp::RectBounds pos, std::function<bool( const Component & )> filter = []( const Component & ) { return true; } )
 {
-  for ( auto [candidate_entt, candidate_cmp, candidate_pos] : reg.view<Component, Cmp::Position>().each() )
+  if constexpr ( kMovesInPlace<Component> )
   {
-    if ( not filter( candidate_cmp ) ) continue;
-    if ( pos.findIntersection( candidate_pos ) ) { return true; }
+    for ( auto [candidate_entt, candidate_cmp, candidate_pos] : reg.view<Component, Cmp::Position>().each() )
+    {
+      if ( not filter( candidate_cmp ) ) continue;
+      if ( pos.findIntersection( candidate_pos ) ) { return true; }
+    }
+    return false;
+  }
+  else
+  {
+    bool found = false;
+    Broadphase<Component, Cmp::Position>::get( reg ).for_each_candidate( pos.getBounds(),
+                                                                         [&]( entt::entity candidate_entt )
+                                                                         {
+                                                                           if ( not pos.findIntersection( reg.get<Cmp::Position>( candidate_entt ) ) )
+                                                                             return true;
+                                                                           found = filter( reg.get<Component>( candidate_entt ) );
+                                                                           return not found;
+                                                                         } );
+    return found;
   }
-  return false;
 };
 
 // Concept to check if Component inherits from one of the valid position/bounds types
@@ -34,17 +52,22 @@ concept HasPositionBounds = std::is_base_of_v<Cmp::Position, T> || std::is_base_
 //! @param reg reference to the entt reg
 //! @param pos Does this position contain a `Component`
 //! @param filter Optional callback to filter candidates. Return true to consider this entity, false to skip.
+//! @note Only the broadphase cells around `pos` are searched
 //! @return requires
 template <typename Component>
   requires HasPositionBounds<Component>
 bool check_pos( entt::registry &reg, Cmp::RectBounds pos, std::function<bool( const Component & )> filter = []( const Component & ) { return true; } )
 {
-  for ( auto [candidate_entt, candidate_cmp] : reg.view<Component>().each() )
-  {
-    if ( not filter( candidate_cmp ) ) continue;
-    if ( pos.findIntersection( candidate_cmp ) ) { return true; }
-  }
-  return false;
+  bool found = false;
+  Broadphase<Component, Component>::get( reg ).for_each_candidate( pos.getBounds(),
+                                                                   [&]( entt::entity candidate_entt )
+                                                                   {
+                                                                     const auto &candidate_cmp = reg.get<Component>( candidate_entt );
+                                                                     if ( not pos.findIntersection( candidate_cmp ) ) return true;
+                                                                     found = filter( candidate_cmp );
+                                                                     return not found;
+                                                                   } );
+  return found;
 }
 
 } // namespace ProceduralMaze::Utils::Collision
@@ -0,0 +1,163 @@
+#ifndef SRC_UTILS_COLLISIONBROADPHASE_HPP_
+#define SRC_UTILS_COLLISIONBROADPHASE_HPP_
+
+#include <Components/Position.hpp>
+#include <PathFinding/SpatialHashGrid.hpp>
+#include <Utils/Constants.hpp>
+
+#include <entt/entity/registry.hpp>
+
+#include <cmath>
+#include <type_traits>
+#include <unordered_map>
+
+namespace ProceduralMaze::Cmp
+{
+class NPC;
+class PlayerCharacter;
+} // namespace ProceduralMaze::Cmp
+
+namespace ProceduralMaze::Utils::Collision
+{
+
+//! @brief Components on entities that move by mutating their Cmp::Position in place. That raises no EnTT signal,
+//! so the broadphase cannot track them and collision checks against them fall back to a linear scan of the view.
+template <typename Component>
+inline constexpr bool kMovesInPlace = false;
+template <>
+inline constexpr bool kMovesInPlace<Cmp::NPC> = true;
+template <>
+inline constexpr bool kMovesInPlace<Cmp::PlayerCharacter> = true;
+
+//! @brief Uniform grid broadphase over every entity owning `Component`, bucketed by the cells covered by its `BoundsComponent` rect.
+//! One instance per component pair lives in the registry context. It is populated on first use and kept current through EnTT
+//! construct/update/destroy signals, so `check_cmp()`/`check_pos()` only touch the few cells around the tested rect.
+//! @tparam Component The component type being collided against
+//! @tparam BoundsComponent Cmp::Position for `check_cmp()`, or `Component` itself for `check_pos()`
+template <typename Component, typename BoundsComponent>
+class Broadphase
+{
+public:
+  //! @brief Get the broadphase for `reg`, creating and populating it on first use
+  //! @param reg
+  //! @return Broadphase&
+  static Broadphase &get( entt::registry &reg )
+  {
+    if ( auto *broadphase = reg.ctx().find<Broadphase>() ) return *broadphase;
+    auto &broadphase = reg.ctx().emplace<Broadphase>();
+
+    reg.on_construct<Component>().template connect<&Broadphase::on_emplace>();
+    reg.on_update<Component>().template connect<&Broadphase::on_replace>();
+    reg.on_destroy<Component>().template connect<&Broadphase::on_erase>();
+    if constexpr ( not std::is_same_v<Component, BoundsComponent> )
+    {
+      reg.on_construct<BoundsComponent>().template connect<&Broadphase::on_emplace>();
+      reg.on_update<BoundsComponent>().template connect<&Broadphase::on_replace>();
+      reg.on_destroy<BoundsComponent>().template connect<&Broadphase::on_erase>();
+      for ( auto [entt, cmp, bounds] : reg.view<Component, BoundsComponent>().each() )
+        broadphase.insert( entt, bounds );
+    }
+    else
+    {
+      for ( auto [entt, bounds] : reg.view<Component>().each() )
+        broadphase.insert( entt, bounds );
+    }
+    return broadphase;
+  }
+
+  //! @brief Call `visitor( entt::entity )` for each entity bucketed in the cells overlapping `rect`.
+  //! Entities spanning several cells may be visited more than once. If `visitor` returns bool, returning false stops the query early.
+  //! @param rect
+  //! @param visitor
+  template <typename Visitor>
+  void for_each_candidate( const sf::FloatRect &rect, Visitor &&visitor ) const
+  {
+    auto range = cell_range( rect );
+    bool stopped = false;
+    for ( int cy = range.min.y; cy <= range.max.y && not stopped; ++cy )
+    {
+      for ( int cx = range.min.x; cx <= range.max.x && not stopped; ++cx )
+      {
+        m_grid.for_each_at( cell_position( cx, cy ),
+                            [&]( entt::entity entt )
+                            {
+                              if constexpr ( std::is_same_v<std::invoke_result_t<Visitor &, entt::entity>, bool> )
+                              {
+                                stopped = not visitor( entt );
+                                return not stopped;
+                              }
+                              else { visitor( entt ); }
+                            } );
+      }
+    }
+  }
+
+private:
+  //! @brief Inclusive range of cells covered by a rect
+  struct CellRange
+  {
+    sf::Vector2i min;
+    sf::Vector2i max;
+  };
+
+  PathFinding::SpatialHashGrid m_grid;
+
+  //! @brief cells each entity was inserted into, so it can be removed after its bounds have changed
+  std::unordered_map<entt::entity, CellRange> m_entity_cells;
+
+  static CellRange cell_range( const sf::FloatRect &rect )
+  {
+    const auto cell_size = Constants::kGridSizePxF;
+    return { { static_cast<int>( std::floor( rect.position.x / cell_size.x ) ), static_cast<int>( std::floor( rect.position.y / cell_size.y ) ) },
+             { static_cast<int>( std::floor( ( rect.position.x + rect.size.x ) / cell_size.x ) ),
+               static_cast<int>( std::floor( ( rect.position.y + rect.size.y ) / cell_size.y ) ) } };
+  }
+
+  //! @brief World bounds of a `BoundsComponent`, which may be a sf::FloatRect or a Cmp::RectBounds
+  static sf::FloatRect bounds_of( const BoundsComponent &bounds )
+  {
+    if constexpr ( requires { bounds.getBounds(); } ) { return bounds.getBounds(); }
+    else { return bounds; }
+  }
+
+  static Cmp::Position cell_position( int cx, int cy )
+  {
+    return Cmp::Position( { static_cast<float>( cx ) * Constants::kGridSizePxF.x, static_cast<float>( cy ) * Constants::kGridSizePxF.y },
+                          Constants::kGridSizePxF );
+  }
+
+  void insert( entt::entity entt, const BoundsComponent &bounds )
+  {
+    auto range = cell_range( bounds_of( bounds ) );
+    for ( int cy = range.min.y; cy <= range.max.y; ++cy )
+      for ( int cx = range.min.x; cx <= range.max.x; ++cx )
+        m_grid.insert( entt, cell_position( cx, cy ) );
+    m_entity_cells.insert_or_assign( entt, range );
+  }
+
+  void remove( entt::entity entt )
+  {
+    auto it = m_entity_cells.find( entt );
+    if ( it == m_entity_cells.end() ) return;
+    auto range = it->second;
+    for ( int cy = range.min.y; cy <= range.max.y; ++cy )
+      for ( int cx = range.min.x; cx <= range.max.x; ++cx )
+        m_grid.remove( entt, cell_position( cx, cy ) );
+    m_entity_cells.erase( it );
+  }
+
+  //! @brief signal handlers: the entity is only tracked while it owns both components
+  static void on_emplace( entt::registry &reg, entt::entity entt )
+  {
+    if ( not reg.all_of<Component, BoundsComponent>( entt ) ) return;
+    auto &broadphase = reg.ctx().get<Broadphase>();
+    broadphase.remove( entt );
+    broadphase.insert( entt, reg.get<BoundsComponent>( entt ) );
+  }
+  static void on_replace( entt::registry &reg, entt::entity entt ) { on_emplace( reg, entt ); }
+  static void on_erase( entt::registry &reg, entt::entity entt ) { reg.ctx().get<Broadphase>().remove( entt ); }
+};
+
+} // namespace ProceduralMaze::Utils::Collision
+
+#endif // SRC_UTILS_COLLISIONBROADPHASE_HPP_
@@ -0,0 +1,78 @@
+#ifndef SRC_UTILS_GAMECLOCK_HPP_
+#define SRC_UTILS_GAMECLOCK_HPP_
+
+#include <SFML/System/Time.hpp>
+
+namespace ProceduralMaze::Utils
+{
+
+//! @brief Drop-in for sf::Clock that measures simulation time rather than wall-clock time.
+//! Every GameClock reads the same simulation time, which only moves when the Engine calls `advance()` with the frame's `dt`:
+//! the measured frame time in a windowed run, the fixed timestep in a headless run. So gameplay timers (cooldowns, fuses,
+//! hazard spread) behave the same whatever the speed of the host, and a headless run with a given seed is reproducible.
+//! @note Use sf::Clock for anything that should follow the wall clock, i.e. profiling, loading screens and shader animation.
+class GameClock
+{
+public:
+  //! @brief Move the simulation time forward by `dt`. Called once per frame by the Engine, before the scene update.
+  static void advance( sf::Time dt ) { s_now += dt; }
+
+  //! @brief Simulation time since startup
+  static sf::Time now() { return s_now; }
+
+  //! @brief Starts running, like sf::Clock
+  GameClock() = default;
+
+  sf::Time getElapsedTime() const { return m_running ? m_elapsed + ( s_now - m_started ) : m_elapsed; }
+  bool isRunning() const { return m_running; }
+
+  //! @brief Resume counting. No-op if already running.
+  void start()
+  {
+    if ( m_running ) return;
+    m_started = s_now;
+    m_running = true;
+  }
+
+  //! @brief Pause counting, keeping the elapsed time. No-op if already stopped.
+  void stop()
+  {
+    if ( not m_running ) return;
+    m_elapsed = getElapsedTime();
+    m_running = false;
+  }
+
+  //! @brief Zero the elapsed time and keep running
+  //! @return sf::Time The elapsed time before the restart
+  sf::Time restart()
+  {
+    const auto elapsed = getElapsedTime();
+    m_elapsed = sf::Time::Zero;
+    m_started = s_now;
+    m_running = true;
+    return elapsed;
+  }
+
+  //! @brief Zero the elapsed time and stop
+  //! @return sf::Time The elapsed time before the reset
+  sf::Time reset()
+  {
+    const auto elapsed = getElapsedTime();
+    m_elapsed = sf::Time::Zero;
+    m_running = false;
+    return elapsed;
+  }
+
+private:
+  inline static sf::Time s_now{ sf::Time::Zero };
+
+  //! @brief simulation time of the last start()/restart()
+  sf::Time m_started{ s_now };
+  //! @brief time counted before the last stop()
+  sf::Time m_elapsed{ sf::Time::Zero };
+  bool m_running{ true };
+};
+
+} // namespace ProceduralMaze::Utils
+
+#endif // SRC_UTILS_GAMECLOCK_HPP_
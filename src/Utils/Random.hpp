@@ -5,13 +5,16 @@
 #include <Components/Obstacle.hpp>
 #include <Components/Position.hpp>
 #include <Components/Random.hpp>
+#include <Utils/RngStreams.hpp>
 #include <SFML/Graphics/Rect.hpp>
 #include <cstddef>
 #include <entt/entity/registry.hpp>
-#include <set>
+#include <random>
 #include <source_location>
 #include <spdlog/spdlog.h>
 #include <sstream>
+#include <utility>
+#include <vector>
 
 namespace ProceduralMaze::Utils::Rnd
 {
@@ -28,13 +31,59 @@ struct ExcludePack
 {
 };
 
+//! @brief Misses allowed when sampling a filtered view through its leading storage before falling back to one pass over the view
+inline constexpr int kMaxPickRejections = 32;
+
+//! @brief The engine behind every pick in this file, so picks no longer construct a std::mt19937 each.
+//! Unseeded picks continue `stream`. Seeded picks reseed a separate engine from `seed`, so the same seed and registry
+//! state always give the same pick.
+//! @param seed 0 to draw from `stream`
+//! @param stream
+//! @return std::mt19937&
+inline std::mt19937 &pick_engine( unsigned long seed, Stream stream )
+{
+  static std::mt19937 seeded_engine;
+  if ( seed == 0 ) return RngStreams::engine( stream );
+  seeded_engine.seed( static_cast<std::mt19937::result_type>( seed ) );
+  return seeded_engine;
+}
+
+//! @brief Pick a uniformly random entity from an EnTT view.
+//! Draws random indices into the view's leading (smallest) storage and keeps the first entity that passes the view's
+//! filter, which is O(1) when the filter passes most of the storage. If it rejects too many draws, the pick falls back to
+//! reservoir sampling in a single pass over the view.
+//! @param view Any registry view
+//! @param engine
+//! @return entt::entity entt::null if the view is empty
+template <typename View>
+entt::entity pick_random_entity( const View &view, std::mt19937 &engine )
+{
+  const auto *pool = view.handle();
+  if ( pool == nullptr || pool->empty() ) return entt::null;
+
+  std::uniform_int_distribution<std::size_t> index_dist( 0, pool->size() - 1 );
+  for ( int attempt = 0; attempt < kMaxPickRejections; ++attempt )
+  {
+    const auto entity = pool->data()[index_dist( engine )];
+    if ( view.contains( entity ) ) return entity;
+  }
+
+  entt::entity picked = entt::null;
+  std::size_t seen = 0;
+  for ( auto entity : view )
+  {
+    if ( std::uniform_int_distribution<std::size_t>( 0, seen++ )( engine ) == 0 ) picked = entity;
+  }
+  return picked;
+}
+
 /**
  * @brief Retrieves a random entity and its position component from entities matching the
  * specified criteria.
  *
  * This function selects a random entity and position component from a filtered view of entities
  * that have a Position component and all specified Include components, while excluding entities
- * with any of the Exclude components.
+ * with any of the Exclude components. See `pick_random_entity()` for how the entity is sampled.
  *
  * @tparam Include... Variadic template parameter pack specifying component types that entities
  * must have
@@ -44,27 +93,23 @@ struct ExcludePack
  * @param include_pack Template parameter pack wrapper for components to include in the filter. Do
  * not include Cmp::Position here.
  * @param exclude_pack Template parameter pack wrapper for components to exclude from the filter
- * @param seed Optional seed value for random number generation. If 0 (default), uses
- * std::random_device
+ * @param seed Optional seed value for random number generation. If 0 (default), draws from `stream`
+ * @param stream The RngStreams stream unseeded picks draw from
  *
  * @return std::pair<entt::entity, Cmp::Position> A pair containing the randomly selected entity
  * and its position component
  *
- * @note The function assumes there is at least one entity matching the filter criteria.
- *       If no entities match, the behavior is undefined.
- * @note Uses SPDLOG_DEBUG to log the number of matching positions found.
+ * @throws std::runtime_error if no entities match the filter criteria.
  */
 template <typename... Include, typename... Exclude>
 static std::pair<entt::entity, Cmp::Position> get_random_position( entt::registry &reg, IncludePack<Include...>, ExcludePack<Exclude...>,
-                                                                   unsigned long seed = 0,
+                                                                   unsigned long seed = 0, Stream stream = Stream::GENERAL,
                                                                    std::source_location loc = std::source_location::current() )
 {
   auto random_view = reg.view<Cmp::Position, Include...>( entt::exclude<Exclude...> );
 
-  auto random_view_count = std::distance( random_view.begin(), random_view.end() );
-  SPDLOG_DEBUG( "Found {} positions in the maze.", random_view_count );
-
-  if ( random_view_count == 0 )
+  entt::entity random_entity = pick_random_entity( random_view, pick_engine( seed, stream ) );
+  if ( random_entity == entt::null )
   {
     SPDLOG_ERROR( "get_random_position() called with no matching entities.\n  Called from: {}:{} in '{}'", loc.file_name(), loc.line(),
                   loc.function_name() );
@@ -73,104 +118,50 @@ static std::pair<entt::entity, Cmp::Position> get_random_position( entt::registr
     throw std::runtime_error( ss.str() );
   }
 
-  int upper_limit = static_cast<int>( random_view_count - 1 );
-  Cmp::RandomInt seed_picker( 0, upper_limit );
-  if ( seed != 0 ) { seed_picker.seed( seed ); }
-  else { seed_picker.seed( std::random_device{}() ); }
-
-  int random_index = seed_picker.gen();
-  SPDLOG_DEBUG( "Random index selected: {}", random_index );
-  if ( random_index < 0 || random_index >= random_view_count )
-  {
-    SPDLOG_CRITICAL( "Random index {} out of bounds (0 to {}). Called from: {}:{} in '{}'", random_index, random_view_count - 1, loc.file_name(),
-                     loc.line(), loc.function_name() );
-    std::stringstream ss;
-    ss << "Random index " << random_index << " out of bounds. Called from " << loc.file_name() << ":" << loc.line() << " in '" << loc.function_name()
-       << "'";
-    throw std::out_of_range( ss.str() );
-  }
-  auto it = random_view.begin();
-  std::advance( it, random_index );
-
-  // Get the random entity
-  entt::entity random_entity = *it;
-
   // Get the position component
   Cmp::Position random_position = random_view.template get<Cmp::Position>( random_entity );
 
   return { random_entity, random_position };
 }
 
-//! @brief Get the n random components of a specific type from the registry
-//! @note If result_size > 70% of the sample space then this function may be inefficient.
-//!       See "coupon collector" problem for more details
+//! @brief Get n distinct random entities owning a specific component type
+//! @note Gathers the matching entities in one pass, then partially shuffles the first `result_size` into place
 //! @tparam Component The type of component to retrieve
 //! @tparam Include Additional types of components that must be included
 //! @tparam Exclude Additional types of components that must be excluded
 //! @param reg The entity registry
 //! @param result_size The number of random components to retrieve
-//! @param seed Optional seed value for random number generation
-//! @return std::map<entt::entity, Component> A map of entities to their corresponding components
+//! @param seed Optional seed value for random number generation. If 0 (default), draws from `stream`
+//! @param stream
+//! @return std::vector<entt::entity> The selected entities, in random order
 template <typename Component, typename... Include, typename... Exclude>
-static std::set<entt::entity> get_n_rand_components( entt::registry &reg, std::size_t result_size, IncludePack<Include...>, ExcludePack<Exclude...>,
-                                                     unsigned long seed = 0 )
+static std::vector<entt::entity> get_n_rand_components( entt::registry &reg, std::size_t result_size, IncludePack<Include...>,
+                                                        ExcludePack<Exclude...>, unsigned long seed = 0, Stream stream = Stream::GENERAL )
 {
-  std::set<entt::entity> results;
   if ( result_size == 0 )
   {
     SPDLOG_WARN( "Requested 0 random components. Returning empty result set." );
-    return results;
+    return {};
   }
 
   auto cmp_view = reg.view<Component, Include...>( entt::exclude<Exclude...> );
-  auto cmp_view_size = std::distance( cmp_view.begin(), cmp_view.end() );
-  SPDLOG_DEBUG( "Found {} components in the maze.", cmp_view_size );
+  std::vector<entt::entity> results( cmp_view.begin(), cmp_view.end() );
+  SPDLOG_DEBUG( "Found {} components in the maze.", results.size() );
 
   // clamp result size if there are fewer components available
-  if ( cmp_view_size < result_size )
-  {
-    SPDLOG_WARN( "Requested {} random components, but only {} available. Returning all available components.", result_size, cmp_view_size );
-    result_size = cmp_view_size;
-  }
-  if ( cmp_view_size == result_size )
+  if ( results.size() < result_size )
   {
-    // If the number of available entities matches the requested size, return all of them
-    for ( auto entity : cmp_view )
-    {
-      results.insert( entity );
-    }
-    return results;
+    SPDLOG_WARN( "Requested {} random components, but only {} available. Returning all available components.", result_size, results.size() );
+    result_size = results.size();
   }
 
-  // Set seed for random generator
-  Cmp::RandomInt seed_picker( 0, static_cast<int>( cmp_view_size - 1 ) );
-  if ( seed != 0 ) { seed_picker.seed( seed ); }
-  else { seed_picker.seed( std::random_device{}() ); }
-
-  // When result_size > some threshold (e.g., 50%), use index shuffle instead
-  if ( result_size > cmp_view_size / 2 )
-  {
-    std::vector<entt::entity> all_entities( cmp_view.begin(), cmp_view.end() );
-    // std::mt19937 rng( seed != 0 ? seed : std::random_device{}() );
-    std::shuffle( all_entities.begin(), all_entities.end(), seed_picker );
-    results.insert( all_entities.begin(), all_entities.begin() + result_size );
-    return results;
-  }
-
-  // keep picking random components until we reach the desired result size of unique components
-  while ( results.size() < result_size )
+  auto &engine = pick_engine( seed, stream );
+  for ( std::size_t i = 0; i < result_size; ++i )
   {
-    // pick random index and advance iterator to that position
-    int random_index = std::clamp( seed_picker.gen(), 0, static_cast<int>( cmp_view_size - 1 ) );
-    auto it = cmp_view.begin();
-    std::advance( it, random_index );
-
-    // Get the random entity and position component
-    entt::entity random_entity = *it;
-    if ( results.find( random_entity ) != results.end() ) continue; // already have this one
-
-    results.insert( random_entity );
+    std::uniform_int_distribution<std::size_t> index_dist( i, results.size() - 1 );
+    std::swap( results[i], results[index_dist( engine )] );
   }
+  results.resize( result_size );
   return results;
 }
 
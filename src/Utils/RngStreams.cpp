@@ -0,0 +1,134 @@
+#include <Utils/RngStreams.hpp>
+
+#include <spdlog/spdlog.h>
+
+#include <array>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+namespace ProceduralMaze::Utils::Rnd
+{
+
+namespace
+{
+
+constexpr auto kStreamCount = static_cast<std::size_t>( Stream::COUNT );
+
+constexpr std::array<std::string_view, kStreamCount> kStreamNames{ "general", "procgen", "cellautomata", "passages",
+                                                                   "hazards", "npcspawns", "particles" };
+
+struct State
+{
+  std::uint64_t seed{ 0 };
+  bool seeded{ false };
+
+  //! @brief true if the seed came from std::random_device rather than a `set_seed()` call
+  bool random{ false };
+  std::array<std::mt19937, kStreamCount> engines;
+
+  //! @brief times each level key has been passed to `begin_level()` since the last `set_seed()`
+  std::unordered_map<std::string, std::uint64_t> level_generations;
+};
+
+State &state()
+{
+  static State instance;
+  return instance;
+}
+
+//! @brief SplitMix64 finaliser: a cheap, well distributed 64-bit mix
+constexpr std::uint64_t mix( std::uint64_t value )
+{
+  value += 0x9e3779b97f4a7c15ULL;
+  value = ( value ^ ( value >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+  value = ( value ^ ( value >> 27 ) ) * 0x94d049bb133111ebULL;
+  return value ^ ( value >> 31 );
+}
+
+//! @brief FNV-1a, stable across platforms and runs unlike std::hash
+constexpr std::uint64_t hash( std::string_view text )
+{
+  std::uint64_t value = 0xcbf29ce484222325ULL;
+  for ( char c : text )
+  {
+    value ^= static_cast<unsigned char>( c );
+    value *= 0x100000001b3ULL;
+  }
+  return value;
+}
+
+void reseed_streams( State &s, std::uint64_t base_seed )
+{
+  for ( std::size_t i = 0; i < kStreamCount; ++i )
+  {
+    const auto stream_seed = mix( base_seed ^ hash( kStreamNames[i] ) );
+    std::seed_seq seq{ static_cast<std::uint32_t>( stream_seed ), static_cast<std::uint32_t>( stream_seed >> 32 ) };
+    s.engines[i].seed( seq );
+  }
+}
+
+State &seeded_state()
+{
+  auto &s = state();
+  if ( not s.seeded )
+  {
+    RngStreams::set_seed( ( static_cast<std::uint64_t>( std::random_device{}() ) << 32 ) | std::random_device{}() );
+    s.random = true;
+  }
+  return s;
+}
+
+} // namespace
+
+void RngStreams::set_seed( std::uint64_t seed )
+{
+  auto &s = state();
+  s.seed = seed;
+  s.seeded = true;
+  s.random = false;
+  s.level_generations.clear();
+  reseed_streams( s, mix( seed ) );
+  SPDLOG_INFO( "Random seed: {} (pass --seed {} to reproduce)", seed, seed );
+}
+
+std::uint64_t RngStreams::seed() { return seeded_state().seed; }
+
+bool RngStreams::is_explicit_seed() { return state().seeded && not state().random; }
+
+std::uint64_t RngStreams::begin_level( std::string_view level_key )
+{
+  auto &s = seeded_state();
+  auto &generation = s.level_generations[std::string( level_key )];
+  const auto level_seed = mix( mix( mix( s.seed ) ^ hash( level_key ) ) ^ generation++ );
+  reseed_streams( s, level_seed );
+  SPDLOG_INFO( "Generating {} (generation {}) from level seed {}", level_key, generation - 1, level_seed );
+  return level_seed;
+}
+
+std::string RngStreams::snapshot()
+{
+  std::ostringstream out;
+  for ( const auto &engine : seeded_state().engines )
+    out << engine << ' ';
+  return out.str();
+}
+
+bool RngStreams::restore( std::string_view snapshot )
+{
+  std::istringstream in{ std::string( snapshot ) };
+  std::array<std::mt19937, kStreamCount> engines;
+  for ( auto &engine : engines )
+    in >> engine;
+  if ( in.fail() ) return false;
+
+  auto &s = seeded_state();
+  s.engines = engines;
+  return true;
+}
+
+std::mt19937 &RngStreams::engine( Stream stream ) { return seeded_state().engines[static_cast<std::size_t>( stream )]; }
+
+std::string_view RngStreams::name( Stream stream ) { return kStreamNames[static_cast<std::size_t>( stream )]; }
+
+} // namespace ProceduralMaze::Utils::Rnd
@@ -0,0 +1,62 @@
+#ifndef SRC_UTILS_RNGSTREAMS_HPP__
+#define SRC_UTILS_RNGSTREAMS_HPP__
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+
+namespace ProceduralMaze::Utils::Rnd
+{
+
+//! @brief Independent random number streams, one per subsystem. Drawing more from one stream never shifts another,
+//! so particles emitted during generation cannot change the level.
+enum class Stream : std::uint8_t {
+  GENERAL,       // anything without a stream of its own, i.e. loot rolls and sprite variants
+  PROCGEN,       // RandomLevelGenerator, loot/plant placement and floor tiles
+  CELL_AUTOMATA, // CellAutomataSystem
+  PASSAGES,      // crypt passages
+  HAZARDS,       // sinkholes, corruption and wormholes
+  NPC_SPAWNS,    // NPC containers and spawns
+  PARTICLES,     // particle emission
+  COUNT
+};
+
+//! @brief The game's single source of randomness. Every stream is derived from one 64-bit seed, so a given seed
+//! reproduces every level exactly. Without `set_seed()` the seed is taken from std::random_device on first use and logged.
+class RngStreams
+{
+public:
+  //! @brief Reseed every stream from `seed` and forget the level generation counts
+  static void set_seed( std::uint64_t seed );
+
+  //! @brief The seed every stream is derived from
+  static std::uint64_t seed();
+
+  //! @brief True if the seed was passed to `set_seed()` (i.e. `--seed`), so this run's levels will be generated again by
+  //! later runs. False for a seed drawn from std::random_device.
+  static bool is_explicit_seed();
+
+  //! @brief Reseed every stream for generating the level `level_key` (i.e. the SceneData source path).
+  //! The nth generation of a level under the same seed always draws the same numbers, whatever happened before it.
+  //! @param level_key
+  //! @return std::uint64_t The seed the level's streams were derived from
+  static std::uint64_t begin_level( std::string_view level_key );
+
+  //! @brief Text snapshot of every stream's engine state, i.e. for restoring a cached level
+  static std::string snapshot();
+
+  //! @brief Put every stream back to a `snapshot()`. Nothing changes if `snapshot` is malformed.
+  //! @return false if `snapshot` is malformed
+  static bool restore( std::string_view snapshot );
+
+  //! @brief The engine behind `stream`
+  static std::mt19937 &engine( Stream stream );
+
+  //! @brief Name of `stream`, mixed into its seed
+  static std::string_view name( Stream stream );
+};
+
+} // namespace ProceduralMaze::Utils::Rnd
+
+#endif // SRC_UTILS_RNGSTREAMS_HPP__
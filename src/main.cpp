@@ -3,8 +3,63 @@
 #define SPDLOG_ACTIVE_LEVEL SPDLOG_LEVEL_INFO
 #include <Engine.hpp>
 #include <Logging/BasicLogController.hpp>
+#include <Utils/RngStreams.hpp>
 
-int main()
+#include <cstdint>
+#include <cstdlib>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace
+{
+
+struct CommandLine
+{
+  //! @brief std::nullopt for a normal windowed run
+  std::optional<ProceduralMaze::HeadlessOptions> headless;
+  //! @brief std::nullopt for a random game seed
+  std::optional<std::uint64_t> seed;
+};
+
+//! @brief Parse the command line:
+//! [--seed <n>] [--headless [frames] [--timestep <ms>] [--scenario <frame>:<EVENT>,...]]
+//! @throws std::invalid_argument On a malformed seed, frame count, timestep or scenario
+CommandLine parse_command_line( int argc, char *argv[] )
+{
+  CommandLine command_line;
+  auto &options = command_line.headless;
+  for ( int i = 1; i < argc; ++i )
+  {
+    const std::string_view arg( argv[i] );
+    const bool has_value = i + 1 < argc && argv[i + 1][0] != '-';
+    if ( arg == "--headless" )
+    {
+      if ( not options ) options.emplace();
+      if ( has_value ) options->frames = static_cast<unsigned int>( std::stoul( argv[++i] ) );
+    }
+    else if ( arg == "--timestep" && has_value )
+    {
+      if ( not options ) options.emplace();
+      options->timestep = sf::milliseconds( std::stoi( argv[++i] ) );
+    }
+    else if ( arg == "--scenario" && has_value )
+    {
+      if ( not options ) options.emplace();
+      auto scenario = ProceduralMaze::HeadlessOptions::parse_scenario( argv[++i] );
+      if ( not scenario ) throw std::invalid_argument( "scenario '" + std::string( argv[i] ) + "', expected <frame>:<EVENT>,..." );
+      options->scenario = std::move( *scenario );
+    }
+    else if ( arg == "--seed" && has_value ) { command_line.seed = std::stoull( argv[++i] ); }
+    else { SPDLOG_WARN( "Ignoring unknown argument '{}'", arg ); }
+  }
+  return command_line;
+}
+
+} // namespace
+
+int main( int argc, char *argv[] )
 {
   // Logging: make sure errors - exceptions and failed asserts - go to log file
   fclose( stderr );
@@ -15,6 +70,18 @@ int main()
 
   SPDLOG_DEBUG( "Entering Engine" );
 
-  ProceduralMaze::Engine engine;
-  engine.run();
-}
\ No newline at end of file
+  CommandLine command_line;
+  try
+  {
+    command_line = parse_command_line( argc, argv );
+  } catch ( const std::exception &e )
+  {
+    SPDLOG_CRITICAL( "Invalid command line argument: {}", e.what() );
+    return EXIT_FAILURE;
+  }
+
+  if ( command_line.seed ) { ProceduralMaze::Utils::Rnd::RngStreams::set_seed( *command_line.seed ); }
+
+  ProceduralMaze::Engine engine( std::move( command_line.headless ) );
+  return engine.run() ? EXIT_SUCCESS : EXIT_FAILURE;
+}